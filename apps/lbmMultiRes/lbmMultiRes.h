@@ -437,12 +437,18 @@ void runNonUniformLBM(Neon::domain::mGrid&                        grid,
         std::string ret = "P" + std::to_string(params.scale) + "_";
         ret += algoName();
         ret += "_" + typeName();
+        if (grid.getBackend().devType() == Neon::DeviceType::CPU) {
+            ret += "_CPU";
+        }
 
         return ret;
     };
 
     //system
     report.addMember("DeviceType", Neon::DeviceTypeUtil::toString(grid.getBackend().devType()));
+    if (grid.getBackend().devType() == Neon::DeviceType::CPU) {
+        report.addMember("NumThreads", omp_get_max_threads());
+    }
 
     //grid
     report.addMember("Grid Size X", gridDim.x);
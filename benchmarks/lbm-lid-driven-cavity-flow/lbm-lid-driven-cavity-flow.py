@@ -67,6 +67,8 @@ with open(command + '.log', 'w') as fp:
                                 parameters.append('--deviceType ' + DEVICE_TYPE)
                                 parameters.append('--deviceIds ' + DEVICE_SET)
                                 parameters.append('--grid ' + GRID)
+                                if DEVICE_TYPE == 'cpu':
+                                    parameters.append('--cpuKernel both')
                                 parameters.append('--domain-size ' + DOMAIN_SIZE)
                                 parameters.append('--warmup-iter ' + str(WARM_UP_ITER))
                                 parameters.append('--repetitions ' + str(REPETITIONS))
@@ -38,6 +38,8 @@ auto Config::toString() const -> std::string
     s << "............. devices " << vecToSting(c.devices) << std::endl;
     s << ".......... reportFile " << c.reportFile << std::endl;
     s << "............ gridType " << c.gridType << std::endl;
+    s << "........... streaming " << c.streaming << std::endl;
+    s << "........... cpuKernel " << c.cpuKernel << std::endl;
 
     s << "......... computeType " << c.computeType << std::endl;
     s << "........... storeType " << c.storeType << std::endl;
@@ -64,6 +66,8 @@ auto Config::parseArgs(const int argc, char* argv[])
             clipp::required("--deviceType") & clipp::value("deviceType", config.deviceType) % "Device ids to use",
             clipp::required("--deviceIds") & clipp::integers("gpus", config.devices) % "Device ids to use",
             clipp::option("--grid") & clipp::value("grid", config.gridType) % "Could be dGrid, eGrid, bGrid",
+            clipp::option("--streaming") & clipp::value("streaming", config.streaming) % "Could be pull (two population fields) or aa (one field updated in place)",
+            clipp::option("--cpuKernel") & clipp::value("cpuKernel", config.cpuKernel) % "Could be cell, simd or both (CPU only, both runs each repetition with the two kernels)",
             clipp::option("--domain-size") & clipp::integer("domain_size", config.N) % "Voxels along each dimension of the cube domain",
             clipp::option("--warmup-iter") & clipp::integer("warmup_iter", config.benchIniIter) % "Number of iteration for warm up. max_iter = warmup_iter + timed_iters",
             clipp::option("--max-iter") & clipp::integer("max_iter", config.benchMaxIter) % "Maximum solver iterations",
@@ -97,6 +101,16 @@ auto Config::parseArgs(const int argc, char* argv[])
         return -1;
     }
 
+    if (config.streaming != "pull" && config.streaming != "aa") {
+        std::cout << config.streaming << " is not a supported streaming method, use pull or aa" << '\n';
+        return -1;
+    }
+
+    if (config.cpuKernel != "cell" && config.cpuKernel != "simd" && config.cpuKernel != "both") {
+        std::cout << config.cpuKernel << " is not a supported CPU kernel, use cell, simd or both" << '\n';
+        return -1;
+    }
+
     helpSetLbmParameters();
 
     return 0;
@@ -33,6 +33,8 @@ struct Config
     Neon::skeleton::Occ        occ = Neon::skeleton::Occ::none;              // Neon OCC type
     Neon::set::TransferMode    transferMode = Neon::set::TransferMode::get;  // Neon transfer mode for halo update
     Neon::set::StencilSemantic stencilSemantic = Neon::set::StencilSemantic::streaming;
+    std::string                streaming = "pull";  // LBM streaming: pull (two population fields) or aa (single field, in place)
+    std::string                cpuKernel = "simd";  // CPU collide-stream kernel: cell, simd (runs of cells along x) or both
     bool                       vti = false;  // Export vti file
     std::string                computeType = "double";
     std::string                storeType = "double";
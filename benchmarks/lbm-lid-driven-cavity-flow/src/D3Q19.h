@@ -16,32 +16,19 @@ struct D3Q19Template
     static constexpr int goRangeEnd = 8;
     static constexpr int goBackOffset = 10; /** Offset to compute apply symmetry */
 
+    /** Components of the discrete velocities of the Lattice mesh, usable at compile time */
+    static constexpr int cx[Q] = {-1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0};
+    static constexpr int cy[Q] = {0, -1, 0, -1, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0, 0, 1, 1};
+    static constexpr int cz[Q] = {0, 0, -1, 0, 0, -1, 1, -1, 1, 0, 0, 0, 1, 0, 0, 1, -1, 1, -1};
+
 
     explicit D3Q19Template(const Neon::Backend& backend)
     {
         // The discrete velocities of the Lattice mesh.
-        c_vect = std::vector<Neon::index_3d>(
-            {
-                {-1, 0, 0} /*!  0  Symmetry first section (GO) */,
-                {0, -1, 0} /*!  1  */,
-                {0, 0, -1} /*!  2  */,
-                {-1, -1, 0} /*! 3  */,
-                {-1, 1, 0} /*!  4  */,
-                {-1, 0, -1} /*! 5  */,
-                {-1, 0, 1} /*!  6  */,
-                {0, -1, -1} /*! 7  */,
-                {0, -1, 1} /*!  8  */,
-                {0, 0, 0} /*!   9  The center */,
-                {1, 0, 0} /*!   10 Symmetry mirror section (BK) */,
-                {0, 1, 0} /*!   11 */,
-                {0, 0, 1} /*!   12 */,
-                {1, 1, 0} /*!   13 */,
-                {1, -1, 0} /*!  14 */,
-                {1, 0, 1} /*!   15 */,
-                {1, 0, -1} /*!  16 */,
-                {0, 1, 1} /*!   17 */,
-                {0, 1, -1} /*!  18 */,
-            });
+        // 0 to 8 is the symmetry first section (GO), 9 the center and 10 to 18 the symmetry mirror section (BK)
+        for (int q = 0; q < Q; q++) {
+            c_vect.emplace_back(cx[q], cy[q], cz[q]);
+        }
 
         auto c_neon = backend.devSet().newMemSet<Neon::index_3d>(
             Neon::DataUse::HOST_DEVICE,
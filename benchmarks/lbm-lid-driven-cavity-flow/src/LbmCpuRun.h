@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Neon/Neon.h"
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+
+/**
+ * Layout of the runs of cells along x used by the CPU kernels.
+ * A run starts at its head cell and its cells are at a constant stride in memory
+ * for a given population, so a kernel can process the run with SIMD lanes.
+ * Grids without a specialization are processed cell by cell.
+ */
+template <typename Grid>
+struct LbmCpuRun
+{
+    static constexpr bool isSupported = false;
+};
+
+/**
+ * dGrid: runs of runLength cells along x within a partition.
+ * All the cells of the span are active and the neighbours of a cell are at fixed offsets,
+ * including the ones in the z halo.
+ */
+template <>
+struct LbmCpuRun<Neon::dGrid>
+{
+    static constexpr bool isSupported = true;
+    static constexpr int  runLength = 16;
+
+    using Idx = Neon::dGrid::Idx;
+
+    template <typename Partition>
+    static inline auto isHead(const Partition& p, const Idx& idx, NEON_OUT int& length)
+        -> bool
+    {
+        const int x = idx.get().x;
+        if (x % runLength != 0) {
+            return false;
+        }
+        length = std::min(runLength, p.dim().x - x);
+        return true;
+    }
+
+    static inline auto lane(const Idx& head, int i)
+        -> Idx
+    {
+        return Idx(head.get().x + i, head.get().y, head.get().z);
+    }
+
+    template <typename Partition>
+    static inline auto isActive(const Partition&, const Idx&)
+        -> bool
+    {
+        return true;
+    }
+
+    template <typename Partition>
+    static inline auto hasLocalNeighbours(const Partition&, const Idx&)
+        -> bool
+    {
+        return true;
+    }
+
+    template <typename Partition>
+    static inline auto getStride(const Partition& p)
+        -> Neon::int64_3d
+    {
+        const auto& pitch = p.getPitchData();
+        return Neon::int64_3d(int64_t(pitch.x), int64_t(pitch.y), int64_t(pitch.z));
+    }
+};
+
+/**
+ * bGrid: a run is a row along x of a block, starting at its first active cell.
+ * Only the neighbours of the cells inside the block, away from its faces,
+ * are at fixed offsets in memory.
+ */
+template <typename SBlock>
+struct LbmCpuRun<Neon::domain::details::bGrid::bGrid<SBlock>>
+{
+    static constexpr bool isSupported = true;
+    static constexpr int  runLength = SBlock::memBlockSizeX;
+
+    using Idx = typename Neon::domain::details::bGrid::bGrid<SBlock>::Idx;
+
+    template <typename Partition>
+    static inline auto isHead(const Partition& p, const Idx& idx, NEON_OUT int& length)
+        -> bool
+    {
+        for (int i = 0; i < idx.mInDataBlockIdx.x; i++) {
+            if (p.isActive(lane(idx, i - idx.mInDataBlockIdx.x))) {
+                return false;
+            }
+        }
+        length = runLength - idx.mInDataBlockIdx.x;
+        return true;
+    }
+
+    static inline auto lane(const Idx& head, int i)
+        -> Idx
+    {
+        Idx res = head;
+        res.mInDataBlockIdx.x = static_cast<typename Idx::InDataBlockIdx::Integer>(head.mInDataBlockIdx.x + i);
+        return res;
+    }
+
+    template <typename Partition>
+    static inline auto isActive(const Partition& p, const Idx& idx)
+        -> bool
+    {
+        return p.isActive(idx);
+    }
+
+    template <typename Partition>
+    static inline auto hasLocalNeighbours(const Partition&, const Idx& idx)
+        -> bool
+    {
+        const auto& l = idx.mInDataBlockIdx;
+        return l.x > 0 && l.x < int(SBlock::memBlockSizeX) - 1 &&
+               l.y > 0 && l.y < int(SBlock::memBlockSizeY) - 1 &&
+               l.z > 0 && l.z < int(SBlock::memBlockSizeZ) - 1;
+    }
+
+    template <typename Partition>
+    static inline auto getStride(const Partition&)
+        -> Neon::int64_3d
+    {
+        return Neon::int64_3d(int64_t(SBlock::memBlockPitchX), int64_t(SBlock::memBlockPitchY), int64_t(SBlock::memBlockPitchZ));
+    }
+};
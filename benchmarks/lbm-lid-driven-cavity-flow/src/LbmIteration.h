@@ -30,16 +30,44 @@ struct LbmIterationD3Q19
                       PopulationField&           fIn /*!   inpout population field */,
                       PopulationField&           fOut,
                       CellTypeField&             cellTypeField /*!       Cell type field     */,
-                      LbmComputeType             omega /*! LBM omega parameter */)
+                      LbmComputeType             omega /*! LBM omega parameter */,
+                      bool                       cpuRuns = false /*! use the CPU kernels that process runs of cells along x */)
     {
         pop[0] = fIn;
         pop[1] = fOut;
 
-        setupSkeletons(0, stencilSemantic, occ, transfer, pop[0], pop[1], cellTypeField, omega);
-        setupSkeletons(1, stencilSemantic, occ, transfer, pop[1], pop[0], cellTypeField, omega);
+        setupSkeletons(0, stencilSemantic, occ, transfer, pop[0], pop[1], cellTypeField, omega, cpuRuns);
+        setupSkeletons(1, stencilSemantic, occ, transfer, pop[1], pop[0], cellTypeField, omega, cpuRuns);
 
         parity = 0;
+        inPlace = false;
     }
+
+    /**
+     * In-place streaming with the AA-pattern: a single population field is updated
+     * by alternating an even and an odd kernel, which halves the population memory.
+     * Populations are pushed to the neighbours by the odd kernel so only one partition is supported.
+     */
+    LbmIterationD3Q19(Neon::skeleton::Occ     occ,
+                      Neon::set::TransferMode transfer,
+                      PopulationField&        f /*!   inpout population field */,
+                      CellTypeField&          cellTypeField /*!       Cell type field     */,
+                      LbmComputeType          omega /*! LBM omega parameter */)
+    {
+        if (f.getBackend().devSet().setCardinality() > 1) {
+            Neon::NeonException exce("LbmIterationD3Q19");
+            exce << "In-place (AA) streaming is only supported on a single device";
+            NEON_THROW(exce);
+        }
+        pop[0] = f;
+        pop[1] = f;
+
+        setupSkeletonsAA(occ, transfer, pop[0], cellTypeField, omega);
+
+        parity = 0;
+        inPlace = true;
+    }
+
     auto getInput()
         -> PopulationField&
     {
@@ -66,6 +94,15 @@ struct LbmIterationD3Q19
         pop[0].getBackend().syncAll();
     }
 
+    /**
+     * Whether the populations of a cell can be read in place, i.e. with the AA-pattern after an odd step.
+     */
+    auto isInPlace()
+        const -> bool
+    {
+        return inPlace && parity == 0;
+    }
+
    private:
     auto updateParity()
         -> void
@@ -80,22 +117,47 @@ struct LbmIterationD3Q19
                         PopulationField&           inField /*!   inpout population field */,
                         PopulationField&           outField,
                         CellTypeField&             cellTypeField /*!       Cell type field     */,
-                        LbmComputeType             omega /*! LBM omega parameter */)
+                        LbmComputeType             omega /*! LBM omega parameter */,
+                        bool                       cpuRuns)
     {
         std::vector<Neon::set::Container> ops;
         lbmTwoPop[target] = Neon::skeleton::Skeleton(inField.getBackend());
         Neon::skeleton::Options opt(occ, transfer);
-        ops.push_back(LbmTools::iteration(stencilSemantic,
-                                          inField,
-                                          cellTypeField,
-                                          omega,
-                                          outField));
+        if (cpuRuns) {
+            ops.push_back(LbmTools::iterationCpu(stencilSemantic,
+                                                 inField,
+                                                 cellTypeField,
+                                                 omega,
+                                                 outField));
+        } else {
+            ops.push_back(LbmTools::iteration(stencilSemantic,
+                                              inField,
+                                              cellTypeField,
+                                              omega,
+                                              outField));
+        }
         std::stringstream appName;
         appName << "LBM_iteration_" << std::to_string(target);
         lbmTwoPop[target].sequence(ops, appName.str(), opt);
     }
 
+    auto setupSkeletonsAA(Neon::skeleton::Occ     occ,
+                          Neon::set::TransferMode transfer,
+                          PopulationField&        f /*!   inpout population field */,
+                          CellTypeField&          cellTypeField /*!       Cell type field     */,
+                          LbmComputeType          omega /*! LBM omega parameter */)
+    {
+        Neon::skeleton::Options opt(occ, transfer);
+
+        lbmTwoPop[0] = Neon::skeleton::Skeleton(f.getBackend());
+        lbmTwoPop[0].sequence({LbmTools::iterationAAEven(f, cellTypeField, omega)}, "LBM_iteration_AA_even", opt);
+
+        lbmTwoPop[1] = Neon::skeleton::Skeleton(f.getBackend());
+        lbmTwoPop[1].sequence({LbmTools::iterationAAOdd(f, cellTypeField, omega)}, "LBM_iteration_AA_odd", opt);
+    }
+
     Neon::skeleton::Skeleton lbmTwoPop[2];
     PopulationField          pop[2];
     int                      parity;
+    bool                     inPlace;
 };
\ No newline at end of file
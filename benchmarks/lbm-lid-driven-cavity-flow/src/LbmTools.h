@@ -1,5 +1,6 @@
 #include "CellType.h"
 #include "D3Q19.h"
+#include "LbmCpuRun.h"
 #include "Neon/Neon.h"
 #include "Neon/set/Containter.h"
 
@@ -196,13 +197,12 @@ struct LbmContainers<D3Q19Template<typename PopulationField::Type, LbmComputeTyp
 
 
     static inline NEON_CUDA_HOST_DEVICE auto
-    collideBgkUnrolled(Idx const&                           i /*!     LbmComputeType iterator   */,
-                       const LbmStoreType                   pop[Lattice::Q],
-                       LbmComputeType const&                rho /*!   Density            */,
-                       std::array<LbmComputeType, 3> const& u /*!     Velocity           */,
-                       LbmComputeType const&                usqr /*!  Usqr               */,
-                       LbmComputeType const&                omega /*! Omega              */,
-                       typename PopulationField::Partition& fOut /*!  Population         */)
+    collideBgk(const LbmStoreType                   pop[Lattice::Q],
+               LbmComputeType const&                rho /*!   Density            */,
+               std::array<LbmComputeType, 3> const& u /*!     Velocity           */,
+               LbmComputeType const&                usqr /*!  Usqr               */,
+               LbmComputeType const&                omega /*! Omega              */,
+               NEON_OUT LbmComputeType              popOut[Lattice::Q] /*!  Post-collision population */)
 
         -> void
     {
@@ -254,10 +254,10 @@ struct LbmContainers<D3Q19Template<typename PopulationField::Type, LbmComputeTyp
         const LbmComputeType pop_out_opp_08 = (1. - omega) * static_cast<LbmComputeType>(pop[18]) + omega * eqopp_08;
 
 
-#define COMPUTE_GO_AND_BACK(GOid, BKid)                                 \
-    {                                                                   \
-        fOut(i, GOid) = static_cast<LbmStoreType>(pop_out_0##GOid);     \
-        fOut(i, BKid) = static_cast<LbmStoreType>(pop_out_opp_0##GOid); \
+#define COMPUTE_GO_AND_BACK(GOid, BKid)      \
+    {                                        \
+        popOut[GOid] = pop_out_0##GOid;     \
+        popOut[BKid] = pop_out_opp_0##GOid; \
     }
 
         COMPUTE_GO_AND_BACK(0, 10)
@@ -277,7 +277,57 @@ struct LbmContainers<D3Q19Template<typename PopulationField::Type, LbmComputeTyp
             const LbmComputeType pop_out_09 = (1. - omega) *
                                                   static_cast<LbmComputeType>(pop[Lattice::centerDirection]) +
                                               omega * eq_09;
-            fOut(i, Lattice::centerDirection) = static_cast<LbmStoreType>(pop_out_09);
+            popOut[Lattice::centerDirection] = pop_out_09;
+        }
+    }
+
+    static inline NEON_CUDA_HOST_DEVICE auto
+    collideBgkUnrolled(Idx const&                           i /*!     LbmComputeType iterator   */,
+                       const LbmStoreType                   pop[Lattice::Q],
+                       LbmComputeType const&                rho /*!   Density            */,
+                       std::array<LbmComputeType, 3> const& u /*!     Velocity           */,
+                       LbmComputeType const&                usqr /*!  Usqr               */,
+                       LbmComputeType const&                omega /*! Omega              */,
+                       typename PopulationField::Partition& fOut /*!  Population         */)
+
+        -> void
+    {
+        LbmComputeType popOut[Lattice::Q];
+        collideBgk(pop, rho, u, usqr, omega, NEON_OUT popOut);
+        for (int q = 0; q < Lattice::Q; q++) {
+            fOut(i, q) = static_cast<LbmStoreType>(popOut[q]);
+        }
+    }
+
+    /**
+     * Pull streaming followed by BGK collision for a single cell, wall neighbours are bounced back.
+     */
+    static inline NEON_CUDA_HOST_DEVICE auto
+    pullCollide(Idx const&                                 gidx,
+                CellType const&                            cellInfo,
+                typename PopulationField::Partition const& fIn,
+                LbmComputeType const&                      omega,
+                typename PopulationField::Partition&       fOut)
+        -> void
+    {
+        if (cellInfo.classification == CellType::bulk) {
+
+            LbmStoreType popIn[Lattice::Q];
+            pullStream(gidx, cellInfo.wallNghBitflag, fIn, NEON_OUT popIn);
+
+            LbmComputeType                rho;
+            std::array<LbmComputeType, 3> u{.0, .0, .0};
+            macroscopic(popIn, NEON_OUT rho, NEON_OUT u);
+
+            LbmComputeType usqr = 1.5 * (u[0] * u[0] +
+                                         u[1] * u[1] +
+                                         u[2] * u[2]);
+
+            collideBgkUnrolled(gidx,
+                               popIn,
+                               rho, u,
+                               usqr, omega,
+                               NEON_OUT fOut);
         }
     }
 
@@ -298,12 +348,271 @@ struct LbmContainers<D3Q19Template<typename PopulationField::Type, LbmComputeTyp
                 auto&       fOut = L.load(fOutField);
                 const auto& cellInfoPartition = L.load(cellTypeField);
 
+                return [=] NEON_CUDA_HOST_DEVICE(const typename PopulationField::Idx& gidx) mutable {
+                    CellType cellInfo = cellInfoPartition(gidx, 0);
+                    pullCollide(gidx, cellInfo, fIn, omega, NEON_OUT fOut);
+                };
+            });
+        // Each cell only reads fIn and writes its own populations of fOut
+        container.setOmpSimd(true);
+        // The loading lambda only reads fields and the omega captured by value
+        container.setComputeLambdaCache(true);
+        return container;
+    }
+
+    /**
+     * Pull and collide on a run of bulk cells with no wall neighbours.
+     * in[q] points to the population q of the upstream neighbour of the first cell and out[q]
+     * to the population q of the first cell, the following cells are at laneStride.
+     * All the lanes do the same work, so the loop is vectorized across the cells of the run.
+     */
+    static inline auto
+    pullCollideRun(const LbmStoreType* const in[Lattice::Q],
+                   LbmStoreType* const       out[Lattice::Q],
+                   int64_t                   laneStride,
+                   int                       length,
+                   LbmComputeType const&     omega)
+        -> void
+    {
+#ifndef NEON_OS_WINDOWS
+#pragma omp simd
+#endif
+        for (int i = 0; i < length; i++) {
+            LbmStoreType popIn[Lattice::Q];
+            for (int q = 0; q < Lattice::Q; q++) {
+                popIn[q] = in[q][i * laneStride];
+            }
+
+            LbmComputeType                rho;
+            std::array<LbmComputeType, 3> u{.0, .0, .0};
+            macroscopic(popIn, NEON_OUT rho, NEON_OUT u);
+
+            LbmComputeType usqr = 1.5 * (u[0] * u[0] +
+                                         u[1] * u[1] +
+                                         u[2] * u[2]);
+
+            LbmComputeType popOut[Lattice::Q];
+            collideBgk(popIn, rho, u, usqr, omega, NEON_OUT popOut);
+
+            for (int q = 0; q < Lattice::Q; q++) {
+                out[q][i * laneStride] = static_cast<LbmStoreType>(popOut[q]);
+            }
+        }
+    }
+
+    /**
+     * Same update as iteration, specialized for the CPU on grids whose memory layout is described by LbmCpuRun.
+     * The compute lambda does the work only on the head cell of each run along x: the bulk cells with no wall
+     * neighbours are processed with pullCollideRun and the remaining cells go through the per-cell path.
+     * On other grids, or when compiled for the device, this is the per-cell iteration.
+     */
+    static auto
+    iterationCpu(Neon::set::StencilSemantic stencilSemantic,
+                 const PopulationField&     fInField /*!   inpout population field */,
+                 const CellTypeField&       cellTypeField /*!       Cell type field     */,
+                 const LbmComputeType       omega /*! LBM omega parameter */,
+                 PopulationField&           fOutField /*!  output Population field */)
+        -> Neon::set::Container
+    {
+        using CpuRun = LbmCpuRun<Grid>;
+        if constexpr (!CpuRun::isSupported) {
+            return iteration(stencilSemantic, fInField, cellTypeField, omega, fOutField);
+        } else {
+            Neon::set::Container container = fInField.getGrid().newContainer(
+                "LBM_iteration_cpu",
+                [&, omega](Neon::set::Loader& L) -> auto {
+                    auto&       fIn = L.load(fInField,
+                                             Neon::Pattern::STENCIL, stencilSemantic);
+                    auto&       fOut = L.load(fOutField);
+                    const auto& cellInfoPartition = L.load(cellTypeField);
+
+                    return [=] NEON_CUDA_HOST_DEVICE(const typename PopulationField::Idx& gidx) mutable {
+#if defined(NEON_PLACE_CUDA_DEVICE)
+                        CellType cellInfo = cellInfoPartition(gidx, 0);
+                        pullCollide(gidx, cellInfo, fIn, omega, NEON_OUT fOut);
+#else
+                        int length = 0;
+                        if (!CpuRun::isHead(fIn, gidx, NEON_OUT length)) {
+                            return;
+                        }
+                        const Neon::int64_3d stride = CpuRun::getStride(fIn);
+
+                        auto isRunCell = [&](const Idx& lane) -> bool {
+                            if (!CpuRun::isActive(fIn, lane) || !CpuRun::hasLocalNeighbours(fIn, lane)) {
+                                return false;
+                            }
+                            const CellType cellInfo = cellInfoPartition(lane, 0);
+                            return cellInfo.classification == CellType::bulk && cellInfo.wallNghBitflag == 0;
+                        };
+
+                        int i = 0;
+                        while (i < length) {
+                            const int begin = i;
+                            while (i < length && isRunCell(CpuRun::lane(gidx, i))) {
+                                i++;
+                            }
+                            if (i > begin) {
+                                const Idx           first = CpuRun::lane(gidx, begin);
+                                const LbmStoreType* in[Lattice::Q];
+                                LbmStoreType*       out[Lattice::Q];
+                                for (int q = 0; q < Lattice::Q; q++) {
+                                    in[q] = &fIn(first, q) - (Lattice::cx[q] * stride.x + Lattice::cy[q] * stride.y + Lattice::cz[q] * stride.z);
+                                    out[q] = &fOut(first, q);
+                                }
+                                pullCollideRun(in, out, stride.x, i - begin, omega);
+                                continue;
+                            }
+                            const Idx lane = CpuRun::lane(gidx, i);
+                            if (CpuRun::isActive(fIn, lane)) {
+                                CellType cellInfo = cellInfoPartition(lane, 0);
+                                pullCollide(lane, cellInfo, fIn, omega, NEON_OUT fOut);
+                            }
+                            i++;
+                        }
+#endif
+                    };
+                });
+            container.setComputeLambdaCache(true);
+            return container;
+        }
+    }
+
+    /**
+     * Even step of the AA-pattern: the populations of a cell are read from and written to the cell itself.
+     * The post-collision population of direction q is stored in the slot of the opposite direction,
+     * which is where the following odd step expects it.
+     */
+    static auto
+    iterationAAEven(PopulationField&     fField /*!   inpout population field */,
+                    const CellTypeField& cellTypeField /*!       Cell type field     */,
+                    const LbmComputeType omega /*! LBM omega parameter */)
+        -> Neon::set::Container
+    {
+        Neon::set::Container container = fField.getGrid().newContainer(
+            "LBM_iteration_AA_even",
+            [&, omega](Neon::set::Loader& L) -> auto {
+                auto&       f = L.load(fField);
+                const auto& cellInfoPartition = L.load(cellTypeField);
+
+                return [=] NEON_CUDA_HOST_DEVICE(const typename PopulationField::Idx& gidx) mutable {
+                    CellType cellInfo = cellInfoPartition(gidx, 0);
+                    if (cellInfo.classification == CellType::bulk) {
+
+                        LbmStoreType popIn[Lattice::Q];
+                        for (int q = 0; q < Lattice::Q; q++) {
+                            popIn[q] = f(gidx, q);
+                        }
+
+                        LbmComputeType                rho;
+                        std::array<LbmComputeType, 3> u{.0, .0, .0};
+                        macroscopic(popIn, NEON_OUT rho, NEON_OUT u);
+
+                        LbmComputeType usqr = 1.5 * (u[0] * u[0] +
+                                                     u[1] * u[1] +
+                                                     u[2] * u[2]);
+
+                        LbmComputeType popOut[Lattice::Q];
+                        collideBgk(popIn, rho, u, usqr, omega, NEON_OUT popOut);
+
+#define AA_EVEN_STORE(GOid, BKid)                               \
+    {                                                           \
+        f(gidx, BKid) = static_cast<LbmStoreType>(popOut[GOid]); \
+        f(gidx, GOid) = static_cast<LbmStoreType>(popOut[BKid]); \
+    }
+                        AA_EVEN_STORE(0, 10)
+                        AA_EVEN_STORE(1, 11)
+                        AA_EVEN_STORE(2, 12)
+                        AA_EVEN_STORE(3, 13)
+                        AA_EVEN_STORE(4, 14)
+                        AA_EVEN_STORE(5, 15)
+                        AA_EVEN_STORE(6, 16)
+                        AA_EVEN_STORE(7, 17)
+                        AA_EVEN_STORE(8, 18)
+#undef AA_EVEN_STORE
+                        f(gidx, Lattice::centerDirection) = static_cast<LbmStoreType>(popOut[Lattice::centerDirection]);
+                    }
+                };
+            });
+        container.setComputeLambdaCache(true);
+        return container;
+    }
+
+#define AA_ODD_LOAD(GOx, GOy, GOz, GOid, BKx, BKy, BKz, BKid)                          \
+    {                                                                                  \
+        { /*GO*/                                                                       \
+            if (wallBitFlag & (uint32_t(1) << GOid)) {                                 \
+                popIn[GOid] = f(gidx, GOid) +                                          \
+                              f.template getNghData<BKx, BKy, BKz>(gidx, BKid)();      \
+            } else {                                                                   \
+                popIn[GOid] = f.template getNghData<BKx, BKy, BKz>(gidx, BKid)();      \
+            }                                                                          \
+        }                                                                              \
+        { /*BK*/                                                                       \
+            if (wallBitFlag & (uint32_t(1) << BKid)) {                                 \
+                popIn[BKid] = f(gidx, BKid) +                                          \
+                              f.template getNghData<GOx, GOy, GOz>(gidx, GOid)();      \
+            } else {                                                                   \
+                popIn[BKid] = f.template getNghData<GOx, GOy, GOz>(gidx, GOid)();      \
+            }                                                                          \
+        }                                                                              \
+    }
+
+#define AA_ODD_STORE(GOx, GOy, GOz, GOid, BKx, BKy, BKz, BKid)                                             \
+    {                                                                                                      \
+        { /*GO*/                                                                                           \
+            if (wallBitFlag & (uint32_t(1) << BKid)) {                                                     \
+                f(gidx, BKid) = static_cast<LbmStoreType>(popOut[GOid] +                                   \
+                                                          f.template getNghData<GOx, GOy, GOz>(gidx, GOid)()); \
+            } else {                                                                                       \
+                f.template writeNghData<GOx, GOy, GOz>(gidx, GOid, static_cast<LbmStoreType>(popOut[GOid])); \
+            }                                                                                              \
+        }                                                                                                  \
+        { /*BK*/                                                                                           \
+            if (wallBitFlag & (uint32_t(1) << GOid)) {                                                     \
+                f(gidx, GOid) = static_cast<LbmStoreType>(popOut[BKid] +                                   \
+                                                          f.template getNghData<BKx, BKy, BKz>(gidx, BKid)()); \
+            } else {                                                                                       \
+                f.template writeNghData<BKx, BKy, BKz>(gidx, BKid, static_cast<LbmStoreType>(popOut[BKid])); \
+            }                                                                                              \
+        }                                                                                                  \
+    }
+
+    /**
+     * Odd step of the AA-pattern: the populations left by the even step are pulled from the neighbours and,
+     * after the collision, pushed back to the neighbours in their own direction. Each population slot is read
+     * and written by a single cell, so the update is done in place.
+     * Bounce-back is folded in both ways: an incoming population from a wall comes from the cell itself,
+     * and an outgoing population towards a wall is stored back in the cell in the opposite direction.
+     * Values written to a halo are not sent back to their partition so this requires a single partition.
+     */
+    static auto
+    iterationAAOdd(PopulationField&     fField /*!   inpout population field */,
+                   const CellTypeField& cellTypeField /*!       Cell type field     */,
+                   const LbmComputeType omega /*! LBM omega parameter */)
+        -> Neon::set::Container
+    {
+        Neon::set::Container container = fField.getGrid().newContainer(
+            "LBM_iteration_AA_odd",
+            [&, omega](Neon::set::Loader& L) -> auto {
+                auto&       f = L.load(fField);
+                const auto& cellInfoPartition = L.load(cellTypeField);
+
                 return [=] NEON_CUDA_HOST_DEVICE(const typename PopulationField::Idx& gidx) mutable {
                     CellType cellInfo = cellInfoPartition(gidx, 0);
                     if (cellInfo.classification == CellType::bulk) {
+                        const uint32_t wallBitFlag = cellInfo.wallNghBitflag;
 
                         LbmStoreType popIn[Lattice::Q];
-                        pullStream(gidx, cellInfo.wallNghBitflag, fIn, NEON_OUT popIn);
+                        AA_ODD_LOAD(-1, 0, 0, /*  GOid */ 0, /* --- */ 1, 0, 0, /*  BKid */ 10);
+                        AA_ODD_LOAD(0, -1, 0, /*  GOid */ 1, /* --- */ 0, 1, 0, /*  BKid */ 11);
+                        AA_ODD_LOAD(0, 0, -1, /*  GOid */ 2, /* --- */ 0, 0, 1, /*  BKid */ 12);
+                        AA_ODD_LOAD(-1, -1, 0, /* GOid */ 3, /* --- */ 1, 1, 0, /*  BKid */ 13);
+                        AA_ODD_LOAD(-1, 1, 0, /*  GOid */ 4, /* --- */ 1, -1, 0, /* BKid */ 14);
+                        AA_ODD_LOAD(-1, 0, -1, /* GOid */ 5, /* --- */ 1, 0, 1, /*  BKid */ 15);
+                        AA_ODD_LOAD(-1, 0, 1, /*  GOid */ 6, /* --- */ 1, 0, -1, /* BKid */ 16);
+                        AA_ODD_LOAD(0, -1, -1, /* GOid */ 7, /* --- */ 0, 1, 1, /*  BKid */ 17);
+                        AA_ODD_LOAD(0, -1, 1, /*  GOid */ 8, /* --- */ 0, 1, -1, /* BKid */ 18);
+                        popIn[Lattice::centerDirection] = f(gidx, Lattice::centerDirection);
 
                         LbmComputeType                rho;
                         std::array<LbmComputeType, 3> u{.0, .0, .0};
@@ -313,16 +622,27 @@ struct LbmContainers<D3Q19Template<typename PopulationField::Type, LbmComputeTyp
                                                      u[1] * u[1] +
                                                      u[2] * u[2]);
 
-                        collideBgkUnrolled(gidx,
-                                           popIn,
-                                           rho, u,
-                                           usqr, omega,
-                                           NEON_OUT fOut);
+                        LbmComputeType popOut[Lattice::Q];
+                        collideBgk(popIn, rho, u, usqr, omega, NEON_OUT popOut);
+
+                        AA_ODD_STORE(-1, 0, 0, /*  GOid */ 0, /* --- */ 1, 0, 0, /*  BKid */ 10);
+                        AA_ODD_STORE(0, -1, 0, /*  GOid */ 1, /* --- */ 0, 1, 0, /*  BKid */ 11);
+                        AA_ODD_STORE(0, 0, -1, /*  GOid */ 2, /* --- */ 0, 0, 1, /*  BKid */ 12);
+                        AA_ODD_STORE(-1, -1, 0, /* GOid */ 3, /* --- */ 1, 1, 0, /*  BKid */ 13);
+                        AA_ODD_STORE(-1, 1, 0, /*  GOid */ 4, /* --- */ 1, -1, 0, /* BKid */ 14);
+                        AA_ODD_STORE(-1, 0, -1, /* GOid */ 5, /* --- */ 1, 0, 1, /*  BKid */ 15);
+                        AA_ODD_STORE(-1, 0, 1, /*  GOid */ 6, /* --- */ 1, 0, -1, /* BKid */ 16);
+                        AA_ODD_STORE(0, -1, -1, /* GOid */ 7, /* --- */ 0, 1, 1, /*  BKid */ 17);
+                        AA_ODD_STORE(0, -1, 1, /*  GOid */ 8, /* --- */ 0, 1, -1, /* BKid */ 18);
+                        f(gidx, Lattice::centerDirection) = static_cast<LbmStoreType>(popOut[Lattice::centerDirection]);
                     }
                 };
             });
+        container.setComputeLambdaCache(true);
         return container;
     }
+#undef AA_ODD_LOAD
+#undef AA_ODD_STORE
 
 #define COMPUTE_MASK_WALL(GOx, GOy, GOz, GOid, BKx, BKy, BKz, BKid)                                           \
     {                                                                                                         \
@@ -380,17 +700,22 @@ struct LbmContainers<D3Q19Template<typename PopulationField::Type, LbmComputeTyp
     popIn[GOID] = fIn(gidx, GOID); \
     popIn[DKID] = fIn(gidx, DKID);
 
+    /**
+     * With inPlace set, the populations are read from the cell itself as it is the case for the AA-pattern
+     * after an odd step, instead of being pulled from the neighbours.
+     */
     static auto
     computeRhoAndU([[maybe_unused]] const PopulationField& fInField /*!   inpout population field */,
                    const CellTypeField&                    cellTypeField /*!       Cell type field     */,
                    Rho&                                    rhoField /*!  output Population field */,
-                   U&                                      uField /*!  output Population field */)
+                   U&                                      uField /*!  output Population field */,
+                   bool                                    inPlace = false)
 
         -> Neon::set::Container
     {
         Neon::set::Container container = fInField.getGrid().newContainer(
             "LBM_iteration",
-            [&](Neon::set::Loader& L) -> auto {
+            [&, inPlace](Neon::set::Loader& L) -> auto {
                 auto& fIn = L.load(fInField,
                                    Neon::Pattern::STENCIL);
                 auto& rhoXpu = L.load(rhoField);
@@ -405,7 +730,13 @@ struct LbmContainers<D3Q19Template<typename PopulationField::Type, LbmComputeTyp
                     LbmStoreType                  popIn[Lattice::Q];
 
                     if (cellInfo.classification == CellType::bulk) {
-                        pullStream(gidx, cellInfo.wallNghBitflag, fIn, NEON_OUT popIn);
+                        if (inPlace) {
+                            for (int q = 0; q < Lattice::Q; q++) {
+                                popIn[q] = fIn(gidx, q);
+                            }
+                        } else {
+                            pullStream(gidx, cellInfo.wallNghBitflag, fIn, NEON_OUT popIn);
+                        }
                         macroscopic(popIn, NEON_OUT rho, NEON_OUT u);
                     } else {
                         if (cellInfo.classification == CellType::movingWall) {
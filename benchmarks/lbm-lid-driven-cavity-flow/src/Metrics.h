@@ -41,10 +41,15 @@ void recordMetrics(Neon::Backend& bk,
     auto   duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
     double mlups = static_cast<double>(nElements * clock_iter) / duration.count();
 
-    report.recordLoopTime(duration.count(), "microseconds");
-    report.recordMLUPS(mlups);
+    const std::string kernel = config.deviceType == "cpu" ? config.cpuKernel : "";
+
+    report.recordLoopTime(duration.count(), "microseconds", kernel);
+    report.recordMLUPS(mlups, kernel);
 
     std::cout << "Metrics: " << std::endl;
+    if (kernel.length() != 0) {
+        std::cout << "   kernel: " << kernel << std::endl;
+    }
     std::cout << "     time: " << std::setprecision(4) << duration.count() << " microseconds" << std::endl;
     std::cout << "    MLUPS: " << std::setprecision(4) << mlups << " MLUPS" << std::endl;
 }
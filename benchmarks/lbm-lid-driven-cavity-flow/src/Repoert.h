@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 #include "Config.h"
@@ -9,8 +10,15 @@ struct Report
     Neon::Report mReport;
     std::string  mFname;
 
+    // When the CPU kernels run side by side (cpuKernel both) only the per-kernel records are kept,
+    // as mMLUPS and mLoopTime would mix the two kernels
+    bool mKernelsSideBySide = false;
+
     std::vector<double> mMLUPS;
+    // MLUPS by CPU kernel, to compare the per-cell and the vectorized kernels side by side
+    std::map<std::string, std::vector<double>> mKernelMLUPS;
     std::vector<double> mLoopTime;
+    std::map<std::string, std::vector<double>> mKernelLoopTime;
     std::vector<double> mNeonGridInitTime;
     std::vector<double> mProblemSetupTime;
 
@@ -18,11 +26,13 @@ struct Report
 
     explicit Report(const Config& c);
 
-    auto recordMLUPS(double mlups)
+    auto recordMLUPS(double             mlups,
+                     const std::string& kernel = "")
         -> void;
 
     auto recordLoopTime(double             time,
-                        const std::string& unit)
+                        const std::string& unit,
+                        const std::string& kernel = "")
         -> void;
 
     auto recordNeonGridInitTime(double             time,
@@ -6,6 +6,7 @@ Report::Report(const Config& c)
     : mReport("lbm-lid-driven-cavity-flow")
 {
     mFname = c.reportFile;
+    mKernelsSideBySide = c.deviceType == "cpu" && c.cpuKernel == "both";
 
     mReport.addMember("Re", c.Re);
     mReport.addMember("ulb", c.ulb);
@@ -26,6 +27,8 @@ Report::Report(const Config& c)
     mReport.addMember("devices", c.devices);
     mReport.addMember("reportFile", c.reportFile);
     mReport.addMember("gridType", c.gridType);
+    mReport.addMember("streaming", c.streaming);
+    mReport.addMember("cpuKernel", c.cpuKernel);
 
     mReport.addMember("computeType", c.computeType);
     mReport.addMember("storeType", c.storeType);
@@ -42,15 +45,22 @@ Report::Report(const Config& c)
 }
 
 auto Report::
-    recordMLUPS(double mlups)
+    recordMLUPS(double             mlups,
+                const std::string& kernel)
         -> void
 {
-    mMLUPS.push_back(mlups);
+    if (!mKernelsSideBySide) {
+        mMLUPS.push_back(mlups);
+    }
+    if (kernel.length() != 0) {
+        mKernelMLUPS[kernel].push_back(mlups);
+    }
 }
 
 auto Report::
     recordLoopTime(double             time,
-                   const std::string& unit)
+                   const std::string& unit,
+                   const std::string& kernel)
         -> void
 {
     if (mtimeUnit.length() == 0) {
@@ -59,7 +69,12 @@ auto Report::
     if (unit.length() != mtimeUnit.length()) {
         NEON_THROW_UNSUPPORTED_OPERATION("Time unit inconsistency");
     }
-    mLoopTime.push_back(time);
+    if (!mKernelsSideBySide) {
+        mLoopTime.push_back(time);
+    }
+    if (kernel.length() != 0) {
+        mKernelLoopTime[kernel].push_back(time);
+    }
 }
 
 auto Report::recordNeonGridInitTime(double time, const std::string& unit) -> void
@@ -88,8 +103,16 @@ auto Report::
     save()
         -> void
 {
-    mReport.addMember("MLUPS", mMLUPS);
-    mReport.addMember(std::string("Loop Time (") + mtimeUnit + ")", mLoopTime);
+    if (!mKernelsSideBySide) {
+        mReport.addMember("MLUPS", mMLUPS);
+        mReport.addMember(std::string("Loop Time (") + mtimeUnit + ")", mLoopTime);
+    }
+    for (auto const& [kernel, mlups] : mKernelMLUPS) {
+        mReport.addMember("MLUPS_" + kernel, mlups);
+    }
+    for (auto const& [kernel, time] : mKernelLoopTime) {
+        mReport.addMember(std::string("Loop Time_") + kernel + " (" + mtimeUnit + ")", time);
+    }
     mReport.addMember(std::string("Problem Setup Time (") + mtimeUnit + ")", mProblemSetupTime);
     mReport.addMember(std::string("Neon Grid Init Time (") + mtimeUnit + ")", mNeonGridInitTime);
 
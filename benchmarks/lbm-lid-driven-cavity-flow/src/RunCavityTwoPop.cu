@@ -53,8 +53,13 @@ auto run(Config& config,
         [](const Neon::index_3d&) { return true; },
         lattice.c_vect);
 
+    // The AA-pattern streams in place so it needs a single population field
+    const bool      inPlace = config.streaming == "aa";
     PopulationField pop0 = grid.template newField<StorageFP, Lattice::Q>("Population", Lattice::Q, StorageFP(0.0));
-    PopulationField pop1 = grid.template newField<StorageFP, Lattice::Q>("Population", Lattice::Q, StorageFP(0.0));
+    PopulationField pop1;
+    if (!inPlace) {
+        pop1 = grid.template newField<StorageFP, Lattice::Q>("Population", Lattice::Q, StorageFP(0.0));
+    }
 
     typename Grid::template Field<StorageFP, 1> rho;
     typename Grid::template Field<StorageFP, 3> u;
@@ -70,14 +75,23 @@ auto run(Config& config,
     auto     flag = grid.template newField<CellType, 1>("Material", 1, defaultCelltype);
     auto     lbmParameters = config.getLbmParameters<ComputeFP>();
 
-    LbmIterationD3Q19<PopulationField, ComputeFP>
-        iteration(config.stencilSemantic,
-                  config.occ,
-                  config.transferMode,
-                  pop0,
-                  pop1,
-                  flag,
-                  lbmParameters.omega);
+    auto iteration = [&] {
+        if (inPlace) {
+            return LbmIterationD3Q19<PopulationField, ComputeFP>(config.occ,
+                                                                 config.transferMode,
+                                                                 pop0,
+                                                                 flag,
+                                                                 lbmParameters.omega);
+        }
+        return LbmIterationD3Q19<PopulationField, ComputeFP>(config.stencilSemantic,
+                                                             config.occ,
+                                                             config.transferMode,
+                                                             pop0,
+                                                             pop1,
+                                                             flag,
+                                                             lbmParameters.omega,
+                                                             config.deviceType == "cpu" && config.cpuKernel == "simd");
+    }();
 
     auto exportRhoAndU = [&bk, &rho, &u, &iteration, &flag, &grid, &ulid](int iterationId) {
         if ((iterationId) % 100 == 0) {
@@ -91,7 +105,7 @@ auto run(Config& config,
                 bk.syncAll();
             }
 
-            auto container = LbmContainers<Lattice, PopulationField, ComputeFP>::computeRhoAndU(f, flag, rho, u);
+            auto container = LbmContainers<Lattice, PopulationField, ComputeFP>::computeRhoAndU(f, flag, rho, u, iteration.isInPlace());
             container.run(Neon::Backend::mainStreamIdx);
             u.updateHostData(Neon::Backend::mainStreamIdx);
             rho.updateHostData(Neon::Backend::mainStreamIdx);
@@ -38,6 +38,15 @@ int main(int argc, char** argv)
     Report report(config);
 
     for(int i=0; i<config.repetitions; i++){
+        if (config.deviceType == "cpu" && config.cpuKernel == "both") {
+            // Run the per-cell and the vectorized kernels back to back to report their MLUPS side by side
+            for (auto const& kernel : {"cell", "simd"}) {
+                Config kernelConfig = config;
+                kernelConfig.cpuKernel = kernel;
+                CavityTwoPop::run(kernelConfig, report);
+            }
+            continue;
+        }
         CavityTwoPop::run(config, report);
     }
 
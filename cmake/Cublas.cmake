@@ -0,0 +1,9 @@
+#Toggle cuBLAS for the Blas patterns. To disable use "-DNEON_USE_CUBLAS=OFF"
+
+set(NEON_USE_CUBLAS "ON" CACHE BOOL "Use cuBLAS for the Blas patterns")
+
+if (${NEON_USE_CUBLAS})
+	message(STATUS "cuBLAS is enabled")
+else ()
+	message(STATUS "cuBLAS is disabled")
+endif ()
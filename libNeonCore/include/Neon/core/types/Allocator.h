@@ -17,7 +17,8 @@ enum struct Allocator
     MALLOC = 5,           /**< C++ malloc allocator            */
     NULL_MEM = 6,         /**< Allocation of a null pointer    */
     MANAGED = 7,          /**< Memory that the system does not need to garbage collect */
-    MIXED_MEM = 8         /**< Used to described aggregated memory containers (like mirror) where potentially different memory types can coexsist*/
+    MIXED_MEM = 8,        /**< Used to described aggregated memory containers (like mirror) where potentially different memory types can coexsist*/
+    HUGE_PAGE_MEM = 9     /**< Cache line aligned CPU allocation backed by 2 MB pages when the OS supports it */
 };
 
 /**
@@ -14,7 +14,8 @@ static std::vector<const char*> allocTypeStrings = {"ERROR",
                                                     "MALLOC",
                                                     "NULL_MEM",
                                                     "MANAGED",
-                                                    "MIXED_MEM"};
+                                                    "MIXED_MEM",
+                                                    "HUGE_PAGE_MEM"};
 
 auto AllocatorUtils::toString(Allocator allocator) -> const char*
 {
@@ -31,6 +32,7 @@ auto AllocatorUtils::compatible(Neon::DeviceType devEt, Neon::Allocator type) ->
         case Neon::DeviceType::CPU: {
             switch (type) {
                 case Neon::Allocator::MALLOC:
+                case Neon::Allocator::HUGE_PAGE_MEM:
                 case Neon::Allocator::CUDA_MEM_HOST:
                 case Neon::Allocator::CUDA_MEM_UNIFIED: {
                     return true;
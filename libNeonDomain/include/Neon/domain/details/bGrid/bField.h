@@ -31,6 +31,7 @@ class bField : public Neon::domain::interface::FieldBaseTemplate<T,
     using Type = T;
     using Grid = bGrid<SBlock>;
     using Field = bField<T, C, SBlock>;
+    using Self = bField<T, C, SBlock>;
     using Partition = bPartition<T, C, SBlock>;
     using Idx = bIndex<SBlock>;
     using BlockViewGrid = Neon::domain::tool::GridTransformer<details::GridTransformation>::Grid;
@@ -79,6 +80,8 @@ class bField : public Neon::domain::interface::FieldBaseTemplate<T,
 
     auto getMemoryField() -> BlockViewGrid::Field<T, C>&;
 
+    auto constSelf() const -> const Self&;
+
 
    private:
     auto getRef(const Neon::index_3d& idx, const int& cardinality) const -> T&;
@@ -76,6 +76,12 @@ auto bField<T, C, SBlock>::getMemoryField() -> BlockViewGrid::Field<T, C>&
     return mData->memoryField;
 }
 
+template <typename T, int C, typename SBlock>
+auto bField<T, C, SBlock>::constSelf() const -> const Self&
+{
+    return *this;
+}
+
 template <typename T, int C, typename SBlock>
 auto bField<T, C, SBlock>::isInsideDomain(const Neon::index_3d& idx) const -> bool
 {
@@ -10,6 +10,7 @@
 #include "Neon/domain/details/bGrid/bSpan.h"
 #include "Neon/domain/interface/GridBaseTemplate.h"
 #include "Neon/domain/patterns/PatternScalar.h"
+#include "Neon/domain/tools/ReduceResult.h"
 #include "Neon/domain/tools/Partitioner1D.h"
 #include "Neon/domain/tools/PointHashTable.h"
 #include "Neon/domain/tools/SpanTable.h"
@@ -140,6 +141,86 @@ class bGrid : public Neon::domain::interface::GridBaseTemplate<bGrid<SBlock>,
     auto newContainer(const std::string& name,
                       LoadingLambda      lambda) const -> Neon::set::Container;
 
+    /**
+     * Creates a container reducing the values computed on each cell into a PatternScalar.
+     * The compute lambda returned by the loading lambda maps a cell to a value of type T,
+     * values are combined by combineOp (e.g. sum, min, max), starting from identity.
+     */
+    template <Neon::Execution execution = Neon::Execution::device,
+              typename T,
+              typename CombineOp,
+              typename LoadingLambda>
+    auto newReduceContainer(const std::string&               name,
+                            Neon::template PatternScalar<T>& scalar,
+                            T                                identity,
+                            CombineOp                        combineOp,
+                            LoadingLambda                    lambda) const
+        -> Neon::set::Container;
+
+    /**
+     * Creates a container reducing the values computed on each cell into a host variable.
+     * T can be any copyable type, e.g. an array of histogram bins.
+     * The variable must outlive the container.
+     */
+    template <Neon::Execution execution = Neon::Execution::device,
+              typename T,
+              typename CombineOp,
+              typename LoadingLambda>
+    auto newReduceContainer(const std::string& name,
+                            T&                 result,
+                            T                  identity,
+                            CombineOp          combineOp,
+                            LoadingLambda      lambda) const
+        -> Neon::set::Container;
+
+    /**
+     * Creates a container computing several sums in a single traversal of the grid,
+     * e.g. the dot products <r,r>, <r,s> and <s,s> of single-reduction Krylov solvers.
+     * The compute lambda returns a std::array<T, N> whose i-th component is summed into the i-th scalar.
+     * Scalars are passed as a tuple of references, e.g. std::tie(rr, rs, ss).
+     */
+    template <Neon::Execution execution = Neon::Execution::device,
+              typename T,
+              typename... Ts,
+              typename LoadingLambda>
+    auto newSumContainer(const std::string&                                                                 name,
+                         std::tuple<Neon::template PatternScalar<T>&, Neon::template PatternScalar<Ts>&...> scalars,
+                         LoadingLambda                                                                      lambda) const
+        -> Neon::set::Container;
+
+    /**
+     * Switch for different reduction engines.
+     */
+    auto setReduceEngine(Neon::sys::patterns::Engine eng)
+        -> void;
+
+    /**
+     * Creation of a new scalar type that can store output from reduction operations
+     */
+    template <typename T>
+    auto newPatternScalar()
+        const -> Neon::template PatternScalar<T>;
+
+    /**
+     * creates a container implementing a dot product
+     */
+    template <typename T>
+    auto dot(const std::string&               name,
+             Field<T>&                        input1,
+             Field<T>&                        input2,
+             Neon::template PatternScalar<T>& scalar) const
+        -> Neon::set::Container;
+
+    /**
+     * creates a container implementing a norm2 operation
+     */
+    template <typename T>
+    auto norm2(const std::string&               name,
+               Field<T>&                        input,
+               Neon::template PatternScalar<T>& scalar,
+               Neon::Execution                  execution) const
+        -> Neon::set::Container;
+
     /**
      * Defines a new set of parameter to launch a Container
      */
@@ -196,12 +277,28 @@ class bGrid : public Neon::domain::interface::GridBaseTemplate<bGrid<SBlock>,
      */
     auto helpGetSetIdxAndGridIdx(Neon::index_3d idx) const -> std::tuple<Neon::SetIdx, Idx>;
 
+    /**
+     * Creates a reduction container computing the sum of input1 * input2 over the active voxels.
+     * When squareRoot is true, the square root of the final result is stored in the scalar.
+     */
+    template <typename T>
+    auto helpDot(const std::string&               name,
+                 Field<T>&                        input1,
+                 Field<T>&                        input2,
+                 Neon::template PatternScalar<T>& scalar,
+                 Neon::Execution                  execution,
+                 bool                             squareRoot) const
+        -> Neon::set::Container;
+
     struct Data
     {
         auto init(const Neon::Backend& bk)
         {
             spanTable.init(bk);
             launchParametersTable.init(bk);
+            reduceEngine = bk.devType() == Neon::DeviceType::CPU
+                               ? Neon::sys::patterns::Engine::OpenMP
+                               : Neon::sys::patterns::Engine::cuBlas;
         }
 
         Neon::domain::tool::SpanTable<Span> spanTable /** Span for each data view configurations */;
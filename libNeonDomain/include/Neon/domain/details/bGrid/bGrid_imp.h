@@ -304,6 +304,180 @@ auto bGrid<SBlock>::newContainer(const std::string& name,
     return kContainer;
 }
 
+template <typename SBlock>
+template <Neon::Execution execution,
+          typename T,
+          typename CombineOp,
+          typename LoadingLambda>
+auto bGrid<SBlock>::newReduceContainer(const std::string&               name,
+                                      Neon::template PatternScalar<T>& scalar,
+                                      T                                identity,
+                                      CombineOp                        combineOp,
+                                      LoadingLambda                    lambda) const
+    -> Neon::set::Container
+{
+    return Neon::set::Container::factoryReduce<execution>(name,
+                                                          Neon::set::internal::ContainerAPI::DataViewSupport::on,
+                                                          *this,
+                                                          Neon::domain::tool::ReduceResultUtils::newLoadingLambda(lambda, std::tie(scalar)),
+                                                          this->getDefaultBlock(),
+                                                          identity,
+                                                          combineOp,
+                                                          Neon::domain::tool::ReduceResultUtils::newWriter(scalar, combineOp));
+}
+
+template <typename SBlock>
+template <Neon::Execution execution,
+          typename T,
+          typename CombineOp,
+          typename LoadingLambda>
+auto bGrid<SBlock>::newReduceContainer(const std::string& name,
+                                      T&                 result,
+                                      T                  identity,
+                                      CombineOp          combineOp,
+                                      LoadingLambda      lambda) const
+    -> Neon::set::Container
+{
+    return Neon::set::Container::factoryReduce<execution>(name,
+                                                          Neon::set::internal::ContainerAPI::DataViewSupport::on,
+                                                          *this,
+                                                          lambda,
+                                                          this->getDefaultBlock(),
+                                                          identity,
+                                                          combineOp,
+                                                          Neon::domain::tool::ReduceResultUtils::newWriter(result, identity, combineOp));
+}
+
+template <typename SBlock>
+template <Neon::Execution execution,
+          typename T,
+          typename... Ts,
+          typename LoadingLambda>
+auto bGrid<SBlock>::newSumContainer(const std::string&                                                                 name,
+                                   std::tuple<Neon::template PatternScalar<T>&, Neon::template PatternScalar<Ts>&...> scalars,
+                                   LoadingLambda                                                                      lambda) const
+    -> Neon::set::Container
+{
+    static_assert((std::is_same_v<T, Ts> && ...), "Fused sums require scalars of the same type");
+    using Sum = Neon::domain::tool::ReduceResultUtils::ArraySum<T, 1 + sizeof...(Ts)>;
+
+    return Neon::set::Container::factoryReduce<execution>(name,
+                                                          Neon::set::internal::ContainerAPI::DataViewSupport::on,
+                                                          *this,
+                                                          Neon::domain::tool::ReduceResultUtils::newLoadingLambda(lambda, scalars),
+                                                          this->getDefaultBlock(),
+                                                          std::array<T, 1 + sizeof...(Ts)>{},
+                                                          Sum(),
+                                                          Neon::domain::tool::ReduceResultUtils::newSumWriter<T>(scalars));
+}
+
+template <typename SBlock>
+auto bGrid<SBlock>::setReduceEngine(Neon::sys::patterns::Engine eng)
+    -> void
+{
+    mData->reduceEngine = eng;
+}
+
+template <typename SBlock>
+template <typename T>
+auto bGrid<SBlock>::newPatternScalar() const -> Neon::template PatternScalar<T>
+{
+    auto pattern = Neon::PatternScalar<T>(this->getBackend(), mData->reduceEngine);
+
+    if (mData->reduceEngine == Neon::sys::patterns::Engine::CUB) {
+        for (auto& dataview : {Neon::DataView::STANDARD,
+                               Neon::DataView::INTERNAL,
+                               Neon::DataView::BOUNDARY}) {
+            auto launchParam = getLaunchParameters(dataview, this->getDefaultBlock(), 0);
+            for (SetIdx id = 0; id < launchParam.cardinality(); id++) {
+                uint32_t numBlocks = launchParam[id].cudaGrid().x *
+                                     launchParam[id].cudaGrid().y *
+                                     launchParam[id].cudaGrid().z;
+                pattern.getBlasSet(dataview).getBlas(id.idx()).setNumBlocks(numBlocks);
+            }
+        }
+    }
+    return pattern;
+}
+
+template <typename SBlock>
+template <typename T>
+auto bGrid<SBlock>::dot(const std::string&               name,
+                        Field<T>&                        input1,
+                        Field<T>&                        input2,
+                        Neon::template PatternScalar<T>& scalar) const -> Neon::set::Container
+{
+    return helpDot(name, input1, input2, scalar, Neon::Execution::device, false);
+}
+
+template <typename SBlock>
+template <typename T>
+auto bGrid<SBlock>::norm2(const std::string&               name,
+                          Field<T>&                        input,
+                          Neon::template PatternScalar<T>& scalar,
+                          Neon::Execution                  execution) const -> Neon::set::Container
+{
+    return helpDot(name, input, input, scalar, execution, true);
+}
+
+template <typename SBlock>
+template <typename T>
+auto bGrid<SBlock>::helpDot(const std::string&               name,
+                            Field<T>&                        input1,
+                            Field<T>&                        input2,
+                            Neon::template PatternScalar<T>& scalar,
+                            Neon::Execution                  execution,
+                            bool                             squareRoot) const -> Neon::set::Container
+{
+    if (input1.getCardinality() != input2.getCardinality()) {
+        NeonException exc("bGrid");
+        exc << "Reductions require fields with the same cardinality";
+        NEON_THROW(exc);
+    }
+
+    auto loadingLambda = [input1, input2, &scalar](Neon::set::Loader& loader) {
+        if (scalar.getReductionMode() == Neon::ReductionMode::deterministic) {
+            NeonException exc("bGrid");
+            exc << "The deterministic reduction mode is only supported by dGrid";
+            NEON_THROW(exc);
+        }
+        loader.load(scalar);
+        const auto a = loader.load(input1);
+        const auto b = input1.getUid() == input2.getUid() ? a : loader.load(input2);
+
+        return [=](const Idx& e) -> T {
+            T partial = 0;
+            for (int c = 0; c < a.cardinality(); c++) {
+                partial += a(e, c) * b(e, c);
+            }
+            return partial;
+        };
+    };
+    auto sum = [](const T& x, const T& y) { return x + y; };
+    auto writer = Neon::domain::tool::ReduceResultUtils::newWriter(scalar, sum, [squareRoot](const T& total) {
+        return squareRoot ? T(std::sqrt(total)) : total;
+    });
+
+    if (execution == Neon::Execution::host) {
+        return Neon::set::Container::factoryReduce<Neon::Execution::host>(name,
+                                                                          Neon::set::internal::ContainerAPI::DataViewSupport::on,
+                                                                          *this,
+                                                                          loadingLambda,
+                                                                          this->getDefaultBlock(),
+                                                                          T(0),
+                                                                          sum,
+                                                                          writer);
+    }
+    return Neon::set::Container::factoryReduce<Neon::Execution::device>(name,
+                                                                        Neon::set::internal::ContainerAPI::DataViewSupport::on,
+                                                                        *this,
+                                                                        loadingLambda,
+                                                                        this->getDefaultBlock(),
+                                                                        T(0),
+                                                                        sum,
+                                                                        writer);
+}
+
 template <typename SBlock>
 auto bGrid<SBlock>::
     getBlockViewGrid()
@@ -98,6 +98,17 @@ class bPartition
                T          defaultValue)
         const -> NghData;
 
+    /**
+     * Writes the field metadata at a neighbour cartesian point if the neighbour is active.
+     * A value written to a halo cell is not sent back to the partition that owns it.
+     */
+    template <int xOff, int yOff, int zOff>
+    NEON_CUDA_HOST_DEVICE inline auto
+    writeNghData(const Idx& eId,
+                 int        card,
+                 const T&   value)
+        -> bool;
+
     /**
      * Gets the global coordinates of the cartesian point.
      */
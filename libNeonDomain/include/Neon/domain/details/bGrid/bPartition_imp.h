@@ -377,6 +377,22 @@ NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C, SBlock>::
     return result;
 }
 
+template <typename T, int C, typename SBlock>
+template <int xOff, int yOff, int zOff>
+NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C, SBlock>::
+    writeNghData(const Idx& idx,
+                 int        card,
+                 const T&   value)
+        -> bool
+{
+    bIndex nghIdx = helpGetNghIdx<xOff, yOff, zOff>(idx);
+    auto [isValid, pitch] = helpNghPitch(nghIdx, card);
+    if (isValid) {
+        mMem[pitch] = value;
+    }
+    return isValid;
+}
+
 template <typename T, int C, typename SBlock>
 NEON_CUDA_HOST_DEVICE inline auto
 bPartition<T, C, SBlock>::isActive(const Idx&                      cell,
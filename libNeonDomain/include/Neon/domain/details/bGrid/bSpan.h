@@ -44,6 +44,18 @@ class bSpan
     NEON_CUDA_HOST_DEVICE inline auto setAndValidateGPUDevice(
         Idx& bidx) const -> bool;
 
+    /**
+     * Runs userLambda on all active voxels of a data block.
+     * The block bit mask is read one word at a time: empty words are skipped,
+     * fully active words are processed as runs along x without per-voxel checks.
+     * The runs are marked as SIMD loops only when vectorize is true, which the caller may request
+     * only if userLambda has no dependency between voxels (see OmpLaunchConfig::setSimd).
+     */
+    template <bool vectorize = false, typename UserLambda>
+    inline auto forEachActiveCPUDevice(
+        uint32_t const& dataBlockIdx,
+        UserLambda&     userLambda) const -> void;
+
 
     // We don't need to have a count on active blocks
     typename Idx::DataBlockCount                  mFirstDataBlockOffset;
@@ -37,6 +37,71 @@ bSpan<SBlock>::setAndValidateCPUDevice(Idx&            bidx,
     return isActive;
 }
 
+template <typename SBlock>
+template <bool vectorize, typename UserLambda>
+inline auto
+bSpan<SBlock>::forEachActiveCPUDevice(uint32_t const& dataBlockIdx,
+                                      UserLambda&     userLambda) const -> void
+{
+    using BitMask = typename SBlock::BitMask;
+    using BitMaskWordType = typename BitMask::BitMaskWordType;
+    using InDataBlockInteger = typename Idx::InDataBlockIdx::Integer;
+
+    constexpr BitMaskWordType fullWord = ~BitMaskWordType(0);
+
+    BitMask const& mask = mActiveMask[dataBlockIdx];
+
+    for (uint32_t wordIdx = 0; wordIdx < BitMask::nWords; wordIdx++) {
+        const BitMaskWordType word = mask.bits[wordIdx];
+        if (word == 0) {
+            continue;
+        }
+        const uint32_t firstPitch = wordIdx * BitMask::bitPerWord;
+        const uint32_t lastPitch = std::min(firstPitch + BitMask::bitPerWord, SBlock::memBlockCountElements);
+        // Voxels of a word are consecutive in memory (x is the fastest dimension),
+        // so the word is covered by runs along x that stop at the end of each row.
+        uint32_t pitch = firstPitch;
+        while (pitch < lastPitch) {
+            const uint32_t z = pitch / SBlock::memBlockPitchZ;
+            const uint32_t y = (pitch % SBlock::memBlockPitchZ) / SBlock::memBlockPitchY;
+            const uint32_t xBegin = pitch % SBlock::memBlockSizeX;
+            const uint32_t xEnd = std::min(SBlock::memBlockSizeX, xBegin + (lastPitch - pitch));
+
+            auto runOnVoxel = [&](uint32_t x) {
+                Idx bidx;
+                bidx.mDataBlockIdx = dataBlockIdx;
+                bidx.mInDataBlockIdx.x = static_cast<InDataBlockInteger>(x);
+                bidx.mInDataBlockIdx.y = static_cast<InDataBlockInteger>(y);
+                bidx.mInDataBlockIdx.z = static_cast<InDataBlockInteger>(z);
+                userLambda(bidx);
+            };
+
+            if (word == fullWord) {
+                if constexpr (vectorize) {
+#ifndef NEON_OS_WINDOWS
+#pragma omp simd
+#endif
+                    for (uint32_t x = xBegin; x < xEnd; x++) {
+                        runOnVoxel(x);
+                    }
+                } else {
+                    for (uint32_t x = xBegin; x < xEnd; x++) {
+                        runOnVoxel(x);
+                    }
+                }
+            } else {
+                for (uint32_t x = xBegin; x < xEnd; x++) {
+                    const uint32_t offsetInWord = pitch + (x - xBegin) - firstPitch;
+                    if ((word >> offsetInWord) & BitMaskWordType(1)) {
+                        runOnVoxel(x);
+                    }
+                }
+            }
+            pitch += xEnd - xBegin;
+        }
+    }
+}
+
 template <typename SBlock>
 bSpan<SBlock>::bSpan(typename Idx::DataBlockCount                  firstDataBlockOffset,
                      typename SBlock::BitMask const* NEON_RESTRICT activeMask,
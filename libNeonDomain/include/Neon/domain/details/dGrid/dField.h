@@ -171,6 +171,12 @@ class dField : public Neon::domain::interface::FieldBaseTemplate<T,
         {
             std::vector<int> startIDByView /* one entry for each cardinality */;
             std::vector<int> nElementsByView /* one entry for each cardinality */;
+            // Each range is split in leaves of leafSize elements, i.e. one z slice.
+            // Leaves have a global id that does not depend on the partitioning,
+            // which the deterministic reductions use to fix the order of the sums.
+            std::vector<int> firstLeafByView /* global id of the first leaf of each range */;
+            int              leafSize = 0;
+            int              nLeaves = 0 /* number of leaves of the whole grid */;
         };
 
         Neon::domain::tool::PartitionTable<Partition, ReductionInformation> partitionTable;
@@ -88,7 +88,25 @@ dField<T, C>::dField(const std::string&                        fieldUserName,
 
     {  // Setting up partitions
         Neon::aGrid const& aGrid = mData->grid->helpFieldMemoryAllocator();
-        mData->memoryField = aGrid.newField<T,C>(fieldUserName + "-storage", cardinality, T(), dataUse, memoryOptions);
+
+        // The pages of CPU buffers are first touched with the tiles of the OpenMP launchers.
+        // The tiles are taken from the backend configuration: a dynamic or guided schedule
+        // has no fixed thread mapping and is approximated by a static one with the same chunk.
+        Neon::MemoryOptions allocationOptions = memoryOptions;
+        if (grid.getBackend().runtime() == Neon::Runtime::openmp) {
+            const Neon::set::OmpLaunchConfig& ompLaunchConfig = grid.getBackend().ompLaunchConfig();
+
+            Neon::sys::FirstTouchTiling firstTouchTiling;
+            firstTouchTiling.rowLength = dims[0].x;
+            firstTouchTiling.rowsPerSlice = dims[0].y;
+            firstTouchTiling.haloSlices = haloRadius;
+            // The grid allocates halo slices for every field, the ones without halo leave them unused
+            firstTouchTiling.paddingSlices = (grid.getDevSet().setCardinality() == 1 ? 0 : 2 * zHaloRadius) - 2 * haloRadius;
+            firstTouchTiling.tile = ompLaunchConfig.tile();
+            firstTouchTiling.chunk = ompLaunchConfig.chunk();
+            allocationOptions.setFirstTouchTiling(firstTouchTiling);
+        }
+        mData->memoryField = aGrid.newField<T,C>(fieldUserName + "-storage", cardinality, T(), dataUse, allocationOptions);
         // const int setCardinality = mData->grid->getBackend().getDeviceCount();
         mData->partitionTable.forEachConfiguration(
             [&](Neon::Execution           execution,
@@ -112,127 +130,81 @@ dField<T, C>::dField(const std::string&                        fieldUserName,
     }
 
     {  // Setting Reduction information
+        // Each entry is a contiguous range [start, start + nElements) of the partition memory.
+        // The INTERNAL and BOUNDARY ranges are disjoint and together cover the STANDARD ones,
+        // also when the grid has a single partition, as OCC splits the reductions in that case too.
         mData->partitionTable.forEachConfigurationWithUserData(
             [&](Neon::Execution,
                 Neon::SetIdx   setIdx,
                 Neon::DataView dw,
                 typename Self::Partition&,
                 typename Data::ReductionInformation& reductionInfo) {
-                switch (dw) {
-                    case Neon::DataView::STANDARD: {
-                        // old structure [dv_id][c][i]
-                        if (grid.getBackend().devSet().setCardinality() == 1) {
-                            // As the number of devices is 1, we don't have halos.
-                            reductionInfo.startIDByView.push_back(0);
-                            reductionInfo.nElementsByView.push_back(int(dims[setIdx.idx()].rMul()));
-                        } else {
-                            switch (mData->memoryOptions.getOrder()) {
-                                case MemoryLayout::structOfArrays: {
-                                    for (int c = 0; c < mData->cardinality; ++c) {
-                                        // To compute the start point we need to
-                                        // jump the previous cardinalities -> c * dims[setIdx].x * dims[setIdx].y * (dims[setIdx].z + 2 * haloRadius)
-                                        // jump one halo -> dims[setIdx].x * dims[setIdx].y * haloRadius
-                                        int const startPoint = c * dims[setIdx].x * dims[setIdx].y * (dims[setIdx].z + 2 * haloRadius) +
-                                                               dims[setIdx].x * dims[setIdx].y * haloRadius;
-                                        int const nElements = dims[setIdx].rMul();
-
-                                        reductionInfo.startIDByView.push_back(startPoint);
-                                        reductionInfo.nElementsByView.push_back(nElements);
-                                    }
-                                    break;
-                                }
-                                case MemoryLayout::arrayOfStructs: {
-                                    int const startPoint = dims[setIdx].x * dims[setIdx].y * haloRadius * mData->cardinality;
-                                    int const nElements = dims[setIdx].x * dims[setIdx].y * dims[setIdx].z * mData->cardinality;
-
-                                    reductionInfo.startIDByView.push_back(startPoint);
-                                    reductionInfo.nElementsByView.push_back(nElements);
-
-                                    break;
-                                }
+                int const sliceSize = dims[setIdx].x * dims[setIdx].y;
+                int const zDim = dims[setIdx].z;
+                // Number of boundary slices at the bottom and at the top of the partition
+                int const zLower = std::min(mData->zHaloDim, zDim);
+                int const zUpper = std::min(mData->zHaloDim, zDim - zLower);
+                // Global z of the first slice of the partition
+                int const zOrigin = origins[setIdx].z;
+                int const zGlobalDim = mData->grid->getDimension().z;
+
+                auto addSlices = [&](int zFirst, int zCount) {
+                    if (zCount <= 0) {
+                        return;
+                    }
+                    switch (mData->memoryOptions.getOrder()) {
+                        case MemoryLayout::structOfArrays: {
+                            for (int c = 0; c < mData->cardinality; ++c) {
+                                // To compute the start point we need to
+                                // jump the previous cardinalities -> c * sliceSize * (zDim + 2 * haloRadius)
+                                // jump one halo and the previous slices -> sliceSize * (haloRadius + zFirst)
+                                int const startPoint = c * sliceSize * (zDim + 2 * haloRadius) +
+                                                       sliceSize * (haloRadius + zFirst);
+                                int const nElements = sliceSize * zCount;
+
+                                reductionInfo.startIDByView.push_back(startPoint);
+                                reductionInfo.nElementsByView.push_back(nElements);
+                                reductionInfo.firstLeafByView.push_back(c * zGlobalDim + zOrigin + zFirst);
                             }
+                            break;
                         }
+                        case MemoryLayout::arrayOfStructs: {
+                            int const startPoint = sliceSize * (haloRadius + zFirst) * mData->cardinality;
+                            int const nElements = sliceSize * zCount * mData->cardinality;
+
+                            reductionInfo.startIDByView.push_back(startPoint);
+                            reductionInfo.nElementsByView.push_back(nElements);
+                            reductionInfo.firstLeafByView.push_back(zOrigin + zFirst);
+                            break;
+                        }
+                    }
+                };
+
+                switch (mData->memoryOptions.getOrder()) {
+                    case MemoryLayout::structOfArrays: {
+                        reductionInfo.leafSize = sliceSize;
+                        reductionInfo.nLeaves = mData->cardinality * zGlobalDim;
+                        break;
+                    }
+                    case MemoryLayout::arrayOfStructs: {
+                        reductionInfo.leafSize = sliceSize * mData->cardinality;
+                        reductionInfo.nLeaves = zGlobalDim;
+                        break;
+                    }
+                }
+
+                switch (dw) {
+                    case Neon::DataView::STANDARD: {
+                        addSlices(0, zDim);
                         break;
                     }
                     case Neon::DataView::INTERNAL: {
-                        if (grid.getBackend().devSet().setCardinality() > 1) {
-                            switch (mData->memoryOptions.getOrder()) {
-                                case MemoryLayout::structOfArrays: {
-                                    for (int c = 0; c < mData->cardinality; ++c) {
-
-                                        auto const boundaryRadius = mData->zHaloDim;
-                                        int const  startPoint = c * dims[setIdx].x * dims[setIdx].y * (dims[setIdx].z + 2 * haloRadius) +
-                                                               dims[setIdx].x * dims[setIdx].y * (haloRadius + boundaryRadius);
-
-                                        int const nElements = dims[setIdx].x * dims[setIdx].y * (dims[setIdx].z - 2 * haloRadius);
-
-                                        reductionInfo.startIDByView.push_back(startPoint);
-                                        reductionInfo.nElementsByView.push_back(nElements);
-                                    }
-                                    break;
-                                }
-                                case MemoryLayout::arrayOfStructs: {
-                                    auto const boundaryRadius = mData->zHaloDim;
-                                    int const  startPoint = dims[setIdx].x * dims[setIdx].y * (haloRadius + boundaryRadius) * mData->cardinality;
-                                    int const  nElements = dims[setIdx].x * dims[setIdx].y * (dims[setIdx].z - 2 * haloRadius) * mData->cardinality;
-
-                                    reductionInfo.startIDByView.push_back(startPoint);
-                                    reductionInfo.nElementsByView.push_back(nElements);
-
-                                    break;
-                                }
-                            }
-                        }
+                        addSlices(zLower, zDim - zLower - zUpper);
                         break;
                     }
                     case Neon::DataView::BOUNDARY: {
-                        if (grid.getBackend().devSet().setCardinality() > 1) {
-                            switch (mData->memoryOptions.getOrder()) {
-                                case MemoryLayout::structOfArrays: {
-                                    for (int c = 0; c < mData->cardinality; ++c) {
-                                        {  // up
-                                            auto const boundaryRadius = mData->zHaloDim;
-                                            int const  startPoint = c * dims[setIdx].x * dims[setIdx].y * (dims[setIdx].z + 2 * haloRadius) +
-                                                                   dims[setIdx].x * dims[setIdx].y * haloRadius;
-                                            int const nElements = dims[setIdx].x * dims[setIdx].y * boundaryRadius;
-
-                                            reductionInfo.startIDByView.push_back(startPoint);
-                                            reductionInfo.nElementsByView.push_back(nElements);
-                                        }
-
-                                        {  // down
-                                            auto const boundaryRadius = mData->zHaloDim;
-                                            int const  startPoint = c * dims[setIdx].x * dims[setIdx].y * (dims[setIdx].z + 2 * haloRadius) +
-                                                                   dims[setIdx].x * dims[setIdx].y * (dims[setIdx].z + haloRadius - boundaryRadius);
-                                            int const nElements = dims[setIdx].x * dims[setIdx].y * boundaryRadius;
-
-                                            reductionInfo.startIDByView.push_back(startPoint);
-                                            reductionInfo.nElementsByView.push_back(nElements);
-                                        }
-                                    }
-                                    break;
-                                }
-                                case MemoryLayout::arrayOfStructs: {
-                                    {  // up
-                                        auto const boundaryRadius = mData->zHaloDim;
-                                        int const  startPoint = dims[setIdx].x * dims[setIdx].y * haloRadius * mData->cardinality;
-                                        int const  nElements = dims[setIdx].x * dims[setIdx].y * boundaryRadius * mData->cardinality;
-
-                                        reductionInfo.startIDByView.push_back(startPoint);
-                                        reductionInfo.nElementsByView.push_back(nElements);
-                                    }
-                                    {  // down
-                                        auto const boundaryRadius = mData->zHaloDim;
-                                        int const  startPoint = dims[setIdx].x * dims[setIdx].y * (dims[setIdx].z + haloRadius - boundaryRadius) * mData->cardinality;
-                                        int const  nElements = dims[setIdx].x * dims[setIdx].y * boundaryRadius * mData->cardinality;
-
-                                        reductionInfo.startIDByView.push_back(startPoint);
-                                        reductionInfo.nElementsByView.push_back(nElements);
-                                    }
-                                    break;
-                                }
-                            }
-                        }
+                        addSlices(0, zLower);
+                        addSlices(zDim - zUpper, zUpper);
                         break;
                     }
                     default: {
@@ -24,6 +24,7 @@
 #include "Neon/domain/tools/SpanTable.h"
 
 #include "Neon/domain/patterns/PatternScalar.h"
+#include "Neon/domain/tools/ReduceResult.h"
 
 #include "dField.h"
 #include "dPartition.h"
@@ -135,6 +136,53 @@ class dGrid : public Neon::domain::interface::GridBaseTemplate<dGrid, dIndex>
         const
         -> Neon::set::Container;
 
+    /**
+     * Creates a container reducing the values computed on each cell into a PatternScalar.
+     * The compute lambda returned by the loading lambda maps a cell to a value of type T,
+     * values are combined by combineOp (e.g. sum, min, max), starting from identity.
+     */
+    template <Neon::Execution execution = Neon::Execution::device,
+              typename T,
+              typename CombineOp,
+              typename LoadingLambda>
+    auto newReduceContainer(const std::string&               name,
+                            Neon::template PatternScalar<T>& scalar,
+                            T                                identity,
+                            CombineOp                        combineOp,
+                            LoadingLambda                    lambda) const
+        -> Neon::set::Container;
+
+    /**
+     * Creates a container reducing the values computed on each cell into a host variable.
+     * T can be any copyable type, e.g. an array of histogram bins.
+     * The variable must outlive the container.
+     */
+    template <Neon::Execution execution = Neon::Execution::device,
+              typename T,
+              typename CombineOp,
+              typename LoadingLambda>
+    auto newReduceContainer(const std::string& name,
+                            T&                 result,
+                            T                  identity,
+                            CombineOp          combineOp,
+                            LoadingLambda      lambda) const
+        -> Neon::set::Container;
+
+    /**
+     * Creates a container computing several sums in a single traversal of the grid,
+     * e.g. the dot products <r,r>, <r,s> and <s,s> of single-reduction Krylov solvers.
+     * The compute lambda returns a std::array<T, N> whose i-th component is summed into the i-th scalar.
+     * Scalars are passed as a tuple of references, e.g. std::tie(rr, rs, ss).
+     */
+    template <Neon::Execution execution = Neon::Execution::device,
+              typename T,
+              typename... Ts,
+              typename LoadingLambda>
+    auto newSumContainer(const std::string&                                                                 name,
+                         std::tuple<Neon::template PatternScalar<T>&, Neon::template PatternScalar<Ts>&...> scalars,
+                         LoadingLambda                                                                      lambda) const
+        -> Neon::set::Container;
+
     /**
      * Switch for different reduction engines.
      */
@@ -207,6 +255,33 @@ class dGrid : public Neon::domain::interface::GridBaseTemplate<dGrid, dIndex>
     auto helpGetFirstZindex()
         const -> const Neon::set::DataSet<int32_t>&;
 
+    /**
+     * Creates a container computing the sum of input1 * input2 on the host.
+     * When squareRoot is true, the square root of the final result is stored in the scalar.
+     */
+    template <typename T>
+    auto helpHostDot(const std::string&               name,
+                     dField<T>&                       input1,
+                     dField<T>&                       input2,
+                     Neon::template PatternScalar<T>& scalar,
+                     Neon::Execution                  execution,
+                     bool                             squareRoot) const
+        -> Neon::set::Container;
+
+    /**
+     * Deterministic dot product on the cells of a data view.
+     * Each z slice (one per component in the SoA layout) is a leaf summed in a fixed order,
+     * leaves are stored by their global id and the data view result is a pairwise sum of its leaves.
+     * Neither the number of threads nor the partitioning changes the result.
+     */
+    template <typename T>
+    static auto helpDeterministicDot(dField<T>&      input1,
+                                     dField<T>&      input2,
+                                     Neon::Execution execution,
+                                     Neon::DataView  dataView,
+                                     std::vector<T>& leaves)
+        -> T;
+
    private:
     struct Data
     {
@@ -1,4 +1,6 @@
 #pragma once
+#include <algorithm>
+
 #include "dGrid.h"
 
 namespace Neon::domain::details::dGrid {
@@ -85,6 +87,7 @@ dGrid::dGrid(const Neon::Backend&  backend,
             span.mDataView = dw;
             span.mZHaloRadius = setCardinality == 1 ? 0 : mData->halo.z;
             span.mZBoundaryRadius = mData->halo.z;
+            span.mZPartitionDim = mData->partitionDims[setIdx].z;
 
             switch (dw) {
                 case Neon::DataView::STANDARD: {
@@ -250,6 +253,70 @@ auto dGrid::newContainer(const std::string& name,
     return c;
 }
 
+template <Neon::Execution execution,
+          typename T,
+          typename CombineOp,
+          typename LoadingLambda>
+auto dGrid::newReduceContainer(const std::string&               name,
+                              Neon::template PatternScalar<T>& scalar,
+                              T                                identity,
+                              CombineOp                        combineOp,
+                              LoadingLambda                    lambda) const
+    -> Neon::set::Container
+{
+    return Neon::set::Container::factoryReduce<execution>(name,
+                                                          Neon::set::internal::ContainerAPI::DataViewSupport::on,
+                                                          *this,
+                                                          Neon::domain::tool::ReduceResultUtils::newLoadingLambda(lambda, std::tie(scalar)),
+                                                          this->getDefaultBlock(),
+                                                          identity,
+                                                          combineOp,
+                                                          Neon::domain::tool::ReduceResultUtils::newWriter(scalar, combineOp));
+}
+
+template <Neon::Execution execution,
+          typename T,
+          typename CombineOp,
+          typename LoadingLambda>
+auto dGrid::newReduceContainer(const std::string& name,
+                              T&                 result,
+                              T                  identity,
+                              CombineOp          combineOp,
+                              LoadingLambda      lambda) const
+    -> Neon::set::Container
+{
+    return Neon::set::Container::factoryReduce<execution>(name,
+                                                          Neon::set::internal::ContainerAPI::DataViewSupport::on,
+                                                          *this,
+                                                          lambda,
+                                                          this->getDefaultBlock(),
+                                                          identity,
+                                                          combineOp,
+                                                          Neon::domain::tool::ReduceResultUtils::newWriter(result, identity, combineOp));
+}
+
+template <Neon::Execution execution,
+          typename T,
+          typename... Ts,
+          typename LoadingLambda>
+auto dGrid::newSumContainer(const std::string&                                                                 name,
+                           std::tuple<Neon::template PatternScalar<T>&, Neon::template PatternScalar<Ts>&...> scalars,
+                           LoadingLambda                                                                      lambda) const
+    -> Neon::set::Container
+{
+    static_assert((std::is_same_v<T, Ts> && ...), "Fused sums require scalars of the same type");
+    using Sum = Neon::domain::tool::ReduceResultUtils::ArraySum<T, 1 + sizeof...(Ts)>;
+
+    return Neon::set::Container::factoryReduce<execution>(name,
+                                                          Neon::set::internal::ContainerAPI::DataViewSupport::on,
+                                                          *this,
+                                                          Neon::domain::tool::ReduceResultUtils::newLoadingLambda(lambda, scalars),
+                                                          this->getDefaultBlock(),
+                                                          std::array<T, 1 + sizeof...(Ts)>{},
+                                                          Sum(),
+                                                          Neon::domain::tool::ReduceResultUtils::newSumWriter<T>(scalars));
+}
+
 template <typename T>
 auto dGrid::newPatternScalar() const -> Neon::template PatternScalar<T>
 {
@@ -272,21 +339,170 @@ auto dGrid::newPatternScalar() const -> Neon::template PatternScalar<T>
 }
 
 template <typename T>
-auto dGrid::dot([[maybe_unused]] const std::string&               name,
-                [[maybe_unused]] dField<T>&                       input1,
-                [[maybe_unused]] dField<T>&                       input2,
-                [[maybe_unused]] Neon::template PatternScalar<T>& scalar) const -> Neon::set::Container
+auto dGrid::dot(const std::string&               name,
+                dField<T>&                       input1,
+                dField<T>&                       input2,
+                Neon::template PatternScalar<T>& scalar) const -> Neon::set::Container
 {
-    NEON_DEV_UNDER_CONSTRUCTION("");
+    return helpHostDot(name, input1, input2, scalar, Neon::Execution::device, false);
 }
 
 template <typename T>
-auto dGrid::norm2([[maybe_unused]] const std::string&               name,
-                  [[maybe_unused]] dField<T>&                       input,
-                  [[maybe_unused]] Neon::template PatternScalar<T>& scalar,
-                  [[maybe_unused]] Neon::Execution                  execution) const -> Neon::set::Container
+auto dGrid::norm2(const std::string&               name,
+                  dField<T>&                       input,
+                  Neon::template PatternScalar<T>& scalar,
+                  Neon::Execution                  execution) const -> Neon::set::Container
 {
-    NEON_DEV_UNDER_CONSTRUCTION("");
+    return helpHostDot(name, input, input, scalar, execution, true);
+}
+
+template <typename T>
+auto dGrid::helpHostDot(const std::string&               name,
+                        dField<T>&                       input1,
+                        dField<T>&                       input2,
+                        Neon::template PatternScalar<T>& scalar,
+                        Neon::Execution                  execution,
+                        bool                             squareRoot) const -> Neon::set::Container
+{
+    if (execution == Neon::Execution::device && getBackend().runtime() != Neon::Runtime::openmp) {
+        NeonException exc("dGrid");
+        exc << "Reductions on device are only supported by the openmp runtime";
+        NEON_THROW(exc);
+    }
+    if (input1.mData->memoryOptions.getOrder() != input2.mData->memoryOptions.getOrder() ||
+        input1.mData->cardinality != input2.mData->cardinality) {
+        NeonException exc("dGrid");
+        exc << "Reductions require fields with the same cardinality and memory layout";
+        NEON_THROW(exc);
+    }
+
+    // Leaves of the deterministic mode, shared by the INTERNAL and BOUNDARY runs
+    auto leaves = std::make_shared<std::vector<T>>();
+
+    return Neon::set::Container::factoryOldManaged(
+        name,
+        Neon::set::internal::ContainerAPI::DataViewSupport::on,
+        Neon::set::ContainerPatternType::reduction,
+        *this,
+        [input1, input2, &scalar, execution, squareRoot, leaves](Neon::set::Loader& loader) {
+            loader.load(input1.constSelf(), Neon::Pattern::REDUCE);
+            if (input1.getUid() != input2.getUid()) {
+                loader.load(input2.constSelf(), Neon::Pattern::REDUCE);
+            }
+            loader.load(scalar);
+
+            return [input1, input2, &scalar, execution, squareRoot, leaves](int /*streamIdx*/, Neon::DataView dataView) mutable {
+                if (scalar.getReductionMode() == Neon::ReductionMode::deterministic) {
+                    scalar(dataView) = helpDeterministicDot(input1, input2, execution, dataView, *leaves);
+                    // The result is always the pairwise sum of all the leaves,
+                    // so OCC does not change it either
+                    if (dataView != Neon::DataView::INTERNAL) {
+                        const T total = Neon::ReductionModeUtils::pairwiseSum(leaves->data(), leaves->size());
+                        scalar() = squareRoot ? std::sqrt(total) : total;
+                    }
+                    return;
+                }
+
+                const int nPartitions = input1.getBackend().devSet().setCardinality();
+                auto&     partitionResults = scalar.getTempMemory(dataView, Neon::DeviceType::CPU);
+
+                for (int setIdx = 0; setIdx < nPartitions; setIdx++) {
+                    // Ranges of the partition memory covered by the data view
+                    const auto& info = input1.mData->partitionTable.getUserData(execution, setIdx, dataView);
+                    const T*    a = input1.getPartition(execution, setIdx, dataView).mem();
+                    const T*    b = input2.getPartition(execution, setIdx, dataView).mem();
+
+                    T partitionResult = 0;
+                    for (size_t r = 0; r < info.startIDByView.size(); r++) {
+                        const T*  aRange = a + info.startIDByView[r];
+                        const T*  bRange = b + info.startIDByView[r];
+                        const int nElements = info.nElementsByView[r];
+                        T         rangeResult = 0;
+#pragma omp parallel for reduction(+ : rangeResult) schedule(static)
+                        for (int i = 0; i < nElements; i++) {
+                            rangeResult += aRange[i] * bRange[i];
+                        }
+                        partitionResult += rangeResult;
+                    }
+                    partitionResults.elRef(setIdx, 0, 0) = partitionResult;
+                }
+
+                T result = 0;
+                for (int setIdx = 0; setIdx < nPartitions; setIdx++) {
+                    result += partitionResults.elRef(setIdx, 0, 0);
+                }
+                scalar(dataView) = result;
+
+                // Under OCC, the BOUNDARY reduction runs after the INTERNAL one and completes the result
+                if (dataView != Neon::DataView::INTERNAL) {
+                    const T total = dataView == Neon::DataView::BOUNDARY
+                                        ? scalar(Neon::DataView::INTERNAL) + result
+                                        : result;
+                    scalar() = squareRoot ? std::sqrt(total) : total;
+                }
+            };
+        });
+}
+
+template <typename T>
+auto dGrid::helpDeterministicDot(dField<T>&      input1,
+                                 dField<T>&      input2,
+                                 Neon::Execution execution,
+                                 Neon::DataView  dataView,
+                                 std::vector<T>& leaves)
+    -> T
+{
+    struct Leaf
+    {
+        int      id;
+        const T* a;
+        const T* b;
+    };
+
+    const int         nPartitions = input1.getBackend().devSet().setCardinality();
+    int               leafSize = 0;
+    std::vector<Leaf> viewLeaves;
+    for (int setIdx = 0; setIdx < nPartitions; setIdx++) {
+        const auto& info = input1.mData->partitionTable.getUserData(execution, setIdx, dataView);
+        const T*    a = input1.getPartition(execution, setIdx, dataView).mem();
+        const T*    b = input2.getPartition(execution, setIdx, dataView).mem();
+
+        leafSize = info.leafSize;
+        if (leaves.size() != size_t(info.nLeaves)) {
+            leaves.assign(info.nLeaves, T(0));
+        }
+        for (size_t r = 0; r < info.startIDByView.size(); r++) {
+            const int nRangeLeaves = info.nElementsByView[r] / info.leafSize;
+            for (int l = 0; l < nRangeLeaves; l++) {
+                const int offset = info.startIDByView[r] + l * info.leafSize;
+                viewLeaves.push_back({info.firstLeafByView[r] + l, a + offset, b + offset});
+            }
+        }
+    }
+    std::sort(viewLeaves.begin(), viewLeaves.end(), [](const Leaf& x, const Leaf& y) { return x.id < y.id; });
+
+    // Each leaf is summed by a single thread over a fixed number of lanes,
+    // which keeps the inner loop vectorizable without changing the order of the sums
+    constexpr int  nLanes = 8;
+    std::vector<T> viewResults(viewLeaves.size());
+#pragma omp parallel for schedule(static)
+    for (int l = 0; l < int(viewLeaves.size()); l++) {
+        const T* a = viewLeaves[l].a;
+        const T* b = viewLeaves[l].b;
+        T        lanes[nLanes] = {};
+        int      i = 0;
+        for (; i + nLanes <= leafSize; i += nLanes) {
+            for (int lane = 0; lane < nLanes; lane++) {
+                lanes[lane] += a[i + lane] * b[i + lane];
+            }
+        }
+        for (; i < leafSize; i++) {
+            lanes[i % nLanes] += a[i] * b[i];
+        }
+        viewResults[l] = Neon::ReductionModeUtils::pairwiseSum(lanes, nLanes);
+        leaves[viewLeaves[l].id] = viewResults[l];
+    }
+    return Neon::ReductionModeUtils::pairwiseSum(viewResults.data(), viewResults.size());
 }
 
 }  // namespace Neon::domain::details::dGrid
\ No newline at end of file
@@ -206,6 +206,26 @@ class dPartition
         return res;
     }
 
+    /**
+     * Write a value to a neighbour. Nothing is written if the neighbour is not valid.
+     * A value written to a halo cell is not sent back to the partition that owns it.
+     * @return Whether the neighbour is valid
+     */
+    template <int xOff, int yOff, int zOff>
+    NEON_CUDA_HOST_DEVICE inline auto
+    writeNghData(const Idx& eId,
+                 int        card,
+                 const T&   value)
+        -> bool
+    {
+        Idx        cellNgh;
+        const bool isValidNeighbour = nghIdx<xOff, yOff, zOff>(eId, cellNgh);
+        if (isValidNeighbour) {
+            operator()(cellNgh, card) = value;
+        }
+        return isValidNeighbour;
+    }
+
     NEON_CUDA_HOST_DEVICE inline auto
     nghVal(const Idx& eId,
            uint8_t    nghID,
@@ -46,6 +46,7 @@ class dSpan
     int            mZHaloRadius;
     int            mZBoundaryRadius;
     Neon::index_3d mDim /** Dimension of the span, its values depends on the mDataView*/;
+    int            mZPartitionDim /** Size of the partition along z, used to locate the upper boundary */;
 };
 
 }  // namespace Neon::domain::details::dGrid
@@ -29,9 +29,11 @@ dSpan::setAndValidate(Idx&            idx,
         }
         case Neon::DataView::BOUNDARY: {
 
+            // The first zBoundaryRadius slices are the lower boundary,
+            // the next ones are mapped to the last zBoundaryRadius slices of the partition
             idx.set().z += idx.get().z < mZBoundaryRadius
                                ? 0
-                               : (mDim.z - 1) + (-1 * mZBoundaryRadius /* we remove zBoundaryRadius as the first zBoundaryRadius will manage the lower slices */);
+                               : mZPartitionDim - 2 * mZBoundaryRadius;
             idx.set().z += mZHaloRadius;
 
             return res;
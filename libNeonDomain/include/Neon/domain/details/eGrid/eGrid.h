@@ -25,6 +25,7 @@
 #include "Neon/domain/tools/SpanTable.h"
 
 #include "Neon/domain/patterns/PatternScalar.h"
+#include "Neon/domain/tools/ReduceResult.h"
 
 #include "eField.h"
 #include "ePartition.h"
@@ -141,6 +142,53 @@ class eGrid : public Neon::domain::interface::GridBaseTemplate<eGrid, eIndex>
         const
         -> Neon::set::Container;
 
+    /**
+     * Creates a container reducing the values computed on each cell into a PatternScalar.
+     * The compute lambda returned by the loading lambda maps a cell to a value of type T,
+     * values are combined by combineOp (e.g. sum, min, max), starting from identity.
+     */
+    template <Neon::Execution execution = Neon::Execution::device,
+              typename T,
+              typename CombineOp,
+              typename LoadingLambda>
+    auto newReduceContainer(const std::string&               name,
+                            Neon::template PatternScalar<T>& scalar,
+                            T                                identity,
+                            CombineOp                        combineOp,
+                            LoadingLambda                    lambda) const
+        -> Neon::set::Container;
+
+    /**
+     * Creates a container reducing the values computed on each cell into a host variable.
+     * T can be any copyable type, e.g. an array of histogram bins.
+     * The variable must outlive the container.
+     */
+    template <Neon::Execution execution = Neon::Execution::device,
+              typename T,
+              typename CombineOp,
+              typename LoadingLambda>
+    auto newReduceContainer(const std::string& name,
+                            T&                 result,
+                            T                  identity,
+                            CombineOp          combineOp,
+                            LoadingLambda      lambda) const
+        -> Neon::set::Container;
+
+    /**
+     * Creates a container computing several sums in a single traversal of the grid,
+     * e.g. the dot products <r,r>, <r,s> and <s,s> of single-reduction Krylov solvers.
+     * The compute lambda returns a std::array<T, N> whose i-th component is summed into the i-th scalar.
+     * Scalars are passed as a tuple of references, e.g. std::tie(rr, rs, ss).
+     */
+    template <Neon::Execution execution = Neon::Execution::device,
+              typename T,
+              typename... Ts,
+              typename LoadingLambda>
+    auto newSumContainer(const std::string&                                                                 name,
+                         std::tuple<Neon::template PatternScalar<T>&, Neon::template PatternScalar<Ts>&...> scalars,
+                         LoadingLambda                                                                      lambda) const
+        -> Neon::set::Container;
+
     /**
      * Convert a 3d index into a SetId and eGrid::Index
      * The returned SetIdx component is set to invalid if the user provided idx is not active
@@ -227,6 +275,19 @@ class eGrid : public Neon::domain::interface::GridBaseTemplate<eGrid, eIndex>
     auto getPartitioner()
         -> const tool::Partitioner1D&;
 
+    /**
+     * Creates a reduction container computing the sum of input1 * input2 over the active elements.
+     * When squareRoot is true, the square root of the final result is stored in the scalar.
+     */
+    template <typename T>
+    auto helpDot(const std::string&               name,
+                 eField<T>&                       input1,
+                 eField<T>&                       input2,
+                 Neon::template PatternScalar<T>& scalar,
+                 Neon::Execution                  execution,
+                 bool                             squareRoot) const
+        -> Neon::set::Container;
+
    private:
     struct Data
     {
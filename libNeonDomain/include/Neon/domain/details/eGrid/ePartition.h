@@ -188,6 +188,18 @@ class ePartition
                int card,
                T defaultValue)
         const -> NghData;
+
+    /**
+     * Write a value to a neighbour. Nothing is written if the neighbour is not valid.
+     * A value written to a halo element is not sent back to the partition that owns it.
+     * @return Whether the neighbour is valid
+     */
+    template <int xOff, int yOff, int zOff>
+    NEON_CUDA_HOST_DEVICE inline auto
+    writeNghData(Idx      eId,
+                 int      card,
+                 const T& value)
+        -> bool;
     /**
      * Check is the
      * @tparam dataView_ta
@@ -124,6 +124,27 @@ ePartition<T, C>::getNghData(eIndex               eId,
     return res;
 }
 
+template <typename T,
+          int C>
+template <int xOff, int yOff, int zOff>
+NEON_CUDA_HOST_DEVICE inline auto
+ePartition<T, C>::writeNghData(eIndex   eId,
+                               int      card,
+                               const T& value)
+    -> bool
+{
+    int tablePithc = (xOff + mStencilRadius) +
+                     (yOff + mStencilRadius) * mStencilTableYPitch +
+                     (zOff + mStencilRadius) * mStencilTableYPitch * mStencilTableYPitch;
+    NghIdx     nghIdx = mStencil3dTo1dOffset[tablePithc];
+    eIndex     eIdxNgh;
+    const bool isValidNeighbour = isValidNgh(eId, nghIdx, eIdxNgh);
+    if (isValidNeighbour) {
+        this->operator()(eIdxNgh, card) = value;
+    }
+    return isValidNeighbour;
+}
+
 template <typename T,
           int C>
 NEON_CUDA_HOST_DEVICE inline auto
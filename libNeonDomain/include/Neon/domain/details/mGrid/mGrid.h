@@ -137,6 +137,33 @@ class mGrid
                       int                level,
                       LoadingLambda      lambda) const -> Neon::set::Container;
 
+    /**
+     * Build a new grid whose refinement follows the flags set by a user criterion on this grid. The flags are read on the
+     * host at the leaf voxels of each level (the active voxels that are not refined), so the criterion container should be
+     * followed by flags.updateHostData() and a sync before calling adapt. The caller decides how often to regrid, e.g., every N steps.
+     * A leaf voxel flagged with a positive value is refined i.e., its children at level - 1 become leaves.
+     * A negative value asks for coarsening which only happens when all the siblings are leaves flagged negative as well,
+     * in which case their parent at level + 1 becomes a leaf.
+     * The strong balance and overlap culling of this grid are imposed on the new sparsity pattern. Levels whose
+     * sparsity pattern does not change share their internal grid with this one, only the other levels are rebuilt.
+     * Fields are moved to the new grid with migrateField.
+     * @param flags cardinality 1 field defined on this grid: > 0 refine, < 0 coarsen, 0 keep
+     * @return the regridded multi-resolution grid
+    */
+    auto adapt(const Field<int8_t>& flags) const -> mGrid;
+
+    /**
+     * Create a field on this grid that holds the data of a field defined on another grid of the same domain and descriptor,
+     * typically the grid this one was adapted from. This is done on the host so the source field should be up-to-date on the host.
+     * The new field is then moved to the device on stream 0, so it is ready for any container that runs on that stream.
+     * Voxels present on both grids keep their value.
+     * New fine voxels take the value of their closest coarser ancestor in the source grid (explosion) and new coarse
+     * voxels take the average of their children in the source grid (coalescence).
+     * @param field the source field
+    */
+    template <typename T, int C = 0>
+    auto migrateField(const Field<T, C>& field) const -> Field<T, C>;
+
     auto getParentsBlockID(int level) const -> Neon::set::MemSet<uint32_t>&;
     auto getChildBlockID(int level) const -> const Neon::set::MemSet<uint32_t>&;
 
@@ -176,6 +203,15 @@ class mGrid
 
 
    private:
+    struct Data;
+
+    //set the bitmask of all levels from the activation functions then impose overlap culling and strong balance
+    auto helpBuildBitMask(const std::vector<std::function<bool(const Neon::index_3d&)>>& activeCellLambda) -> void;
+
+    //build the grid of each level from the bitmask along with the parent/child connectivity.
+    //Levels with the same bitmask as in previous reuse its grid
+    auto helpBuildLevels(const Data* previous) -> void;
+
     //check if the bitmask is set assuming a dense domain
     auto levelBitMaskIndex(int l, const Neon::index_3d& blockID, const Neon::index_3d& localChild) const -> std::pair<int, int>;
 
@@ -222,6 +258,11 @@ class mGrid
         std::vector<InternalGrid> grids;
 
         Neon::Backend backend;
+
+        //kept to rebuild the levels when the grid is adapted
+        Neon::domain::Stencil stencil;
+        double_3d             spacingData;
+        double_3d             origin;
     };
     std::shared_ptr<Data> mData;
 };
@@ -38,4 +38,78 @@ auto mGrid::newContainer(const std::string& name,
 
     return kContainer;
 }
+
+template <typename T, int C>
+auto mGrid::migrateField(const Field<T, C>& field) const -> Field<T, C>
+{
+    const mGrid& src = *(field.mData->grid);
+    const int    depth = mData->mDescriptor.getDepth();
+
+    if (src.getDimension() != getDimension() || src.getDescriptor().getDepth() != depth) {
+        NeonException exp("mGrid::migrateField");
+        exp << "The field should be defined on a grid with the same domain size and depth";
+        NEON_THROW(exp);
+    }
+
+    const auto& srcLevel0 = field(0);
+
+    Field<T, C> ret = newField<T, C>(srcLevel0.getName(),
+                                     srcLevel0.getCardinality(),
+                                     srcLevel0.getOutsideValue(),
+                                     srcLevel0.getDataUse(),
+                                     srcLevel0.getMemoryOptions());
+
+    const T outsideVal = srcLevel0.getOutsideValue();
+
+    for (int l = 0; l < depth; ++l) {
+        ret.forEachActiveCell(
+            l,
+            [&](const Neon::index_3d& voxel, const int& card, T& val) {
+                //the voxel was there before the regrid
+                if (src.isInsideDomain(voxel, l)) {
+                    val = field(voxel, card, l);
+                    return;
+                }
+
+                //explosion: a new fine voxel takes the value of its closest coarser ancestor
+                for (int a = l + 1; a < depth; ++a) {
+                    const Neon::index_3d ancestor = getOriginBlock3DIndex(voxel, a - 1);
+                    if (src.isInsideDomain(ancestor, a)) {
+                        val = field(ancestor, card, a);
+                        return;
+                    }
+                }
+
+                //coalescence: a new coarse voxel takes the average of its children
+                if (l > 0) {
+                    const int refFactor = mData->mDescriptor.getRefFactor(l - 1);
+                    T         sum = 0;
+                    int       count = 0;
+                    for (int z = 0; z < refFactor; z++) {
+                        for (int y = 0; y < refFactor; y++) {
+                            for (int x = 0; x < refFactor; x++) {
+                                const Neon::index_3d child = mData->mDescriptor.parentToChild(voxel, l - 1, {x, y, z});
+                                if (child < mData->domainSize && src.isInsideDomain(child, l - 1)) {
+                                    sum += field(child, card, l - 1);
+                                    count++;
+                                }
+                            }
+                        }
+                    }
+                    if (count > 0) {
+                        val = sum / T(count);
+                        return;
+                    }
+                }
+
+                val = outsideVal;
+            },
+            false,
+            Neon::computeMode_t::computeMode_e::seq);
+    }
+
+    ret.updateDeviceData(0);
+
+    return ret;
+}
 }  // namespace Neon::domain::details::mGrid
@@ -3,15 +3,28 @@
 #include "Neon/set/MultiXpuDataInterface.h"
 #include "Neon/set/patterns/BlasSet.h"
 
+#include "Neon/domain/patterns/PatternScalarPartition.h"
+#include "Neon/domain/patterns/ReductionMode.h"
+
 namespace Neon {
 
+/**
+ * Result of a grid reduction (e.g. dot or norm2).
+ *
+ * Copies of a PatternScalar share the result.
+ * Containers can load the scalar: reductions load it for writing and other Containers load it
+ * as a const object to read the result in their compute lambdas (see PatternScalarPartition),
+ * so that the dependencies between them are tracked like the ones between fields.
+ * On CUDA backends the result lives in page-locked host memory, which the GPUs read directly,
+ * so compute lambdas can read it on any device.
+ */
 template <typename T>
 class PatternScalar
-    : public set::interface::MultiXpuDataInterface<PatternScalar<T>, int>
+    : public set::interface::MultiXpuDataInterface<PatternScalarPartition<T>, int>
 {
 
    public:
-    using Partition = PatternScalar<T>;
+    using Partition = PatternScalarPartition<T>;
 
     PatternScalar() = default;
 
@@ -83,6 +96,14 @@ class PatternScalar
 
     auto getName() const -> std::string;
 
+    /**
+     * Select how the grid reductions writing into this scalar combine their partial results.
+     * The default is Neon::ReductionMode::fast.
+     */
+    auto setReductionMode(Neon::ReductionMode mode) -> void;
+
+    auto getReductionMode() const -> Neon::ReductionMode;
+
    private:
     auto updateHostData(int streamId = 0)
         -> void final;
@@ -92,6 +113,14 @@ class PatternScalar
 
     struct Data
     {
+        // Boundary, internal and standard results (page-locked on CUDA backends)
+        Neon::set::MemDevSet<T> results;
+        T*                      boundaryResult = nullptr;
+        T*                      internalResult = nullptr;
+        T*                      standardResult = nullptr;
+        // View of standardResult: the complete result is what Containers read, whatever their data view
+        Partition partition;
+
         // Temp memory needed for cublas/cub to do reduction on boundary, internal, and standard data view
         Neon::set::MemDevSet<T>         hostTempBoundary;
         Neon::set::MemDevSet<T>         hostTempInternal;
@@ -104,12 +133,9 @@ class PatternScalar
         Neon::set::patterns::BlasSet<T> blasSetStandard;
         Neon::DeviceType                devType;
         Neon::Backend                   backend;
+        Neon::ReductionMode             reductionMode = Neon::ReductionMode::fast;
     };
     std::shared_ptr<Data> mData;
-
-    T boundaryResult;
-    T internalResult;
-    T standardResult;
 };
 
 
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Neon/core/core.h"
+
+namespace Neon {
+
+/**
+ * Partition of a PatternScalar, i.e. what a Container gets when it loads the scalar.
+ *
+ * It is a view of the complete result of the scalar: a compute lambda reads the value
+ * the scalar holds when the lambda runs, not the one it held when the lambda was loaded.
+ */
+template <typename T>
+class PatternScalarPartition
+{
+   public:
+    using Type = T;
+
+    PatternScalarPartition() = default;
+
+    explicit PatternScalarPartition(T* result)
+        : mResult(result)
+    {
+    }
+
+    /**
+     * Accessing the result of the pattern
+     */
+    NEON_CUDA_HOST_DEVICE inline auto operator()() const -> const T&
+    {
+        return *mResult;
+    }
+
+   private:
+    T* mResult = nullptr;
+};
+
+}  // namespace Neon
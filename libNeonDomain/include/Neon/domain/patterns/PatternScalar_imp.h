@@ -1,4 +1,6 @@
 #pragma once
+#include <algorithm>
+
 #include "Neon/domain/patterns/PatternScalar.h"
 #include "Neon/set/DevSet.h"
 #include "Neon/set/patterns/BlasSet.h"
@@ -16,13 +18,27 @@ PatternScalar<T>::PatternScalar(Neon::Backend               backend,
     mData->blasSetStandard = Neon::set::patterns::BlasSet<T>(mData->backend.devSet(), engine);
     mData->devType = backend.devType();
 
+    // Pinned memory requires a GPU, which a CPU backend may not have
+    const Neon::Allocator hostAllocator = mData->devType == Neon::DeviceType::CUDA
+                                              ? Neon::Allocator::CUDA_MEM_HOST
+                                              : Neon::Allocator::MALLOC;
     mData->hostTempBoundary = backend.devSet().template newMemDevSet<T>(Neon::DeviceType::CPU,
-                                                                        Neon::Allocator::CUDA_MEM_HOST, 1);
+                                                                        hostAllocator, 1);
     mData->hostTempInternal = backend.devSet().template newMemDevSet<T>(Neon::DeviceType::CPU,
-                                                                        Neon::Allocator::CUDA_MEM_HOST, 1);
+                                                                        hostAllocator, 1);
     mData->hostTempStandard = backend.devSet().template newMemDevSet<T>(Neon::DeviceType::CPU,
-                                                                        Neon::Allocator::CUDA_MEM_HOST, 1);
-    if (engine == Neon::sys::patterns::Engine::CUB) {
+                                                                        hostAllocator, 1);
+
+    // The results are stored once, in the memory of the first partition
+    mData->results = backend.devSet().template newMemDevSet<T>(Neon::DeviceType::CPU,
+                                                               hostAllocator, 3);
+    T* results = mData->results.getMemDev(0).mem();
+    mData->boundaryResult = results;
+    mData->internalResult = results + 1;
+    mData->standardResult = results + 2;
+    std::fill(results, results + 3, T(0));
+    mData->partition = Partition(mData->standardResult);
+    if (engine == Neon::sys::patterns::Engine::CUB && mData->devType == Neon::DeviceType::CUDA) {
         mData->deviceTempBoundary = backend.devSet().template newMemDevSet<T>(Neon::DeviceType::CUDA,
                                                                               Neon::Allocator::CUDA_MEM_DEVICE, 1);
         mData->deviceTempInternal = backend.devSet().template newMemDevSet<T>(Neon::DeviceType::CUDA,
@@ -35,13 +51,13 @@ PatternScalar<T>::PatternScalar(Neon::Backend               backend,
 template <typename T>
 auto PatternScalar<T>::operator()() -> T&
 {
-    return standardResult;
+    return *mData->standardResult;
 }
 
 template <typename T>
 auto PatternScalar<T>::operator()() const -> const T&
 {
-    return standardResult;
+    return *mData->standardResult;
 }
 
 template <typename T>
@@ -58,7 +74,7 @@ auto PatternScalar<T>::getPartition(
     [[maybe_unused]] const Neon::SetIdx&     idx,
     [[maybe_unused]] const Neon::DataView&   dataView) const -> const Partition&
 {
-    return *this;
+    return mData->partition;
 }
 
 template <typename T>
@@ -66,7 +82,7 @@ auto PatternScalar<T>::getPartition([[maybe_unused]] const DeviceType& devType,
                                     [[maybe_unused]] const SetIdx&     idx,
                                     [[maybe_unused]] const DataView&   dataView) -> PatternScalar::Partition&
 {
-    return *this;
+    return mData->partition;
 }
 
 template <typename T>
@@ -74,7 +90,7 @@ auto PatternScalar<T>::getPartition([[maybe_unused]] Neon::Execution execution,
                                     [[maybe_unused]] Neon::SetIdx    setIdx,
                                     [[maybe_unused]] const DataView& dataView) const -> const PatternScalar::Partition&
 {
-    return *this;
+    return mData->partition;
 }
 
 template <typename T>
@@ -94,20 +110,20 @@ auto PatternScalar<T>::getPartition([[maybe_unused]] Neon::Execution execution,
                                     [[maybe_unused]] const DataView& dataView)
     -> PatternScalar::Partition&
 {
-    return *this;
+    return mData->partition;
 }
 
 template <typename T>
 auto PatternScalar<T>::operator()(const Neon::DataView& dataView) -> T&
 {
     if (dataView == Neon::DataView::STANDARD) {
-        return standardResult;
+        return *mData->standardResult;
 
     } else if (dataView == Neon::DataView::INTERNAL) {
-        return internalResult;
+        return *mData->internalResult;
 
     } else if (dataView == Neon::DataView::BOUNDARY) {
-        return boundaryResult;
+        return *mData->boundaryResult;
     } else {
         NeonException exc("PatternScalar::PatternScalar");
         exc << "Unsupported dataView " << Neon::DataViewUtil::toString(dataView);
@@ -195,6 +211,18 @@ auto PatternScalar<T>::getName() const -> std::string
     return "PatternScalar";
 }
 
+template <typename T>
+auto PatternScalar<T>::setReductionMode(Neon::ReductionMode mode) -> void
+{
+    mData->reductionMode = mode;
+}
+
+template <typename T>
+auto PatternScalar<T>::getReductionMode() const -> Neon::ReductionMode
+{
+    return mData->reductionMode;
+}
+
 extern template class PatternScalar<float>;
 extern template class PatternScalar<double>;
 
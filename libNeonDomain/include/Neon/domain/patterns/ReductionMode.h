@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace Neon {
+
+/**
+ * How the partial results of a reduction (e.g. dot and norm2) are combined
+ */
+enum struct ReductionMode
+{
+    fast = 0 /**< Partial results are combined in scheduling order, which depends on the number of threads and partitions */,
+    deterministic = 1 /**< Bitwise identical results for any number of threads and partitions */
+};
+
+struct ReductionModeUtils
+{
+    /**
+     * Safely convert a ReductionMode to string
+     */
+    static auto toString(Neon::ReductionMode option) -> const char*;
+
+    /**
+     * Sum of n values with a pairwise tree whose shape depends only on n.
+     * The result is bitwise reproducible as long as the values and their order are.
+     */
+    template <typename T>
+    static auto pairwiseSum(const T* values, size_t n) -> T
+    {
+        if (n <= 4) {
+            T result = 0;
+            for (size_t i = 0; i < n; i++) {
+                result += values[i];
+            }
+            return result;
+        }
+        const size_t half = n / 2;
+        return pairwiseSum(values, half) + pairwiseSum(values + half, n - half);
+    }
+};
+
+std::ostream& operator<<(std::ostream& os, Neon::ReductionMode const& m);
+
+}  // namespace Neon
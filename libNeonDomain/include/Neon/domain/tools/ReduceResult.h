@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <tuple>
+
+#include "Neon/core/types/DataView.h"
+#include "Neon/domain/patterns/PatternScalar.h"
+#include "Neon/set/container/Loader.h"
+
+namespace Neon::domain::tool {
+
+/**
+ * Helpers to store the results of a reduction Container (see Neon::set::Container::factoryReduce).
+ *
+ * Under OCC a reduction is split in an INTERNAL and a BOUNDARY Container, the latter running after the former.
+ * The writers keep the INTERNAL result and combine it with the BOUNDARY one to complete the reduction.
+ */
+struct ReduceResultUtils
+{
+    /**
+     * Writer storing the result of each data view in a PatternScalar.
+     * The complete result is accessible through scalar().
+     */
+    template <typename T, typename CombineOp>
+    static auto newWriter(Neon::template PatternScalar<T>& scalar,
+                          CombineOp                        combineOp)
+        -> std::function<void(Neon::DataView, const T&)>
+    {
+        return [&scalar, combineOp](Neon::DataView dataView, const T& result) {
+            scalar(dataView) = result;
+            if (dataView == Neon::DataView::BOUNDARY) {
+                scalar() = combineOp(scalar(Neon::DataView::INTERNAL), result);
+            }
+        };
+    }
+
+    /**
+     * Writer storing the result of each data view in a PatternScalar,
+     * the complete result being transformed by finalOp (e.g. the square root of a norm).
+     */
+    template <typename T, typename CombineOp, typename FinalOp>
+    static auto newWriter(Neon::template PatternScalar<T>& scalar,
+                          CombineOp                        combineOp,
+                          FinalOp                          finalOp)
+        -> std::function<void(Neon::DataView, const T&)>
+    {
+        return [&scalar, combineOp, finalOp](Neon::DataView dataView, const T& result) {
+            scalar(dataView) = result;
+            if (dataView != Neon::DataView::INTERNAL) {
+                const T total = dataView == Neon::DataView::BOUNDARY
+                                    ? combineOp(scalar(Neon::DataView::INTERNAL), result)
+                                    : result;
+                scalar() = finalOp(total);
+            }
+        };
+    }
+
+    /**
+     * Writer storing the complete result in a host variable, which must outlive the Container.
+     */
+    template <typename T, typename CombineOp>
+    static auto newWriter(T&        result,
+                          const T&  identity,
+                          CombineOp combineOp)
+        -> std::function<void(Neon::DataView, const T&)>
+    {
+        auto internalResult = std::make_shared<T>(identity);
+        return [&result, internalResult, combineOp](Neon::DataView dataView, const T& viewResult) {
+            if (dataView == Neon::DataView::INTERNAL) {
+                *internalResult = viewResult;
+                return;
+            }
+            result = dataView == Neon::DataView::BOUNDARY
+                         ? combineOp(*internalResult, viewResult)
+                         : viewResult;
+        };
+    }
+
+    /**
+     * Loading lambda of a reduction that also loads the scalars the reduction writes,
+     * so that the Containers reading one of these scalars depend on the reduction.
+     */
+    template <typename LoadingLambda, typename... Scalars>
+    static auto newLoadingLambda(LoadingLambda           lambda,
+                                 std::tuple<Scalars&...> scalars)
+    {
+        return [lambda, scalars](Neon::set::Loader& loader) {
+            std::apply([&](auto&... scalar) {
+                (loader.load(scalar), ...);
+            },
+                       scalars);
+            return lambda(loader);
+        };
+    }
+
+    /**
+     * Element-wise sum of arrays, it is the combine operation of fused sums
+     */
+    template <typename T, size_t N>
+    struct ArraySum
+    {
+        auto operator()(const std::array<T, N>& a,
+                        const std::array<T, N>& b) const
+            -> std::array<T, N>
+        {
+            std::array<T, N> c;
+            for (size_t i = 0; i < N; i++) {
+                c[i] = a[i] + b[i];
+            }
+            return c;
+        }
+    };
+
+    /**
+     * Writer storing the i-th component of the results of a fused sum in the i-th PatternScalar.
+     */
+    template <typename T, typename... Scalars>
+    static auto newSumWriter(std::tuple<Scalars&...> scalars)
+        -> std::function<void(Neon::DataView, const std::array<T, sizeof...(Scalars)>&)>
+    {
+        return [scalars](Neon::DataView dataView, const std::array<T, sizeof...(Scalars)>& result) mutable {
+            size_t i = 0;
+            std::apply([&](auto&... scalar) {
+                (helpWriteSum(scalar, dataView, result[i++]), ...);
+            },
+                       scalars);
+        };
+    }
+
+   private:
+    template <typename T>
+    static auto helpWriteSum(Neon::template PatternScalar<T>& scalar,
+                             Neon::DataView                   dataView,
+                             const T&                         result)
+        -> void
+    {
+        scalar(dataView) = result;
+        if (dataView == Neon::DataView::BOUNDARY) {
+            scalar() = scalar(Neon::DataView::INTERNAL) + result;
+        }
+    }
+};
+
+}  // namespace Neon::domain::tool
@@ -15,7 +15,9 @@ dGrid::Data::Data(const Neon::Backend& backend)
     elementsPerPartition = Neon::domain::tool::SpanTable<int>(backend);
 
     halo = index_3d(0, 0, 0);
-    reduceEngine = Neon::sys::patterns::Engine::cuBlas;
+    reduceEngine = backend.devType() == Neon::DeviceType::CPU
+                       ? Neon::sys::patterns::Engine::OpenMP
+                       : Neon::sys::patterns::Engine::cuBlas;
 }
 
 auto dGrid::helpFieldMemoryAllocator()
@@ -121,11 +123,13 @@ auto dGrid::getProperties(const index_3d& idx)
         for (int i = 0; i < this->getDevSet().setCardinality(); i++) {
             zCounter += mData->partitionDims[i].z;
             if (idx.z < zCounter) {
+                // The first partition whose z range contains the cell
                 setIdx = i;
-            }
-            if ((zCounterPrevious + mData->halo.z >= idx.z) &&
-                (zCounter - mData->halo.z < idx.z)) {
-                dataView = Neon::DataView::INTERNAL;
+                if ((zCounterPrevious + mData->halo.z <= idx.z) &&
+                    (zCounter - mData->halo.z > idx.z)) {
+                    dataView = Neon::DataView::INTERNAL;
+                }
+                break;
             }
             zCounterPrevious = zCounter;
         }
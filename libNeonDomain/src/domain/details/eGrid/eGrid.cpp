@@ -123,7 +123,9 @@ eGrid::Data::Data(Neon::Backend const& backend)
 {
     spanTable = Neon::domain::tool::SpanTable<eSpan>(backend);
     elementsPerPartition = Neon::domain::tool::SpanTable<int>(backend);
-    reduceEngine = Neon::sys::patterns::Engine::cuBlas;
+    reduceEngine = backend.devType() == Neon::DeviceType::CPU
+                       ? Neon::sys::patterns::Engine::OpenMP
+                       : Neon::sys::patterns::Engine::cuBlas;
 }
 
 
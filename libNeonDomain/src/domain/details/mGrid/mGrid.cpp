@@ -8,12 +8,12 @@ mGrid::mGrid(
     const Neon::Backend&                                    backend,
     const Neon::int32_3d&                                   domainSize,
     std::vector<std::function<bool(const Neon::index_3d&)>> activeCellLambda,
-    [[maybe_unused]] const Neon::domain::Stencil&           stencil,
+    const Neon::domain::Stencil&                            stencil,
     const Descriptor                                        descriptor,
     bool                                                    isStrongBalanced,
     bool                                                    isCullOverlaps,
-    [[maybe_unused]] const double_3d&                       spacingData,
-    [[maybe_unused]] const double_3d&                       origin)
+    const double_3d&                                        spacingData,
+    const double_3d&                                        origin)
 {
 
     if (backend.devSet().setCardinality() > 1) {
@@ -42,6 +42,9 @@ mGrid::mGrid(
     mData->mStrongBalanced = isStrongBalanced;
     mData->mCullOverlaps = isCullOverlaps;
     mData->mDescriptor = descriptor;
+    mData->stencil = stencil;
+    mData->spacingData = spacingData;
+    mData->origin = origin;
     int top_level_spacing = 1;
     for (int l = 0; l < mData->mDescriptor.getDepth(); ++l) {
         if (l > 0) {
@@ -66,6 +69,13 @@ mGrid::mGrid(
         NEON_THROW(exp);
     }
 
+    helpBuildBitMask(activeCellLambda);
+
+    helpBuildLevels(nullptr);
+}
+
+auto mGrid::helpBuildBitMask(const std::vector<std::function<bool(const Neon::index_3d&)>>& activeCellLambda) -> void
+{
     mData->mTotalNumBlocks.resize(mData->mDescriptor.getDepth());
 
     constexpr uint32_t MaskSize = 32;
@@ -76,9 +86,9 @@ mGrid::mGrid(
 
         const int spacing = mData->mDescriptor.getSpacing(i);
 
-        mData->mTotalNumBlocks[i].set(NEON_DIVIDE_UP(domainSize.x, spacing),
-                                      NEON_DIVIDE_UP(domainSize.y, spacing),
-                                      NEON_DIVIDE_UP(domainSize.z, spacing));
+        mData->mTotalNumBlocks[i].set(NEON_DIVIDE_UP(mData->domainSize.x, spacing),
+                                      NEON_DIVIDE_UP(mData->domainSize.y, spacing),
+                                      NEON_DIVIDE_UP(mData->domainSize.z, spacing));
 
         std::vector<uint32_t> msk(NEON_DIVIDE_UP(refFactor * refFactor * refFactor * mData->mTotalNumBlocks[i].rMul(), MaskSize),
                                   0);
@@ -104,7 +114,7 @@ mGrid::mGrid(
 
                                 const Neon::int32_3d voxel = mData->mDescriptor.parentToChild(blockOrigin, l, {x, y, z});
 
-                                if (voxel < domainSize) {
+                                if (voxel < mData->domainSize) {
                                     //if it is already active
                                     if (levelBitMaskIsSet(l, {bx, by, bz}, {x, y, z})) {
                                         containVoxels = true;
@@ -127,7 +137,7 @@ mGrid::mGrid(
 
                                     const Neon::int32_3d voxel = mData->mDescriptor.parentToChild(blockOrigin, l, {x, y, z});
 
-                                    if (voxel < domainSize) {
+                                    if (voxel < mData->domainSize) {
                                         setLevelBitMask(l, {bx, by, bz}, {x, y, z});
                                     }
                                 }
@@ -186,7 +196,7 @@ mGrid::mGrid(
 
                         //find the child block
 
-                        if (child < domainSize) {
+                        if (child < mData->domainSize) {
                             const Neon::int32_3d childBlock(child.x / spacing,
                                                             child.y / spacing,
                                                             child.z / spacing);
@@ -224,7 +234,7 @@ mGrid::mGrid(
                                         const Neon::int32_3d voxel = mData->mDescriptor.parentToChild(blockOrigin, l, {x, y, z});
 
                                         //if the voxel is refined, then there may be a chance that we could deactivate it
-                                        if (voxel < domainSize) {
+                                        if (voxel < mData->domainSize) {
                                             if (isRefined(l, voxel)) {
 
                                                 //look at neighbor from all direction and check if there is at least one neighbor that is not refined
@@ -239,7 +249,7 @@ mGrid::mGrid(
                                                             const Neon::int32_3d neighborVoxel = mData->mDescriptor.neighbourBlock(voxel, l, {i, j, k});
 
                                                             //if the neigbor is inside the domain
-                                                            if (neighborVoxel.x >= 0 && neighborVoxel.y >= 0 && neighborVoxel.z >= 0 && neighborVoxel < domainSize) {
+                                                            if (neighborVoxel.x >= 0 && neighborVoxel.y >= 0 && neighborVoxel.z >= 0 && neighborVoxel < mData->domainSize) {
                                                                 if (!isRefined(l, neighborVoxel)) {
                                                                     deactivate = false;
                                                                 }
@@ -303,7 +313,7 @@ mGrid::mGrid(
                                                                                                 proxyVoxel.y * childSpacing,
                                                                                                 proxyVoxel.z * childSpacing);
 
-                                                        if (proxyVoxelLocation < domainSize && proxyVoxelLocation >= 0) {
+                                                        if (proxyVoxelLocation < mData->domainSize && proxyVoxelLocation >= 0) {
 
                                                             Neon::int32_3d prv_nVoxelBlockOrigin, prv_nVoxelLocalID;
                                                             for (int l_n = l; l_n < mData->mDescriptor.getDepth(); ++l_n) {
@@ -355,11 +365,19 @@ mGrid::mGrid(
             }
         }
     }
+}
 
-
+auto mGrid::helpBuildLevels(const Data* previous) -> void
+{
     mData->grids.resize(mData->mDescriptor.getDepth());
     for (int l = 0; l < mData->mDescriptor.getDepth(); ++l) {
 
+        //a level whose sparsity pattern did not change keeps the grid it had before the regrid
+        if (previous != nullptr && previous->denseLevelsBitmask[l] == mData->denseLevelsBitmask[l]) {
+            mData->grids[l] = previous->grids[l];
+            continue;
+        }
+
         int blockSize = mData->mDescriptor.getRefFactor(l);
         int voxelSpacing = mData->mDescriptor.getSpacing(l - 1);
 
@@ -369,10 +387,10 @@ mGrid::mGrid(
 
         mData->grids[l] =
             InternalGrid(
-                backend,
+                mData->backend,
                 levelDomainSize,
                 [&](Neon::int32_3d id) {
-                    if (id < domainSize) {
+                    if (id < mData->domainSize) {
                         Neon::index_3d blockID = mData->mDescriptor.childToParent(id, l);
                         Neon::index_3d localID = mData->mDescriptor.toLocalIndex(id, l);
                         return levelBitMaskIsSet(l, blockID, localID);
@@ -380,28 +398,28 @@ mGrid::mGrid(
                         return false;
                     }
                 },
-                stencil,
+                mData->stencil,
                 voxelSpacing,
-                spacingData,
-                origin);
+                mData->spacingData,
+                mData->origin);
     }
 
     Neon::MemoryOptions memOptionsAoS(Neon::DeviceType::CPU,
                                       Neon::Allocator::MALLOC,
                                       Neon::DeviceType::CUDA,
-                                      ((backend.devType() == Neon::DeviceType::CUDA) ? Neon::Allocator::CUDA_MEM_DEVICE : Neon::Allocator::NULL_MEM),
+                                      ((mData->backend.devType() == Neon::DeviceType::CUDA) ? Neon::Allocator::CUDA_MEM_DEVICE : Neon::Allocator::NULL_MEM),
                                       Neon::MemoryLayout::arrayOfStructs);
     Neon::MemoryOptions memOptionsSoA(Neon::DeviceType::CPU,
                                       Neon::Allocator::MALLOC,
                                       Neon::DeviceType::CUDA,
-                                      ((backend.devType() == Neon::DeviceType::CUDA) ? Neon::Allocator::CUDA_MEM_DEVICE : Neon::Allocator::NULL_MEM),
+                                      ((mData->backend.devType() == Neon::DeviceType::CUDA) ? Neon::Allocator::CUDA_MEM_DEVICE : Neon::Allocator::NULL_MEM),
                                       Neon::MemoryLayout::structOfArrays);
 
 
     //parent block ID
     mData->mParentBlockID.resize(mData->mDescriptor.getDepth() - 1);
     for (int l = 0; l < mData->mDescriptor.getDepth() - 1; ++l) {
-        mData->mParentBlockID[l] = backend.devSet().template newMemSet<Idx::DataBlockIdx>({Neon::DataUse::HOST_DEVICE},
+        mData->mParentBlockID[l] = mData->backend.devSet().template newMemSet<Idx::DataBlockIdx>({Neon::DataUse::HOST_DEVICE},
                                                                                           1,
                                                                                           memOptionsAoS,
                                                                                           mData->grids[l].getBlockViewGrid().getNumActiveCellsPerPartition());
@@ -411,8 +429,8 @@ mGrid::mGrid(
 
 
     std::vector<Neon::set::DataSet<uint64_t>> childAllocSize(mData->mDescriptor.getDepth());
-    for (int l = 0; l < descriptor.getDepth(); ++l) {
-        childAllocSize[l] = backend.devSet().template newDataSet<uint64_t>();
+    for (int l = 0; l < mData->mDescriptor.getDepth(); ++l) {
+        childAllocSize[l] = mData->backend.devSet().template newDataSet<uint64_t>();
         for (int64_t i = 0; i < childAllocSize[l].size(); ++i) {
             if (l > 0) {
                 childAllocSize[l][i] = mData->grids[l].helpGetPartitioner1D().getStandardCount()[0] *
@@ -426,7 +444,7 @@ mGrid::mGrid(
 
     mData->mChildBlockID.resize(mData->mDescriptor.getDepth());
     for (int l = 0; l < mData->mDescriptor.getDepth(); ++l) {
-        mData->mChildBlockID[l] = backend.devSet().template newMemSet<Idx::DataBlockIdx>({Neon::DataUse::HOST_DEVICE},
+        mData->mChildBlockID[l] = mData->backend.devSet().template newMemSet<Idx::DataBlockIdx>({Neon::DataUse::HOST_DEVICE},
                                                                                          1,
                                                                                          memOptionsSoA,
                                                                                          childAllocSize[l]);
@@ -440,11 +458,11 @@ mGrid::mGrid(
 
 
     //descriptor
-    auto descriptorSize = backend.devSet().template newDataSet<uint64_t>();
+    auto descriptorSize = mData->backend.devSet().template newDataSet<uint64_t>();
     for (int32_t c = 0; c < descriptorSize.cardinality(); ++c) {
         descriptorSize[c] = mData->mDescriptor.getDepth();
     }
-    mData->mRefFactors = backend.devSet().template newMemSet<int>({Neon::DataUse::HOST_DEVICE},
+    mData->mRefFactors = mData->backend.devSet().template newMemSet<int>({Neon::DataUse::HOST_DEVICE},
                                                                   1,
                                                                   memOptionsAoS,
                                                                   descriptorSize);
@@ -455,7 +473,7 @@ mGrid::mGrid(
         }
     }
 
-    mData->mSpacing = backend.devSet().template newMemSet<int>({Neon::DataUse::HOST_DEVICE},
+    mData->mSpacing = mData->backend.devSet().template newMemSet<int>({Neon::DataUse::HOST_DEVICE},
                                                                1,
                                                                memOptionsAoS,
                                                                descriptorSize);
@@ -503,7 +521,7 @@ mGrid::mGrid(
                                         const Neon::index_3d voxelGlobalID(x * voxelSpacing + userBlockOrigin.x,
                                                                            y * voxelSpacing + userBlockOrigin.y,
                                                                            z * voxelSpacing + userBlockOrigin.z);
-                                        if (voxelGlobalID.x >= domainSize.x || voxelGlobalID.y >= domainSize.y || voxelGlobalID.z >= domainSize.z) {
+                                        if (voxelGlobalID.x >= mData->domainSize.x || voxelGlobalID.y >= mData->domainSize.y || voxelGlobalID.z >= mData->domainSize.z) {
                                             continue;
                                         }
 
@@ -570,21 +588,156 @@ mGrid::mGrid(
         });
     }
 
-    if (backend.devType() == Neon::DeviceType::CUDA) {
+    if (mData->backend.devType() == Neon::DeviceType::CUDA) {
         for (int l = 0; l < mData->mDescriptor.getDepth(); ++l) {
             if (l < mData->mDescriptor.getDepth() - 1) {
-                mData->mParentBlockID[l].updateDeviceData(backend, 0);
+                mData->mParentBlockID[l].updateDeviceData(mData->backend, 0);
             }
             if (l > 0) {
-                mData->mChildBlockID[l].updateDeviceData(backend, 0);
+                mData->mChildBlockID[l].updateDeviceData(mData->backend, 0);
             }
         }
-        mData->mRefFactors.updateDeviceData(backend, 0);
-        mData->mSpacing.updateDeviceData(backend, 0);
+        mData->mRefFactors.updateDeviceData(mData->backend, 0);
+        mData->mSpacing.updateDeviceData(mData->backend, 0);
     }
 }
 
 
+auto mGrid::adapt(const Field<int8_t>& flags) const -> mGrid
+{
+    if (flags.mData->grid->mData != mData) {
+        NeonException exp("mGrid::adapt");
+        exp << "The flags field should be defined on the grid being adapted";
+        NEON_THROW(exp);
+    }
+
+    const Descriptor& descriptor = mData->mDescriptor;
+    const int         depth = descriptor.getDepth();
+
+    //voxels of each level are addressed in the level index space i.e., the base index divided by the level voxel spacing
+    std::vector<Neon::index_3d> levelDim(depth);
+    for (int l = 0; l < depth; ++l) {
+        levelDim[l] = mData->mTotalNumBlocks[l] * descriptor.getRefFactor(l);
+    }
+
+    auto flatten = [&](int l, const Neon::index_3d& voxel) -> size_t {
+        return size_t(voxel.x) + size_t(levelDim[l].x) * (size_t(voxel.y) + size_t(levelDim[l].y) * size_t(voxel.z));
+    };
+
+    auto isInside = [&](int l, const Neon::index_3d& voxel) -> bool {
+        return descriptor.toBaseIndexSpace(voxel, l) < mData->domainSize;
+    };
+
+    auto isActive = [&](int l, const Neon::index_3d& voxel) -> bool {
+        const int refFactor = descriptor.getRefFactor(l);
+        return isInside(l, voxel) &&
+               levelBitMaskIsSet(l,
+                                 {voxel.x / refFactor, voxel.y / refFactor, voxel.z / refFactor},
+                                 {voxel.x % refFactor, voxel.y % refFactor, voxel.z % refFactor});
+    };
+
+    auto forEachChild = [&](int l, const Neon::index_3d& voxel, const auto& fun) {
+        const int refFactor = descriptor.getRefFactor(l - 1);
+        for (int z = 0; z < refFactor; z++) {
+            for (int y = 0; y < refFactor; y++) {
+                for (int x = 0; x < refFactor; x++) {
+                    const Neon::index_3d child(voxel.x * refFactor + x,
+                                               voxel.y * refFactor + y,
+                                               voxel.z * refFactor + z);
+                    if (isInside(l - 1, child)) {
+                        fun(child);
+                    }
+                }
+            }
+        }
+    };
+
+    //the leaves are the active voxels that are not refined
+    std::vector<std::vector<bool>> leaf(depth);
+    for (int l = 0; l < depth; ++l) {
+        leaf[l].resize(levelDim[l].rMulTyped<size_t>(), false);
+        for (int z = 0; z < levelDim[l].z; z++) {
+            for (int y = 0; y < levelDim[l].y; y++) {
+                for (int x = 0; x < levelDim[l].x; x++) {
+                    const Neon::index_3d voxel(x, y, z);
+                    if (isActive(l, voxel)) {
+                        bool isRefined = false;
+                        if (l > 0) {
+                            forEachChild(l, voxel, [&](const Neon::index_3d& child) {
+                                isRefined = isRefined || isActive(l - 1, child);
+                            });
+                        }
+                        leaf[l][flatten(l, voxel)] = !isRefined;
+                    }
+                }
+            }
+        }
+    }
+
+    auto flag = [&](int l, const Neon::index_3d& voxel) -> int8_t {
+        return flags(descriptor.toBaseIndexSpace(voxel, l), 0, l);
+    };
+
+    std::vector<std::vector<bool>> newLeaf = leaf;
+
+    for (int l = 0; l < depth; ++l) {
+        for (int z = 0; z < levelDim[l].z; z++) {
+            for (int y = 0; y < levelDim[l].y; y++) {
+                for (int x = 0; x < levelDim[l].x; x++) {
+                    const Neon::index_3d voxel(x, y, z);
+
+                    //refine a leaf
+                    if (l > 0 && leaf[l][flatten(l, voxel)] && flag(l, voxel) > 0) {
+                        newLeaf[l][flatten(l, voxel)] = false;
+                        forEachChild(l, voxel, [&](const Neon::index_3d& child) {
+                            newLeaf[l - 1][flatten(l - 1, child)] = true;
+                        });
+                    }
+
+                    //coarsen the children of a voxel if all of them are leaves that ask for it.
+                    //The voxel itself may have been culled, in which case it is activated again
+                    if (l > 0 && isInside(l, voxel)) {
+                        bool coarsen = true;
+                        forEachChild(l, voxel, [&](const Neon::index_3d& child) {
+                            coarsen = coarsen && leaf[l - 1][flatten(l - 1, child)] && flag(l - 1, child) < 0;
+                        });
+                        if (coarsen) {
+                            forEachChild(l, voxel, [&](const Neon::index_3d& child) {
+                                newLeaf[l - 1][flatten(l - 1, child)] = false;
+                            });
+                            newLeaf[l][flatten(l, voxel)] = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<std::function<bool(const Neon::index_3d&)>> activeCellLambda(depth);
+    for (int l = 0; l < depth; ++l) {
+        activeCellLambda[l] = [&, l](const Neon::index_3d& id) -> bool {
+            return newLeaf[l][flatten(l, descriptor.toLevelIndexSpace(id, l))];
+        };
+    }
+
+    mGrid ret;
+    ret.mData = std::make_shared<Data>();
+    ret.mData->backend = mData->backend;
+    ret.mData->domainSize = mData->domainSize;
+    ret.mData->mStrongBalanced = mData->mStrongBalanced;
+    ret.mData->mCullOverlaps = mData->mCullOverlaps;
+    ret.mData->mDescriptor = mData->mDescriptor;
+    ret.mData->stencil = mData->stencil;
+    ret.mData->spacingData = mData->spacingData;
+    ret.mData->origin = mData->origin;
+
+    ret.helpBuildBitMask(activeCellLambda);
+
+    ret.helpBuildLevels(mData.get());
+
+    return ret;
+}
+
 auto mGrid::levelBitMaskIndex(int l, const Neon::index_3d& blockID, const Neon::index_3d& localChild) const -> std::pair<int, int>
 {
     constexpr uint32_t MaskSize = 32;
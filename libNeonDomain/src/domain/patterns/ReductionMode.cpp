@@ -0,0 +1,24 @@
+#include "Neon/domain/patterns/ReductionMode.h"
+#include "Neon/core/core.h"
+
+namespace Neon {
+
+auto ReductionModeUtils::toString(Neon::ReductionMode option) -> const char*
+{
+    switch (option) {
+        case Neon::ReductionMode::fast: {
+            return "fast";
+        }
+        case Neon::ReductionMode::deterministic: {
+            return "deterministic";
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("ReductionModeUtils");
+}
+
+std::ostream& operator<<(std::ostream& os, Neon::ReductionMode const& m)
+{
+    return os << std::string(Neon::ReductionModeUtils::toString(m));
+}
+
+}  // namespace Neon
@@ -13,6 +13,42 @@ TEST(domain_map, dGrid)
                             1);
 }
 
+TEST(domain_map, dGridTiled)
+{
+    int nGpus = 3;
+    using Type = int64_t;
+    runAllTestConfiguration(std::function(map::runTiled<Neon::dGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
+TEST(domain_map, dGridHostValueReload)
+{
+    int nGpus = 3;
+    using Type = int64_t;
+    runAllTestConfiguration(std::function(map::runHostValueReload<Neon::dGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
+TEST(domain_map, eGridHostValueReload)
+{
+    int nGpus = 3;
+    using Type = int64_t;
+    runAllTestConfiguration(std::function(map::runHostValueReload<Neon::eGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
+TEST(domain_map, dGridComputeLambdaCache)
+{
+    int nGpus = 3;
+    using Type = int64_t;
+    runAllTestConfiguration(std::function(map::runComputeLambdaCache<Neon::dGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
 TEST(domain_map, eGrid)
 {
     int nGpus = 3;
@@ -31,6 +67,33 @@ TEST(domain_map, bGrid)
                             1);
 }
 
+TEST(domain_map, dGridInternalAndBoundary)
+{
+    int nGpus = 3;
+    using Type = int64_t;
+    runAllTestConfiguration(std::function(map::runInternalAndBoundary<Neon::dGrid, Type, 0>),
+                            nGpus,
+                            2);
+}
+
+TEST(domain_map, dGridPartitionModes)
+{
+    int nGpus = 3;
+    using Type = int64_t;
+    runAllTestConfiguration(std::function(map::runPartitionModes<Neon::dGrid, Type, 0>),
+                            nGpus,
+                            2);
+}
+
+TEST(domain_map, bGridSimd)
+{
+    int nGpus = 1;
+    using Type = int64_t;
+    runAllTestConfiguration(std::function(map::runSimd<Neon::bGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -1,4 +1,6 @@
+#include <atomic>
 #include <functional>
+#include <omp.h>
 #include "Neon/domain/Grids.h"
 
 #include "Neon/domain/tools/TestData.h"
@@ -31,6 +33,52 @@ auto mapContainer_axpy(int                   streamIdx,
         });
 }
 
+template <typename Field>
+auto mapContainer_axpyByRef(const typename Field::Type& val,
+                            const Field&                filedA,
+                            Field&                      fieldB)
+    -> Neon::set::Container
+{
+    const auto& grid = filedA.getGrid();
+    return grid.newContainer(
+        "mapContainer_axpyByRef",
+        [&](Neon::set::Loader& loader) {
+            const auto a = loader.load(filedA);
+            auto       b = loader.load(fieldB);
+            // The host value is read when the container is loaded, not when it is created
+            const auto alpha = val;
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Idx& e) mutable {
+                for (int i = 0; i < a.cardinality(); i++) {
+                    b(e, i) += a(e, i) * alpha;
+                }
+            };
+        });
+}
+
+template <typename Field>
+auto mapContainer_axpyCounted(const typename Field::Type& val,
+                              const Field&                filedA,
+                              Field&                      fieldB,
+                              std::atomic<int>&           nLoads)
+    -> Neon::set::Container
+{
+    const auto& grid = filedA.getGrid();
+    return grid.newContainer(
+        "mapContainer_axpyCounted",
+        [&, val](Neon::set::Loader& loader) {
+            nLoads++;
+            const auto a = loader.load(filedA);
+            auto       b = loader.load(fieldB);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Idx& e) mutable {
+                for (int i = 0; i < a.cardinality(); i++) {
+                    b(e, i) += a(e, i) * val;
+                }
+            };
+        });
+}
+
 using namespace Neon::domain::tool::testing;
 
 template <typename G, typename T, int C>
@@ -72,9 +120,230 @@ auto run(TestData<G, T, C>& data) -> void
     ASSERT_TRUE(isOk);
 }
 
+template <typename G, typename T, int C>
+auto runTiled(TestData<G, T, C>& data) -> void
+{
+    if (data.getBackend().runtime() != Neon::Runtime::openmp) {
+        // The tiling only applies to the OpenMP launchers
+        return;
+    }
+
+    // Same initial values on all the fields
+    data.resetValuesToLinear(1, 0);
+    T val = T(33);
+
+    auto& X = data.getField(FieldNames::X);
+    auto& Y = data.getField(FieldNames::Y);
+    auto& Z = data.getField(FieldNames::Z);
+
+    {  // Reference: a single tile spanning the whole partition
+        auto container = mapContainer_axpy(Neon::Backend::mainStreamIdx, val, X, Y);
+        container.setOmpLaunchConfig(Neon::set::OmpLaunchConfig(Neon::index_3d(0, 0, 0)));
+        container.run(0);
+    }
+    {  // Tiles that split x rows and do not divide the domain, handed out dynamically
+        auto container = mapContainer_axpy(Neon::Backend::mainStreamIdx, val, X, Z);
+        container.setOmpLaunchConfig(Neon::set::OmpLaunchConfig(Neon::index_3d(3, 2, 5), Neon::set::OmpSchedule::dynamicSchedule, 2));
+        container.run(0);
+    }
+    Y.updateHostData(0);
+    Z.updateHostData(0);
+    data.getBackend().sync(0);
+
+    bool isOk = true;
+    Y.forEachActiveCell(
+        [&](const Neon::index_3d& idx, const int& card, T& y) {
+            if (y != Z(idx, card)) {
+                isOk = false;
+            }
+        },
+        Neon::computeMode_t::computeMode_e::seq);
+    ASSERT_TRUE(isOk);
+
+    {  // Golden data
+        auto& goldenX = data.getIODomain(FieldNames::X);
+        auto& goldenY = data.getIODomain(FieldNames::Y);
+        data.axpy(&val, goldenX, goldenY);
+    }
+    ASSERT_TRUE(data.compare(FieldNames::Y));
+}
+
+template <typename G, typename T, int C>
+auto runInternalAndBoundary(TestData<G, T, C>& data) -> void
+{
+    data.resetValuesToLinear(1, 100);
+    T val = T(33);
+
+    auto& X = data.getField(FieldNames::X);
+    auto& Y = data.getField(FieldNames::Y);
+
+    // Together the two data views must visit every cell exactly once
+    auto container = mapContainer_axpy(Neon::Backend::mainStreamIdx, val, X, Y);
+    container.run(0, Neon::DataView::BOUNDARY);
+    container.run(0, Neon::DataView::INTERNAL);
+
+    Y.updateHostData(0);
+    data.getBackend().sync(0);
+
+    {  // Golden data
+        auto& goldenX = data.getIODomain(FieldNames::X);
+        auto& goldenY = data.getIODomain(FieldNames::Y);
+        data.axpy(&val, goldenX, goldenY);
+    }
+    ASSERT_TRUE(data.compare(FieldNames::Y));
+}
+
+template <typename G, typename T, int C>
+auto runPartitionModes(TestData<G, T, C>& data) -> void
+{
+    if (data.getBackend().runtime() != Neon::Runtime::openmp) {
+        // The partition mode only applies to the OpenMP runtime
+        return;
+    }
+
+    T val = T(33);
+    // Copies of a backend share its configuration
+    Neon::Backend backend = data.getBackend();
+
+    for (auto mode : {Neon::set::OmpPartitionMode::sequential, Neon::set::OmpPartitionMode::concurrent}) {
+        data.resetValuesToLinear(1, 100);
+        backend.setOmpPartitionMode(mode);
+
+        const int maxActiveLevels = omp_get_max_active_levels();
+        auto&     X = data.getField(FieldNames::X);
+        auto&     Y = data.getField(FieldNames::Y);
+        mapContainer_axpy(Neon::Backend::mainStreamIdx, val, X, Y).run(0);
+        Y.updateHostData(0);
+        data.getBackend().sync(0);
+        // The nested parallelism opened by the concurrent mode must not leak out of the launch
+        ASSERT_EQ(omp_get_max_active_levels(), maxActiveLevels) << Neon::set::OmpPartitionModeUtils::toString(mode);
+
+        {  // Golden data
+            auto& goldenX = data.getIODomain(FieldNames::X);
+            auto& goldenY = data.getIODomain(FieldNames::Y);
+            data.axpy(&val, goldenX, goldenY);
+        }
+        ASSERT_TRUE(data.compare(FieldNames::Y)) << Neon::set::OmpPartitionModeUtils::toString(mode);
+    }
+    backend.setOmpPartitionMode(Neon::set::OmpPartitionMode::sequential);
+}
+
+template <typename G, typename T, int C>
+auto runSimd(TestData<G, T, C>& data) -> void
+{
+    data.resetValuesToLinear(1, 100);
+    T val = T(33);
+
+    auto& X = data.getField(FieldNames::X);
+    auto& Y = data.getField(FieldNames::Y);
+
+    // axpy has no dependency between voxels: it can run as SIMD lanes
+    auto container = mapContainer_axpy(Neon::Backend::mainStreamIdx, val, X, Y);
+    container.setOmpSimd(true);
+    container.run(0);
+
+    Y.updateHostData(0);
+    data.getBackend().sync(0);
+
+    {  // Golden data
+        auto& goldenX = data.getIODomain(FieldNames::X);
+        auto& goldenY = data.getIODomain(FieldNames::Y);
+        data.axpy(&val, goldenX, goldenY);
+    }
+    ASSERT_TRUE(data.compare(FieldNames::Y));
+}
+
+template <typename G, typename T, int C>
+auto runHostValueReload(TestData<G, T, C>& data) -> void
+{
+    data.resetValuesToLinear(1, 100);
+    T val = T(33);
+
+    auto& X = data.getField(FieldNames::X);
+    auto& Y = data.getField(FieldNames::Y);
+
+    auto container = mapContainer_axpyByRef(val, X, Y);
+    container.run(0);
+    // The second run must see the new host value
+    val = T(7);
+    container.run(0);
+
+    Y.updateHostData(0);
+    data.getBackend().sync(0);
+
+    {  // Golden data
+        auto& goldenX = data.getIODomain(FieldNames::X);
+        auto& goldenY = data.getIODomain(FieldNames::Y);
+        T     first = T(33);
+        T     second = T(7);
+        data.axpy(&first, goldenX, goldenY);
+        data.axpy(&second, goldenX, goldenY);
+    }
+    ASSERT_TRUE(data.compare(FieldNames::Y));
+}
+
+template <typename G, typename T, int C>
+auto runComputeLambdaCache(TestData<G, T, C>& data) -> void
+{
+    data.resetValuesToLinear(1, 100);
+    T val = T(33);
+
+    auto& X = data.getField(FieldNames::X);
+    auto& Y = data.getField(FieldNames::Y);
+    auto& Z = data.getField(FieldNames::Z);
+
+    std::atomic<int> nLoads{0};
+    auto             container = mapContainer_axpyCounted(val, X, Y, nLoads);
+    container.setComputeLambdaCache(true);
+
+    container.run(0);
+    const int nFirstLoads = nLoads;
+    // The lambdas extracted by the first run are reused
+    container.run(0);
+    ASSERT_EQ(nLoads, nFirstLoads);
+
+    // Fields that are not loaded by the container do not invalidate its cache
+    auto other = data.getGrid().template newField<T, C>("other", X.getCardinality(), T(0));
+    container.run(0);
+    ASSERT_EQ(nLoads, nFirstLoads);
+
+    // After a swap X sees the data of Z: the lambdas must be extracted again
+    G::template Field<T, C>::swap(X, Z);
+    container.run(0);
+    ASSERT_GT(nLoads, nFirstLoads);
+    G::template Field<T, C>::swap(X, Z);
+
+    Y.updateHostData(0);
+    data.getBackend().sync(0);
+
+    {  // Golden data
+        auto& goldenX = data.getIODomain(FieldNames::X);
+        auto& goldenY = data.getIODomain(FieldNames::Y);
+        auto& goldenZ = data.getIODomain(FieldNames::Z);
+        for (int i = 0; i < 3; i++) {
+            data.axpy(&val, goldenX, goldenY);
+        }
+        data.axpy(&val, goldenZ, goldenY);
+    }
+    ASSERT_TRUE(data.compare(FieldNames::Y));
+}
+
 template auto run<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
 template auto run<Neon::eGrid, int64_t, 0>(TestData<Neon::eGrid, int64_t, 0>&) -> void;
 template auto run<Neon::bGrid, int64_t, 0>(TestData<Neon::bGrid, int64_t, 0>&) -> void;
 
+template auto runTiled<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+
+template auto runInternalAndBoundary<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+
+template auto runPartitionModes<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+
+template auto runSimd<Neon::bGrid, int64_t, 0>(TestData<Neon::bGrid, int64_t, 0>&) -> void;
+
+template auto runHostValueReload<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+template auto runHostValueReload<Neon::eGrid, int64_t, 0>(TestData<Neon::eGrid, int64_t, 0>&) -> void;
+
+template auto runComputeLambdaCache<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+
 
 }  // namespace map
\ No newline at end of file
@@ -15,5 +15,36 @@ auto run(TestData<G, T, C>& data) -> void;
 extern template auto run<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
 extern template auto run<Neon::eGrid, int64_t, 0>(TestData<Neon::eGrid, int64_t, 0>&) -> void;
 
+template <typename G, typename T, int C>
+auto runTiled(TestData<G, T, C>& data) -> void;
+
+extern template auto runTiled<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+
+template <typename G, typename T, int C>
+auto runInternalAndBoundary(TestData<G, T, C>& data) -> void;
+
+extern template auto runInternalAndBoundary<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+
+template <typename G, typename T, int C>
+auto runPartitionModes(TestData<G, T, C>& data) -> void;
+
+extern template auto runPartitionModes<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+
+template <typename G, typename T, int C>
+auto runSimd(TestData<G, T, C>& data) -> void;
+
+extern template auto runSimd<Neon::bGrid, int64_t, 0>(TestData<Neon::bGrid, int64_t, 0>&) -> void;
+
+template <typename G, typename T, int C>
+auto runHostValueReload(TestData<G, T, C>& data) -> void;
+
+extern template auto runHostValueReload<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+extern template auto runHostValueReload<Neon::eGrid, int64_t, 0>(TestData<Neon::eGrid, int64_t, 0>&) -> void;
+
+template <typename G, typename T, int C>
+auto runComputeLambdaCache(TestData<G, T, C>& data) -> void;
+
+extern template auto runComputeLambdaCache<Neon::dGrid, int64_t, 0>(TestData<Neon::dGrid, int64_t, 0>&) -> void;
+
 
 }  // namespace map
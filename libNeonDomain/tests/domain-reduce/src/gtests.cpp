@@ -0,0 +1,77 @@
+#include "Neon/Neon.h"
+#include "gtest/gtest.h"
+#include "reduce.h"
+#include "runHelper.h"
+
+TEST(domain_reduce, dGrid)
+{
+    int nGpus = 3;
+    using Type = double;
+    runAllTestConfiguration(std::function(reduce::run<Neon::dGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
+TEST(domain_reduce, eGrid)
+{
+    int nGpus = 3;
+    using Type = double;
+    runAllTestConfiguration(std::function(reduce::run<Neon::eGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
+TEST(domain_reduce, bGrid)
+{
+    int nGpus = 1;
+    using Type = double;
+    runAllTestConfiguration(std::function(reduce::run<Neon::bGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
+TEST(domain_reduce, dGridScalarDependency)
+{
+    int nGpus = 3;
+    using Type = double;
+    runAllTestConfiguration(std::function(reduce::runScalarDependency<Neon::dGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
+TEST(domain_reduce, eGridScalarDependency)
+{
+    int nGpus = 3;
+    using Type = double;
+    runAllTestConfiguration(std::function(reduce::runScalarDependency<Neon::eGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
+TEST(domain_reduce, bGridScalarDependency)
+{
+    int nGpus = 1;
+    using Type = double;
+    runAllTestConfiguration(std::function(reduce::runScalarDependency<Neon::bGrid, Type, 0>),
+                            nGpus,
+                            1);
+}
+
+TEST(domain_reduce, bGridFullMaskWords)
+{
+    // The domain is a whole number of 8x8x8 blocks: all mask words are full words
+    Neon::Backend                     backend(std::vector<int>{0}, Neon::Runtime::openmp);
+    TestData<Neon::bGrid, int64_t, 0> data(backend,
+                                           Neon::index_3d(16, 16, 48),
+                                           1,
+                                           backend.getMemoryOptions(),
+                                           Geometry::FullDomain);
+    reduce::runFullMaskWords(data);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    Neon::init();
+    return RUN_ALL_TESTS();
+}
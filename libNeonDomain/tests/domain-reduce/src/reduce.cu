@@ -0,0 +1,340 @@
+#include <algorithm>
+#include <array>
+#include <functional>
+#include "Neon/domain/Grids.h"
+
+#include "Neon/domain/tools/TestData.h"
+#include "gtest/gtest.h"
+
+
+namespace reduce {
+
+constexpr int nBins = 4;
+using Histogram = std::array<int64_t, nBins>;
+
+template <typename T>
+auto binOf(T val) -> int
+{
+    // Values are in [1, 50]
+    return std::min(nBins - 1, int(val - 1) / 13);
+}
+
+template <Neon::Execution execution, typename Field>
+auto reduceContainer_sum(const Field&                                        field,
+                         Neon::template PatternScalar<typename Field::Type>& scalar)
+    -> Neon::set::Container
+{
+    using Type = typename Field::Type;
+    const auto& grid = field.getGrid();
+    return grid.template newReduceContainer<execution>(
+        "reduceContainer_sum", scalar, Type(0),
+        [](const Type& a, const Type& b) { return a + b; },
+        [&](Neon::set::Loader& loader) {
+            const auto f = loader.load(field);
+
+            return [=](const typename Field::Idx& e) -> Type {
+                Type partial = 0;
+                for (int i = 0; i < f.cardinality(); i++) {
+                    partial += f(e, i);
+                }
+                return partial;
+            };
+        });
+}
+
+template <Neon::Execution execution, typename Field>
+auto reduceContainer_max(const Field&                                        field,
+                         Neon::template PatternScalar<typename Field::Type>& scalar)
+    -> Neon::set::Container
+{
+    using Type = typename Field::Type;
+    const auto& grid = field.getGrid();
+    return grid.template newReduceContainer<execution>(
+        "reduceContainer_max", scalar, std::numeric_limits<Type>::lowest(),
+        [](const Type& a, const Type& b) { return std::max(a, b); },
+        [&](Neon::set::Loader& loader) {
+            const auto f = loader.load(field);
+
+            return [=](const typename Field::Idx& e) -> Type {
+                Type partial = std::numeric_limits<Type>::lowest();
+                for (int i = 0; i < f.cardinality(); i++) {
+                    partial = std::max(partial, f(e, i));
+                }
+                return partial;
+            };
+        });
+}
+
+template <Neon::Execution execution, typename Field>
+auto reduceContainer_histogram(const Field& field,
+                               Histogram&   histogram)
+    -> Neon::set::Container
+{
+    const auto& grid = field.getGrid();
+    return grid.template newReduceContainer<execution>(
+        "reduceContainer_histogram", histogram, Histogram{},
+        [](const Histogram& a, const Histogram& b) {
+            Histogram c;
+            for (int bin = 0; bin < nBins; bin++) {
+                c[bin] = a[bin] + b[bin];
+            }
+            return c;
+        },
+        [&](Neon::set::Loader& loader) {
+            const auto f = loader.load(field);
+
+            return [=](const typename Field::Idx& e) -> Histogram {
+                Histogram partial{};
+                for (int i = 0; i < f.cardinality(); i++) {
+                    partial[binOf(f(e, i))]++;
+                }
+                return partial;
+            };
+        });
+}
+
+template <Neon::Execution execution, typename Field>
+auto reduceContainer_fusedDots(const Field&                                        x,
+                               const Field&                                        y,
+                               Neon::template PatternScalar<typename Field::Type>& xx,
+                               Neon::template PatternScalar<typename Field::Type>& xy,
+                               Neon::template PatternScalar<typename Field::Type>& yy)
+    -> Neon::set::Container
+{
+    using Type = typename Field::Type;
+    const auto& grid = x.getGrid();
+    return grid.template newSumContainer<execution>(
+        "reduceContainer_fusedDots", std::tie(xx, xy, yy),
+        [&](Neon::set::Loader& loader) {
+            const auto a = loader.load(x);
+            const auto b = loader.load(y);
+
+            return [=](const typename Field::Idx& e) -> std::array<Type, 3> {
+                std::array<Type, 3> partial{};
+                for (int i = 0; i < a.cardinality(); i++) {
+                    partial[0] += a(e, i) * a(e, i);
+                    partial[1] += a(e, i) * b(e, i);
+                    partial[2] += b(e, i) * b(e, i);
+                }
+                return partial;
+            };
+        });
+}
+
+template <typename Field>
+auto mapContainer_scale(const Neon::template PatternScalar<typename Field::Type>& scalar,
+                        const Field&                                              x,
+                        Field&                                                    y)
+    -> Neon::set::Container
+{
+    const auto& grid = x.getGrid();
+    return grid.newContainer(
+        "mapContainer_scale",
+        [&](Neon::set::Loader& loader) {
+            const auto s = loader.load(scalar);
+            const auto a = loader.load(x);
+            auto       b = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Idx& e) mutable {
+                for (int i = 0; i < a.cardinality(); i++) {
+                    b(e, i) = s() * a(e, i);
+                }
+            };
+        });
+}
+
+using namespace Neon::domain::tool::testing;
+
+template <Neon::Execution execution, typename G, typename T, int C>
+auto runOnExecution(TestData<G, T, C>& data) -> void
+{
+    using Type = typename TestData<G, T, C>::Type;
+    auto& grid = data.getGrid();
+    auto& X = data.getField(FieldNames::X);
+
+    Type      goldenSum = 0;
+    Type      goldenMax = std::numeric_limits<Type>::lowest();
+    Histogram goldenHistogram{};
+    data.getIODomain(FieldNames::X).forEachActive([&](const Neon::index_3d&, int, Type& val) {
+#pragma omp critical
+        {
+            goldenSum += val;
+            goldenMax = std::max(goldenMax, val);
+            goldenHistogram[binOf(val)]++;
+        }
+    });
+
+    auto sumScalar = Neon::PatternScalar<Type>(grid.getBackend(), Neon::sys::patterns::Engine::OpenMP);
+    auto maxScalar = Neon::PatternScalar<Type>(grid.getBackend(), Neon::sys::patterns::Engine::OpenMP);
+    Histogram histogram{};
+
+    auto sumContainer = reduceContainer_sum<execution>(X, sumScalar);
+    auto maxContainer = reduceContainer_max<execution>(X, maxScalar);
+    auto histogramContainer = reduceContainer_histogram<execution>(X, histogram);
+
+    auto& Y = data.getField(FieldNames::Y);
+    Type  goldenXX = 0;
+    Type  goldenXY = 0;
+    Type  goldenYY = 0;
+    data.dot(data.getIODomain(FieldNames::X), data.getIODomain(FieldNames::X), &goldenXX);
+    data.dot(data.getIODomain(FieldNames::X), data.getIODomain(FieldNames::Y), &goldenXY);
+    data.dot(data.getIODomain(FieldNames::Y), data.getIODomain(FieldNames::Y), &goldenYY);
+
+    auto xx = Neon::PatternScalar<Type>(grid.getBackend(), Neon::sys::patterns::Engine::OpenMP);
+    auto xy = Neon::PatternScalar<Type>(grid.getBackend(), Neon::sys::patterns::Engine::OpenMP);
+    auto yy = Neon::PatternScalar<Type>(grid.getBackend(), Neon::sys::patterns::Engine::OpenMP);
+    auto fusedContainer = reduceContainer_fusedDots<execution>(X, Y, xx, xy, yy);
+
+    ASSERT_EQ(sumContainer.getContainerInterface().getContainerPatternType(), Neon::set::ContainerPatternType::reduction);
+
+    for (auto const& dataViews : {std::vector<Neon::DataView>{Neon::DataView::STANDARD},
+                                  std::vector<Neon::DataView>{Neon::DataView::INTERNAL, Neon::DataView::BOUNDARY}}) {
+        sumScalar() = 0;
+        maxScalar() = 0;
+        histogram = Histogram{};
+        xx() = 0;
+        xy() = 0;
+        yy() = 0;
+        for (auto dataView : dataViews) {
+            sumContainer.run(0, dataView);
+            maxContainer.run(0, dataView);
+            histogramContainer.run(0, dataView);
+            fusedContainer.run(0, dataView);
+        }
+        data.getBackend().sync(0);
+
+        ASSERT_EQ(sumScalar(), goldenSum);
+        ASSERT_EQ(maxScalar(), goldenMax);
+        ASSERT_EQ(histogram, goldenHistogram);
+        ASSERT_EQ(xx(), goldenXX);
+        ASSERT_EQ(xy(), goldenXY);
+        ASSERT_EQ(yy(), goldenYY);
+    }
+}
+
+template <typename G, typename T, int C>
+auto run(TestData<G, T, C>& data) -> void
+{
+    data.resetValuesToRandom(1, 50);
+
+    if (data.getBackend().runtime() == Neon::Runtime::openmp) {
+        runOnExecution<Neon::Execution::device>(data);
+    }
+    // The host execution is available for any runtime
+    data.getField(FieldNames::X).updateHostData(0);
+    data.getField(FieldNames::Y).updateHostData(0);
+    data.getBackend().sync(0);
+    runOnExecution<Neon::Execution::host>(data);
+}
+
+template <typename G, typename T, int C>
+auto runFullMaskWords(TestData<G, T, C>& data) -> void
+{
+    using Type = typename TestData<G, T, C>::Type;
+    // Linear integer values: the golden sum is exact and any lost update changes it
+    data.resetValuesToLinear(1, 0);
+
+    auto& grid = data.getGrid();
+    auto& X = data.getField(FieldNames::X);
+
+    Type goldenSum = 0;
+    data.getIODomain(FieldNames::X).forEachActive([&](const Neon::index_3d&, int, Type& val) {
+#pragma omp critical
+        {
+            goldenSum += val;
+        }
+    });
+
+    auto sumScalar = Neon::PatternScalar<Type>(grid.getBackend(), Neon::sys::patterns::Engine::OpenMP);
+    auto sumContainer = reduceContainer_sum<Neon::Execution::device>(X, sumScalar);
+
+    for (int repetition = 0; repetition < 10; repetition++) {
+        sumScalar() = 0;
+        sumContainer.run(0, Neon::DataView::STANDARD);
+        data.getBackend().sync(0);
+        ASSERT_EQ(sumScalar(), goldenSum);
+    }
+}
+
+template <typename G, typename T, int C>
+auto runScalarDependency(TestData<G, T, C>& data) -> void
+{
+    using Type = typename TestData<G, T, C>::Type;
+    if (data.getBackend().runtime() != Neon::Runtime::openmp) {
+        // Reductions on device and compute lambdas reading a scalar need CPU devices
+        return;
+    }
+    data.resetValuesToRandom(1, 50);
+
+    auto& grid = data.getGrid();
+    auto& X = data.getField(FieldNames::X);
+    auto& Y = data.getField(FieldNames::Y);
+
+    auto xx = grid.template newPatternScalar<Type>();
+    auto dotContainer = grid.dot("dot", X, X, xx);
+    auto scaleContainer = mapContainer_scale(xx, X, Y);
+    // The compute lambda reads the scalar when it runs, so it can be reused across runs
+    scaleContainer.setComputeLambdaCache(true);
+
+    {  // The reduction writes the scalar and the map Container reads it
+        auto hasToken = [&xx](Neon::set::Container& container, Neon::set::dataDependency::AccessType access) {
+            for (auto& token : container.getContainerInterface().parse()) {
+                if (token.uid() == xx.getUid() && token.access() == access) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        ASSERT_TRUE(hasToken(dotContainer, Neon::set::dataDependency::AccessType::WRITE));
+        ASSERT_TRUE(hasToken(scaleContainer, Neon::set::dataDependency::AccessType::READ));
+    }
+
+    for (int repetition = 0; repetition < 2; repetition++) {
+        dotContainer.run(0, Neon::DataView::STANDARD);
+        scaleContainer.run(0, Neon::DataView::STANDARD);
+        X.updateHostData(0);
+        Y.updateHostData(0);
+        data.getBackend().sync(0);
+
+        Type golden = 0;
+        data.dot(data.getIODomain(FieldNames::X), data.getIODomain(FieldNames::X), &golden);
+        ASSERT_NEAR(xx(), golden, std::abs(golden) * 1e-12);
+
+        data.forEachActiveIODomain([&](const Neon::index_3d& /*idx*/,
+                                       int /*cardinality*/,
+                                       Type& a,
+                                       Type& b) {
+            b = xx() * a;
+        },
+                                   data.getIODomain(FieldNames::X),
+                                   data.getIODomain(FieldNames::Y));
+        ASSERT_TRUE(data.compare(FieldNames::Y));
+
+        // A different dot product on the next run
+        auto twice = grid.newContainer("twice", [&](Neon::set::Loader& loader) {
+            auto a = loader.load(X);
+            return [=] NEON_CUDA_HOST_DEVICE(const typename G::template Field<T, C>::Idx& e) mutable {
+                for (int i = 0; i < a.cardinality(); i++) {
+                    a(e, i) *= 2;
+                }
+            };
+        });
+        twice.run(0);
+        data.getIODomain(FieldNames::X).forEachActive([&](const Neon::index_3d&, int, Type& val) {
+            val *= 2;
+        });
+    }
+}
+
+template auto runScalarDependency<Neon::dGrid, double, 0>(TestData<Neon::dGrid, double, 0>&) -> void;
+template auto runScalarDependency<Neon::eGrid, double, 0>(TestData<Neon::eGrid, double, 0>&) -> void;
+template auto runScalarDependency<Neon::bGrid, double, 0>(TestData<Neon::bGrid, double, 0>&) -> void;
+
+template auto runFullMaskWords<Neon::bGrid, int64_t, 0>(TestData<Neon::bGrid, int64_t, 0>&) -> void;
+
+template auto run<Neon::dGrid, double, 0>(TestData<Neon::dGrid, double, 0>&) -> void;
+template auto run<Neon::eGrid, double, 0>(TestData<Neon::eGrid, double, 0>&) -> void;
+template auto run<Neon::bGrid, double, 0>(TestData<Neon::bGrid, double, 0>&) -> void;
+
+
+}  // namespace reduce
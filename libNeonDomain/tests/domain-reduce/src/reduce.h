@@ -0,0 +1,38 @@
+#pragma once
+#include <functional>
+
+#include "Neon/domain/Grids.h"
+#include "Neon/domain/tools/TestData.h"
+
+
+namespace reduce {
+using namespace Neon::domain::tool::testing;
+
+template <typename G, typename T, int C>
+auto run(TestData<G, T, C>& data) -> void;
+
+/**
+ * Reduces a bGrid whose blocks are all fully active, so that every word of the
+ * block bit masks is a full word, and checks the exact sum.
+ */
+template <typename G, typename T, int C>
+auto runFullMaskWords(TestData<G, T, C>& data) -> void;
+
+/**
+ * Checks that a map Container reading the result of a dot product depends on it
+ * and reads the result of the last run.
+ */
+template <typename G, typename T, int C>
+auto runScalarDependency(TestData<G, T, C>& data) -> void;
+
+extern template auto runScalarDependency<Neon::dGrid, double, 0>(TestData<Neon::dGrid, double, 0>&) -> void;
+extern template auto runScalarDependency<Neon::eGrid, double, 0>(TestData<Neon::eGrid, double, 0>&) -> void;
+extern template auto runScalarDependency<Neon::bGrid, double, 0>(TestData<Neon::bGrid, double, 0>&) -> void;
+
+extern template auto runFullMaskWords<Neon::bGrid, int64_t, 0>(TestData<Neon::bGrid, int64_t, 0>&) -> void;
+
+extern template auto run<Neon::dGrid, double, 0>(TestData<Neon::dGrid, double, 0>&) -> void;
+extern template auto run<Neon::eGrid, double, 0>(TestData<Neon::eGrid, double, 0>&) -> void;
+extern template auto run<Neon::bGrid, double, 0>(TestData<Neon::bGrid, double, 0>&) -> void;
+
+}  // namespace reduce
@@ -1,6 +1,6 @@
+#include <omp.h>
 #include <functional>
-#include "Neon/domain/eGrid.h"
-#include "Neon/domain/details/dGrid/dGrid.h"
+#include "Neon/domain/Grids.h"
 
 #include "Neon/domain/tools/TestData.h"
 #include "TestInformation.h"
@@ -10,50 +10,137 @@
 
 using namespace Neon::domain::tool::testing;
 
+/**
+ * Serial deterministic dot over the leaves of dGrid: one z slice (one per component in the SoA layout),
+ * whose element i is accumulated on lane i % 8, combined by pairwise sums in leaf order.
+ */
+template <typename IODomain>
+auto deterministicDotReference(const IODomain& X, const IODomain& Y, Neon::MemoryLayout order)
+{
+    using Type = typename IODomain::Type;
+
+    constexpr int        nLanes = 8;
+    const Neon::index_3d dim = X.getDimension();
+    const int            cardinality = X.getCardinality();
+    const bool           isStructOfArrays = order == Neon::MemoryLayout::structOfArrays;
+
+    std::vector<Type> leaves;
+    for (int leafComponent = 0; leafComponent < (isStructOfArrays ? cardinality : 1); leafComponent++) {
+        for (int z = 0; z < dim.z; z++) {
+            Type lanes[nLanes] = {};
+            int  i = 0;
+            for (int y = 0; y < dim.y; y++) {
+                for (int x = 0; x < dim.x; x++) {
+                    for (int c = 0; c < cardinality; c++) {
+                        if (isStructOfArrays && c != leafComponent) {
+                            continue;
+                        }
+                        const Neon::index_3d xyz(x, y, z);
+                        lanes[i % nLanes] += X.getValue(xyz, c) * Y.getValue(xyz, c);
+                        i++;
+                    }
+                }
+            }
+            leaves.push_back(Neon::ReductionModeUtils::pairwiseSum(lanes, nLanes));
+        }
+    }
+    return Neon::ReductionModeUtils::pairwiseSum(leaves.data(), leaves.size());
+}
+
 template <typename G, typename T, int C>
 auto runContainer(TestData<G, T, C>&                data,
                   const Neon::sys::patterns::Engine eng) -> void
 {
     using Type = typename TestData<G, T, C>::Type;
-    auto&             grid = data.getGrid();
-    const std::string appName = TestInformation::fullName(grid.getImplementationName());
+    auto& grid = data.getGrid();
+
+    if (data.getBackend().runtime() != Neon::Runtime::openmp) {
+        // Reductions are available only on the openmp runtime
+        return;
+    }
 
-    data.resetValuesToLinear(1, 100);
+    // Small integer values keep the reductions exact in floating point
+    data.resetValuesToRandom(1, 50);
 
-    Type neonRes = 0;
-    Type goldenRes = 0;
-    {  // NEON
-        const Neon::index_3d        dim = grid.getDimension();
-        std::vector<Neon::index_3d> elements;
+    Type goldenDot = 0;
+    Type goldenNorm2 = 0;
+    {  // Golden data
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+        data.dot(X, Y, &goldenDot);
+        data.dot(X, X, &goldenNorm2);
+        goldenNorm2 = std::sqrt(goldenNorm2);
+    }
 
-        data.getGrid().setReduceEngine(eng);
+    grid.setReduceEngine(eng);
+    auto& X = data.getField(FieldNames::X);
+    auto& Y = data.getField(FieldNames::Y);
+    auto  scalar = grid.template newPatternScalar<Type>();
 
-        data.resetValuesToConst(1);
+    auto dotContainer = grid.dot("GridDot", X, Y, scalar);
+    auto norm2Container = grid.norm2("GridNorm2", X, scalar, Neon::Execution::device);
 
-        auto& X = data.getField(FieldNames::X);
-        auto  scalar = data.getGrid().template newPatternScalar<Type>();
-        auto  norm2_container = data.getGrid().norm2("GridNorm2", X, scalar, Neon::Execution::device);
-        norm2_container.run(Neon::Backend::mainStreamIdx);
-        data.getBackend().sync(0);
+    {  // STANDARD data view
+        dotContainer.run(Neon::Backend::mainStreamIdx);
+        ASSERT_EQ(goldenDot, scalar()) << "dot on STANDARD";
+
+        norm2Container.run(Neon::Backend::mainStreamIdx);
+        ASSERT_NEAR(goldenNorm2, scalar(), goldenNorm2 * 1e-12) << "norm2 on STANDARD";
     }
 
-    {  // Golden data
-        auto& X = data.getIODomain(FieldNames::X);
+    {  // INTERNAL followed by BOUNDARY, as scheduled by OCC
+        dotContainer.run(Neon::Backend::mainStreamIdx, Neon::DataView::INTERNAL);
+        dotContainer.run(Neon::Backend::mainStreamIdx, Neon::DataView::BOUNDARY);
+        ASSERT_EQ(goldenDot, scalar(Neon::DataView::INTERNAL) + scalar(Neon::DataView::BOUNDARY)) << "dot on INTERNAL and BOUNDARY";
+        ASSERT_EQ(goldenDot, scalar()) << "dot on INTERNAL and BOUNDARY";
 
-        data.forEachActiveIODomain([&](const Neon::index_3d& ,
-                                       int                   ,
-                                       Type&                 a) {
-            auto tmp = a * a;
-#pragma omp single
-            {
-                goldenRes += tmp;
-            }
-        },
-                                   X);
+        norm2Container.run(Neon::Backend::mainStreamIdx, Neon::DataView::INTERNAL);
+        norm2Container.run(Neon::Backend::mainStreamIdx, Neon::DataView::BOUNDARY);
+        ASSERT_NEAR(goldenNorm2, scalar(), goldenNorm2 * 1e-12) << "norm2 on INTERNAL and BOUNDARY";
     }
 
-    ASSERT_TRUE(goldenRes == neonRes) << "goldenRes " << goldenRes << " neonRes " << neonRes;
+    if constexpr (!std::is_same_v<G, Neon::dGrid>) {
+        // Sparse grids do not have a partitioning-independent leaf decomposition
+        scalar.setReductionMode(Neon::ReductionMode::deterministic);
+        ASSERT_ANY_THROW(dotContainer.run(Neon::Backend::mainStreamIdx)) << "deterministic dot on a sparse grid";
+        scalar.setReductionMode(Neon::ReductionMode::fast);
+    } else {  // Deterministic mode: bitwise identical results for any number of threads and partitions
+        // Non-integer values make the result depend on the order of the sums
+        data.resetValuesToLinear(Type(0.1));
+        {
+            auto& gX = data.getIODomain(FieldNames::X);
+            auto& gY = data.getIODomain(FieldNames::Y);
+            data.dot(gX, gY, &goldenDot);
+        }
+        scalar.setReductionMode(Neon::ReductionMode::deterministic);
+
+        const int maxThreads = omp_get_max_threads();
+        // The reference does not depend on the number of partitions of the grid
+        const Type reference = deterministicDotReference(data.getIODomain(FieldNames::X),
+                                                         data.getIODomain(FieldNames::Y),
+                                                         X.getMemoryOptions().getOrder());
+        ASSERT_NEAR(goldenDot, reference, std::abs(goldenDot) * 1e-12);
+
+        for (int nThreads : {1, 3, maxThreads}) {
+            omp_set_num_threads(nThreads);
+            dotContainer.run(Neon::Backend::mainStreamIdx);
+            ASSERT_EQ(reference, scalar()) << "deterministic dot on STANDARD with " << nThreads << " threads";
+
+            dotContainer.run(Neon::Backend::mainStreamIdx, Neon::DataView::INTERNAL);
+            dotContainer.run(Neon::Backend::mainStreamIdx, Neon::DataView::BOUNDARY);
+            ASSERT_EQ(reference, scalar()) << "deterministic dot on INTERNAL and BOUNDARY with " << nThreads << " threads";
+        }
+        omp_set_num_threads(maxThreads);
+
+        scalar.setReductionMode(Neon::ReductionMode::fast);
+    }
 }
 
-template auto runContainer<Neon::domain::details::dGrid::dGrid, int64_t, 0>(TestData<Neon::domain::details::dGrid::dGrid, int64_t, 0>&,
+template auto runContainer<Neon::domain::details::dGrid::dGrid, double, 0>(TestData<Neon::domain::details::dGrid::dGrid, double, 0>&,
                                                                                   const Neon::sys::patterns::Engine eng) -> void;
+
+template auto runContainer<Neon::eGrid, double, 0>(TestData<Neon::eGrid, double, 0>&,
+                                                   const Neon::sys::patterns::Engine eng) -> void;
+
+template auto runContainer<Neon::bGrid, double, 0>(TestData<Neon::bGrid, double, 0>&,
+                                                   const Neon::sys::patterns::Engine eng) -> void;
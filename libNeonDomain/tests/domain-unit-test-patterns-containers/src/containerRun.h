@@ -1,7 +1,7 @@
 
 #pragma once
 #include <functional>
-#include "Neon/domain/details/dGrid/dGrid.h"
+#include "Neon/domain/Grids.h"
 #include "Neon/domain/tools/TestData.h"
 
 
@@ -11,5 +11,11 @@ template <typename G, typename T, int C>
 auto runContainer(TestData<G, T, C>&                data,
                   const Neon::sys::patterns::Engine eng) -> void;
 
-extern template auto runContainer<Neon::domain::details::dGrid::dGrid, int64_t, 0>(TestData<Neon::domain::details::dGrid::dGrid, int64_t, 0>&,
+extern template auto runContainer<Neon::domain::details::dGrid::dGrid, double, 0>(TestData<Neon::domain::details::dGrid::dGrid, double, 0>&,
                                                                                          const Neon::sys::patterns::Engine eng) -> void;
+
+extern template auto runContainer<Neon::eGrid, double, 0>(TestData<Neon::eGrid, double, 0>&,
+                                                          const Neon::sys::patterns::Engine eng) -> void;
+
+extern template auto runContainer<Neon::bGrid, double, 0>(TestData<Neon::bGrid, double, 0>&,
+                                                          const Neon::sys::patterns::Engine eng) -> void;
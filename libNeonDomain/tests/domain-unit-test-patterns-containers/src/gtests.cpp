@@ -7,10 +7,10 @@
 #include "Neon/domain/details/dGrid/dGrid.h"
 
 
-TEST(domain_unit_test_patterns_containers, DISABLED_dGrid)
+TEST(domain_unit_test_patterns_containers, dGrid)
 {
     int nGpus = 3;
-    using Type = int64_t;
+    using Type = double;
 
     runAllTestConfiguration(
         std::function(runContainer<Neon::domain::details::dGrid::dGrid, Type, 0>),
@@ -20,6 +20,30 @@ TEST(domain_unit_test_patterns_containers, DISABLED_dGrid)
                             1);
 }
 
+TEST(domain_unit_test_patterns_containers, eGrid)
+{
+    int nGpus = 3;
+    using Type = double;
+
+    runAllTestConfiguration(
+        std::function(runContainer<Neon::eGrid, Type, 0>),
+        {Neon::sys::patterns::Engine::OpenMP},
+        nGpus,
+        1);
+}
+
+TEST(domain_unit_test_patterns_containers, bGrid)
+{
+    int nGpus = 1;
+    using Type = double;
+
+    runAllTestConfiguration(
+        std::function(runContainer<Neon::bGrid, Type, 0>),
+        {Neon::sys::patterns::Engine::OpenMP},
+        nGpus,
+        1);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
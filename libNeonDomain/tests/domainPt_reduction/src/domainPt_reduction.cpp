@@ -0,0 +1,155 @@
+#include <omp.h>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "Neon/Neon.h"
+
+#include "Neon/Report.h"
+
+#include "Neon/core/core.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/core/types/chrono.h"
+#include "Neon/domain/dGrid.h"
+
+int         N_PARTITIONS = 1;   // Number of partitions of the openmp backend
+int         DOMAIN_SIZE = 128;  // Number of voxels along each axis
+int         CARDINALITY = 1;    // Cardinality of the fields
+std::string LAYOUT = "soa";     // Memory layout of the fields
+int         TIMES = 10;         // Timed runs for each mode
+std::string REPORT_FILENAME = "Reduction";
+int         ARGC;
+char**      ARGV;
+
+auto runMode(Neon::set::Container&        dotContainer,
+             Neon::PatternScalar<double>& scalar,
+             Neon::ReductionMode          mode,
+             const Neon::Backend&         backend,
+             std::vector<double>&         times)
+    -> double
+{
+    scalar.setReductionMode(mode);
+
+    // Warm up
+    dotContainer.run(Neon::Backend::mainStreamIdx);
+    backend.sync(Neon::Backend::mainStreamIdx);
+
+    for (int t = 0; t < TIMES; t++) {
+        Neon::Timer_ms timer;
+        timer.start();
+        dotContainer.run(Neon::Backend::mainStreamIdx);
+        backend.sync(Neon::Backend::mainStreamIdx);
+        timer.stop();
+        times.push_back(timer.time());
+    }
+    return scalar();
+}
+
+/**
+ * Hexadecimal float string, which keeps every bit of the value
+ */
+auto toHex(double val) -> std::string
+{
+    std::ostringstream s;
+    s << std::hexfloat << val;
+    return s.str();
+}
+
+auto mean(const std::vector<double>& v) -> double
+{
+    double sum = 0;
+    for (auto x : v) {
+        sum += x;
+    }
+    return v.empty() ? 0 : sum / double(v.size());
+}
+
+/**
+ * Measures the cost of the deterministic reduction mode of dGrid::dot against the fast one.
+ * Both modes run on the same fields, the report stores the time of each run and the results,
+ * so that the reproducibility across thread and partition counts can be checked between reports.
+ */
+int reductionPerfTest()
+{
+    std::vector<int> ids(N_PARTITIONS, 0);
+    Neon::Backend    backend(ids, Neon::Runtime::openmp);
+
+    Neon::MemoryOptions memoryOptions = backend.getMemoryOptions();
+    memoryOptions.setOrder(LAYOUT == "aos" ? Neon::MemoryLayout::arrayOfStructs
+                                           : Neon::MemoryLayout::structOfArrays);
+
+    Neon::index_3d dom(DOMAIN_SIZE, DOMAIN_SIZE, DOMAIN_SIZE);
+    Neon::dGrid    grid(backend, dom, [](const Neon::index_3d&) { return true; }, Neon::domain::Stencil::s7_Laplace_t());
+
+    auto x = grid.newField<double>("x", CARDINALITY, 0, Neon::DataUse::HOST_DEVICE, memoryOptions);
+    auto y = grid.newField<double>("y", CARDINALITY, 0, Neon::DataUse::HOST_DEVICE, memoryOptions);
+    // Non-integer values, so that the result depends on the order of the sums
+    x.forEachActiveCell([&](const Neon::index_3d& idx, const int& c, double& val) {
+        val = 1.0 / (1.0 + idx.x + 3 * idx.y + 7 * idx.z + c);
+    });
+    y.forEachActiveCell([&](const Neon::index_3d& idx, const int& c, double& val) {
+        val = std::sin(0.1 * (idx.x + idx.y + idx.z + c));
+    });
+    x.updateDeviceData(Neon::Backend::mainStreamIdx);
+    y.updateDeviceData(Neon::Backend::mainStreamIdx);
+    backend.sync(Neon::Backend::mainStreamIdx);
+
+    auto scalar = grid.newPatternScalar<double>();
+    auto dotContainer = grid.dot("dot", x, y, scalar);
+
+    std::vector<double> fastTime;
+    std::vector<double> deterministicTime;
+    const double        fastResult = runMode(dotContainer, scalar, Neon::ReductionMode::fast, backend, fastTime);
+    const double        deterministicResult = runMode(dotContainer, scalar, Neon::ReductionMode::deterministic, backend, deterministicTime);
+
+    Neon::Report report("Reduction_dGrid_" + std::to_string(CARDINALITY) + "D_" + LAYOUT + "_" +
+                        std::to_string(N_PARTITIONS) + "Partitions_" + std::to_string(omp_get_max_threads()) + "Threads");
+    report.commandLine(ARGC, ARGV);
+    report.addMember("voxelDomain", dom.to_stringForComposedNames());
+    report.addMember("cardinality", CARDINALITY);
+    report.addMember("layout", LAYOUT);
+    report.addMember("numPartitions", N_PARTITIONS);
+    report.addMember("numThreads", omp_get_max_threads());
+    report.addMember("fastTime_ms", fastTime);
+    report.addMember("deterministicTime_ms", deterministicTime);
+    report.addMember("deterministicOverhead", mean(deterministicTime) / mean(fastTime));
+    report.addMember("fastResult", toHex(fastResult));
+    report.addMember("deterministicResult", toHex(deterministicResult));
+
+    std::cout << " fast: " << mean(fastTime) << " ms, result " << toHex(fastResult) << "\n";
+    std::cout << " deterministic: " << mean(deterministicTime) << " ms, result " << toHex(deterministicResult) << "\n";
+
+    report.write(REPORT_FILENAME);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    ARGC = argc;
+    ARGV = argv;
+
+    Neon::init();
+
+    auto cli =
+        (clipp::option("--partitions") & clipp::integer("partitions", N_PARTITIONS) % "Number of partitions",
+         clipp::option("--domain_size") & clipp::integer("domain_size", DOMAIN_SIZE) % "Voxels along each dimension of the cube domain",
+         clipp::option("--cardinality") & clipp::integer("cardinality", CARDINALITY) % "Cardinality of the fields",
+         clipp::option("--layout") & clipp::value("layout", LAYOUT) % "Could be soa or aos",
+         clipp::option("--times") & clipp::integer("times", TIMES) % "Timed runs for each reduction mode",
+         clipp::option("--report_filename") & clipp::value("report_filename", REPORT_FILENAME) % "Output report filename");
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        return -1;
+    }
+    std::cout << " partitions= " << N_PARTITIONS << "\n";
+    std::cout << " threads= " << omp_get_max_threads() << "\n";
+    std::cout << " domain_size= " << DOMAIN_SIZE << "\n";
+    std::cout << " cardinality= " << CARDINALITY << "\n";
+    std::cout << " layout= " << LAYOUT << "\n";
+    std::cout << " times= " << TIMES << "\n";
+
+    return reductionPerfTest();
+}
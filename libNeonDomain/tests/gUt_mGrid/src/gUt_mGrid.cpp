@@ -47,6 +47,121 @@ TEST(mGrid, multiRes)
     }
 }
 
+TEST(mGrid, adapt)
+{
+    if (Neon::sys::globalSpace::gpuSysObjStorage.numDevs() > 0) {
+        int              nGPUs = 1;
+        Neon::int32_3d   dim(16, 16, 16);
+        std::vector<int> gpusIds(nGPUs, 0);
+        auto             bk = Neon::Backend(gpusIds, Neon::Runtime::stream);
+
+        Neon::mGridDescriptor<1> descr(2);
+
+        //start from level 1 voxels everywhere except a fine slab at x >= 14 that is never adapted
+        Neon::domain::mGrid grid(
+            bk,
+            dim,
+            {[&](const Neon::index_3d& id) -> bool {
+                 return id.x >= 14;
+             },
+             [&](const Neon::index_3d&) -> bool {
+                 return true;
+             }},
+            Neon::domain::Stencil::s7_Laplace_t(),
+            descr);
+
+        auto field = grid.newField<float>("myField", 1, -1);
+        field.forEachActiveCell(
+            1,
+            [&](const Neon::int32_3d idx, const int /*card*/, float& val) {
+                val = float(idx.x);
+            },
+            false,
+            Neon::computeMode_t::computeMode_e::seq);
+
+        //refine the half of the domain x < 8
+        auto flags = grid.newField<int8_t>("flags", 1, 0);
+        flags.forEachActiveCell(
+            1,
+            [&](const Neon::int32_3d idx, const int /*card*/, int8_t& val) {
+                val = (idx.x < 8) ? 1 : 0;
+            },
+            false,
+            Neon::computeMode_t::computeMode_e::seq);
+
+        Neon::domain::mGrid fineGrid = grid.adapt(flags);
+        auto                fineField = fineGrid.migrateField(field);
+
+        //the refinement rebuilds the finest level
+        EXPECT_NE(fineGrid(0).getGridUID(), grid(0).getGridUID());
+
+        for (int z = 0; z < dim.z; ++z) {
+            for (int y = 0; y < dim.y; ++y) {
+                for (int x = 0; x < dim.x; ++x) {
+                    const Neon::index_3d voxel(x, y, z);
+                    EXPECT_EQ(fineGrid.isInsideDomain(voxel, 0), x < 8 || x >= 14);
+                    if (x < 8) {
+                        //explosion copies the value of the parent
+                        EXPECT_EQ(fineField(voxel, 0, 0), float(x - x % 2));
+                    }
+                }
+            }
+        }
+
+        //coarsen the refined half back
+        fineField.forEachActiveCell(
+            0,
+            [&](const Neon::int32_3d /*idx*/, const int /*card*/, float& val) {
+                val = 100;
+            },
+            false,
+            Neon::computeMode_t::computeMode_e::seq);
+
+        auto fineFlags = fineGrid.newField<int8_t>("flags", 1, 0);
+        fineFlags.forEachActiveCell(
+            0,
+            [&](const Neon::int32_3d idx, const int /*card*/, int8_t& val) {
+                val = (idx.x < 8) ? -1 : 0;
+            },
+            false,
+            Neon::computeMode_t::computeMode_e::seq);
+
+        //no flag is set: no level is touched and all of them are shared with the fine grid
+        auto noFlags = fineGrid.newField<int8_t>("noFlags", 1, 0);
+        for (int l = 0; l < descr.getDepth(); ++l) {
+            noFlags.forEachActiveCell(
+                l,
+                [&](const Neon::int32_3d /*idx*/, const int /*card*/, int8_t& val) {
+                    val = 0;
+                },
+                false,
+                Neon::computeMode_t::computeMode_e::seq);
+        }
+        Neon::domain::mGrid sameGrid = fineGrid.adapt(noFlags);
+        for (int l = 0; l < descr.getDepth(); ++l) {
+            EXPECT_EQ(sameGrid(l).getGridUID(), fineGrid(l).getGridUID());
+        }
+
+        Neon::domain::mGrid coarseGrid = fineGrid.adapt(fineFlags);
+        auto                coarseField = coarseGrid.migrateField(fineField);
+
+        for (int z = 0; z < dim.z; z += 2) {
+            for (int y = 0; y < dim.y; y += 2) {
+                for (int x = 0; x < dim.x; x += 2) {
+                    const Neon::index_3d voxel(x, y, z);
+                    EXPECT_EQ(coarseGrid.isInsideDomain(voxel, 0), x >= 14);
+                    if (x < 8) {
+                        EXPECT_TRUE(coarseGrid.isInsideDomain(voxel, 1));
+                        //coalescence averages the children of the voxels that were culled on the fine grid
+                        const float expected = fineGrid.isInsideDomain(voxel, 1) ? fineField(voxel, 0, 1) : 100.f;
+                        EXPECT_EQ(coarseField(voxel, 0, 1), expected);
+                    }
+                }
+            }
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -10,6 +10,7 @@
 #include "Neon/Report.h"
 #include "Neon/core/core.h"
 #include "Neon/set/MemoryOptions.h"
+#include "Neon/set/OmpLaunchConfig.h"
 #include "Neon/set/Runtime.h"
 // #include "Neon/core/types/mode.h"
 // #include "Neon/core/types/devType.h"
@@ -22,6 +23,8 @@ namespace set {
 class DevSet;
 class StreamSet;
 class GpuEventSet;
+class CpuStream;
+class CpuEvent;
 }  // namespace set
 class Backend
 {
@@ -39,6 +42,16 @@ class Backend
         std::vector<Neon::set::GpuEventSet> userEventSetVec;
 
         std::shared_ptr<Neon::set::DevSet> devSet;
+
+        Neon::set::OmpPartitionMode ompPartitionMode{Neon::set::OmpPartitionMode::sequential};
+        int                         ompThreadsPerPartition{0};
+
+        Neon::set::OmpLaunchConfig ompLaunchConfig;
+
+        Neon::set::OmpStreamMode                           ompStreamMode{Neon::set::OmpStreamMode::synchronous};
+        int                                                ompThreadsPerStream{0};
+        std::vector<std::shared_ptr<Neon::set::CpuStream>> cpuStreamVec;
+        std::vector<std::shared_ptr<Neon::set::CpuEvent>>  cpuEventVec;
     };
     auto selfData() -> Data_t&;
     auto selfData() const -> const Data_t&;
@@ -166,6 +179,79 @@ class Backend
     auto runMode(Neon::run_et ::et)
         -> void;
 
+    /**
+     * Set how the partitions of an OpenMP backend are executed.
+     * In concurrent mode each partition runs on its own OpenMP team of threadsPerPartition threads.
+     * A threadsPerPartition of zero splits the available threads evenly among the partitions.
+     */
+    auto setOmpPartitionMode(Neon::set::OmpPartitionMode mode,
+                             int                         threadsPerPartition = 0)
+        -> void;
+
+    /**
+     * Returns how the partitions of an OpenMP backend are executed.
+     */
+    auto ompPartitionMode()
+        const
+        -> Neon::set::OmpPartitionMode;
+
+    /**
+     * Returns the number of threads of the team associated to each partition in concurrent mode.
+     */
+    auto ompThreadsPerPartition()
+        const
+        -> int;
+
+    /**
+     * Set the tiling and schedule used by the OpenMP launchers.
+     * It is the default for the Containers created afterwards, a Container can override it
+     * through Container::setOmpLaunchConfig.
+     */
+    auto setOmpLaunchConfig(const Neon::set::OmpLaunchConfig& ompLaunchConfig)
+        -> void;
+
+    /**
+     * Returns the default tiling and schedule used by the OpenMP launchers.
+     */
+    auto ompLaunchConfig()
+        const
+        -> const Neon::set::OmpLaunchConfig&;
+
+    /**
+     * Set the semantic of the streams of an OpenMP backend.
+     * In asynchronous mode every stream but the main one is backed by a worker thread,
+     * and events are host completion flags used to order work across workers.
+     * Each worker runs its parallel regions with threadsPerStream threads.
+     * A threadsPerStream of zero splits the available threads evenly among the streams.
+     */
+    auto setOmpStreamMode(Neon::set::OmpStreamMode mode,
+                          int                      threadsPerStream = 0)
+        -> void;
+
+    /**
+     * Returns the semantic of the streams of an OpenMP backend.
+     */
+    auto ompStreamMode()
+        const
+        -> Neon::set::OmpStreamMode;
+
+    /**
+     * Returns the number of OpenMP threads used by each stream worker in asynchronous mode.
+     */
+    auto ompThreadsPerStream()
+        const
+        -> int;
+
+    /**
+     * Executes task on the stream streamIdx.
+     * On an asynchronous OpenMP backend the task is enqueued on the stream worker,
+     * unless streamIdx is the main stream or the caller is already the stream worker.
+     * In all the other configurations the task is executed by the calling thread.
+     */
+    auto runOnStream(int streamIdx, std::function<void()> task)
+        const
+        -> void;
+
     /**
      *
      * @param streamIdx
@@ -291,6 +377,19 @@ class Backend
     void syncEvent(SetIdx setIdx, int eventIdx) const;
 
    private:
+    /**
+     * Returns the worker backing the stream, or nullptr if the stream is executed by the calling thread.
+     */
+    auto helpGetCpuStream(int streamIdx)
+        const
+        -> Neon::set::CpuStream*;
+
+    /**
+     * Creates or releases the stream workers according to the current stream mode.
+     */
+    auto helpUpdateCpuStreams()
+        -> void;
+
     auto helpDeviceToDeviceTransferByte(int                     streamId,
                                         size_t                  bytes,
                                         Neon::set::TransferMode transferMode,
@@ -78,6 +78,24 @@ struct Container
                             std::function<int(const index_3d& blockSize)>      shMemSizeFun /**< User's function to implicitly compute the required shared memory */)
         -> Container;
 
+    /**
+     * Factory function to create a Container reducing the values returned by the user's compute lambda on each cell
+     */
+    template <Neon::Execution execution,
+              typename DataContainerT,
+              typename UserLoadingLambdaT,
+              typename T,
+              typename CombineOpT>
+    static auto factoryReduce(const std::string&                                 name /**< A user's string to identify the computation done by the Container. */,
+                              Neon::set::internal::ContainerAPI::DataViewSupport dataViewSupport /**< Defines the data view support for the new Container */,
+                              const DataContainerT&                              a /**< Multi device object that will be used for the creating of the Container */,
+                              const UserLoadingLambdaT&                          f /**< User's loading lambda, its compute lambda returns the value of a cell */,
+                              const index_3d&                                    blockSize /**< Block size defining the launch parameters */,
+                              const T&                                           identity /**< Identity element of combineOp */,
+                              CombineOpT                                         combineOp /**< Binary operation combining two values */,
+                              std::function<void(Neon::DataView, const T&)>      resultWriter /**< Receives the result of each run */)
+        -> Container;
+
     /**
      * Factory function to generate a kContainer object.
      * @tparam A: the type of the structure managing the iterator
@@ -117,6 +135,22 @@ struct Container
                              const container::Graph&                    graph,
                              std::function<void(Neon::SetIdx, Loader&)> loadingLambda) -> Container;
 
+    /**
+     * Factory function to create a Container that runs a sequence of map Containers in a single traversal.
+     */
+    static auto factoryFusedMap(const std::string&            name /**< A user's string to identify the computation done by the Container. */,
+                                int                           setCardinality /**< Number of partitions of the fused Containers */,
+                                const std::vector<Container>& containers /**< Map Containers to be fused, in execution order */)
+        -> Container;
+
+    /**
+     * Factory function to create a Container that runs a sequence of map and stencil Containers as a wavefront (temporal blocking).
+     */
+    static auto factoryWavefront(const std::string&            name /**< A user's string to identify the computation done by the Container. */,
+                                 int                           setCardinality /**< Number of partitions of the Containers */,
+                                 const std::vector<Container>& containers /**< Containers of the sequence, in execution order */)
+        -> Container;
+
     static auto factoryDeviceThenHostManaged(const std::string& name,
                                              Container&         device,
                                              Container&         host)
@@ -158,6 +192,28 @@ struct Container
     auto getContainerExecutionType() const
         -> Neon::set::ContainerExecutionType;
 
+    /**
+     * Enables or disables the reuse of the compute lambdas extracted in previous runs (disabled by default).
+     * Only enable it when the loading lambda does not read host values that change in between runs:
+     * with the cache the loading lambda runs again only after one of the fields it loads is assigned or swapped.
+     */
+    auto setComputeLambdaCache(bool enabled)
+        -> Container&;
+
+    /**
+     * Set the tiling and schedule used by the OpenMP launchers when running this Container.
+     * It only affects the compute Containers created by a grid.
+     */
+    auto setOmpLaunchConfig(const Neon::set::OmpLaunchConfig& ompLaunchConfig)
+        -> Container&;
+
+    /**
+     * Runs the active voxels of bGrid blocks as omp simd loops (disabled by default).
+     * Only enable it when the compute lambda has no dependency between voxels.
+     */
+    auto setOmpSimd(bool enabled)
+        -> Container&;
+
    protected:
     std::shared_ptr<Neon::set::internal::ContainerAPI> mContainer;
 
@@ -15,6 +15,7 @@
 #include "Neon/set/container/HostContainer.h"
 #include "Neon/set/container/HostManagedContainer.h"
 #include "Neon/set/container/OldDeviceManagedContainer.h"
+#include "Neon/set/container/ReduceContainer.h"
 #include "Neon/set/container/SynchronizationContainer.h"
 
 
@@ -68,6 +69,35 @@ auto Container::hostFactory(const std::string&                                 n
     return {tmp};
 }
 
+template <Neon::Execution execution,
+          typename DataContainerT,
+          typename UserLoadingLambdaT,
+          typename T,
+          typename CombineOpT>
+auto Container::factoryReduce(const std::string&                                 name,
+                              Neon::set::internal::ContainerAPI::DataViewSupport dataViewSupport,
+                              const DataContainerT&                              a,
+                              const UserLoadingLambdaT&                          f,
+                              const index_3d&                                    blockSize,
+                              const T&                                           identity,
+                              CombineOpT                                         combineOp,
+                              std::function<void(Neon::DataView, const T&)>      resultWriter)
+    -> Container
+{
+    using ComputeLambda = typename std::invoke_result<decltype(f), Neon::set::Loader&>::type;
+    auto k = new Neon::set::internal::ReduceContainer<DataContainerT, ComputeLambda, T, CombineOpT>(name,
+                                                                                                   execution,
+                                                                                                   dataViewSupport,
+                                                                                                   a, f,
+                                                                                                   blockSize,
+                                                                                                   identity,
+                                                                                                   combineOp,
+                                                                                                   resultWriter);
+
+    std::shared_ptr<Neon::set::internal::ContainerAPI> tmp(k);
+    return {tmp};
+}
+
 template <typename DataContainerT,
           typename UserLoadingLambdaT>
 auto Container::factoryOldManaged(const std::string&                                 name,
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Neon::set {
+
+/**
+ * Host equivalent of a CUDA stream for the OpenMP runtime.
+ *
+ * A CpuStream owns a worker thread that executes the enqueued tasks in FIFO order.
+ * Tasks enqueued on different CpuStream objects run concurrently.
+ * Exceptions raised by a task are captured and re-thrown by the next call to sync().
+ */
+class CpuStream
+{
+   public:
+    CpuStream();
+
+    CpuStream(const CpuStream&) = delete;
+    CpuStream& operator=(const CpuStream&) = delete;
+
+    /**
+     * Waits for all the pending tasks and stops the worker thread
+     */
+    ~CpuStream();
+
+    /**
+     * Adds a task at the end of the stream queue
+     */
+    auto enqueue(std::function<void()> task) -> void;
+
+    /**
+     * Blocks the calling thread until all the tasks enqueued so far have been completed.
+     */
+    auto sync() -> void;
+
+    /**
+     * Returns true if the calling thread is the worker of this stream
+     */
+    auto isWorkerThread() const -> bool;
+
+    /**
+     * Sets the number of OpenMP threads used by the parallel regions opened by the worker.
+     * A value of zero keeps the OpenMP default.
+     */
+    auto setNumThreads(int numThreads) -> void;
+
+   private:
+    /**
+     * State shared by the stream and its worker.
+     * The worker owns a reference, so the state outlives the stream
+     * when the stream is destroyed by one of its own tasks.
+     */
+    struct State
+    {
+        std::mutex                        mutex;
+        std::condition_variable           workCondition;
+        std::condition_variable           idleCondition;
+        std::deque<std::function<void()>> queue;
+        bool                              busy{false};
+        bool                              stop{false};
+        std::exception_ptr                error;
+        std::atomic<int>                  numThreads{0};
+    };
+
+    static auto helpWorkerLoop(std::shared_ptr<State> state) -> void;
+
+    std::shared_ptr<State> mState;
+    std::thread            mWorker;
+};
+
+/**
+ * Host equivalent of a CUDA event for the OpenMP runtime.
+ *
+ * The event is a monotonic completion counter: record() reserves a new epoch on the submitting thread,
+ * signal() marks the epoch as completed once the stream reaches it, and wait() blocks until a given epoch is completed.
+ */
+class CpuEvent
+{
+   public:
+    CpuEvent() = default;
+
+    CpuEvent(const CpuEvent&) = delete;
+    CpuEvent& operator=(const CpuEvent&) = delete;
+
+    /**
+     * Reserves a new epoch. The returned value is the one that has to be signaled.
+     */
+    auto record() -> uint64_t;
+
+    /**
+     * Returns the last recorded epoch
+     */
+    auto recorded() const -> uint64_t;
+
+    /**
+     * Marks all the epochs up to epoch as completed
+     */
+    auto signal(uint64_t epoch) -> void;
+
+    /**
+     * Blocks until the epoch has been completed
+     */
+    auto wait(uint64_t epoch) -> void;
+
+   private:
+    std::atomic<uint64_t>   mRecorded{0};
+    std::atomic<uint64_t>   mCompleted{0};
+    std::mutex              mMutex;
+    std::condition_variable mCondition;
+};
+
+}  // namespace Neon::set
@@ -19,6 +19,7 @@
 #include "Neon/set/KernelConfig.h"
 #include "Neon/set/LambdaExecutor.h"
 #include "Neon/set/LaunchParameters.h"
+#include "Neon/set/OmpNestedScope.h"
 #include "Neon/set/Transfer.h"
 #include "Neon/set/memory/memDevSet.h"
 #include "Neon/set/memory/memSet.h"
@@ -459,37 +460,58 @@ class DevSet
     {
         const LaunchParameters& launchInfoSet = kernelConfig.launchInfoSet();
         const int               nGpus = static_cast<int>(m_devIds.size());
-        {
+
+        auto launchOnPartition = [&](int idx) {
             if constexpr (!details::ExecutionThreadSpanUtils::isBlockSpan(DataSetContainer::executionThreadSpan)) {
-                for (int idx = 0; idx < nGpus; idx++) {
-                    auto   iterator = dataSetContainer.getSpan(execution,
-                                                               idx,
-                                                               kernelConfig.dataView());
-                    Lambda lambda = lambdaHolder(idx, kernelConfig.dataView());
-                    using IndexType = typename DataSetContainer::ExecutionThreadSpanIndexType;
-                    Neon::set::details::denseSpan::
-                        launchLambdaOnSpanOMP<IndexType,
-                                              DataSetContainer,
-                                              Lambda>(launchInfoSet[idx].domainGrid().newType<IndexType>(),
-                                                      iterator,
-                                                      lambda);
-                }
+                auto   iterator = dataSetContainer.getSpan(execution,
+                                                           idx,
+                                                           kernelConfig.dataView());
+                Lambda lambda = lambdaHolder(idx, kernelConfig.dataView());
+                using IndexType = typename DataSetContainer::ExecutionThreadSpanIndexType;
+                Neon::set::details::denseSpan::
+                    launchLambdaOnSpanOMP<IndexType,
+                                          DataSetContainer,
+                                          Lambda>(launchInfoSet[idx].domainGrid().newType<IndexType>(),
+                                                  launchInfoSet.ompLaunchConfig(),
+                                                  iterator,
+                                                  lambda);
             } else {
-                for (int idx = 0; idx < nGpus; idx++) {
-                    auto   iterator = dataSetContainer.getSpan(execution, idx, kernelConfig.dataView());
-                    Lambda lambda = lambdaHolder(idx, kernelConfig.dataView());
-                    using IndexType = typename DataSetContainer::ExecutionThreadSpanIndexType;
-
-                    auto const&                       cudaBlock = launchInfoSet[idx].cudaBlock();
-                    auto const&                       cudaGrid = launchInfoSet[idx].cudaGrid();
-                    const Neon::Integer_3d<IndexType> blockSize(cudaBlock.x, cudaBlock.y, cudaBlock.z);
-                    const Neon::Integer_3d<IndexType> gridSize(cudaGrid.x, cudaGrid.y, cudaGrid.z);
-
-                    Neon::set::details::blockSpan::launchLambdaOnSpanOMP<IndexType,
-                                                                         DataSetContainer,
-                                                                         Lambda>(blockSize, gridSize, iterator, lambda);
+                auto   iterator = dataSetContainer.getSpan(execution, idx, kernelConfig.dataView());
+                Lambda lambda = lambdaHolder(idx, kernelConfig.dataView());
+                using IndexType = typename DataSetContainer::ExecutionThreadSpanIndexType;
+
+                auto const&                       cudaGrid = launchInfoSet[idx].cudaGrid();
+                const Neon::Integer_3d<IndexType> gridSize(cudaGrid.x, cudaGrid.y, cudaGrid.z);
+
+                Neon::set::details::blockSpan::launchLambdaOnSpanOMP<IndexType,
+                                                                     DataSetContainer,
+                                                                     Lambda>(gridSize,
+                                                                             launchInfoSet.ompLaunchConfig(),
+                                                                             iterator,
+                                                                             lambda);
+            }
+        };
+
+        const Neon::Backend& bk = kernelConfig.backend();
+        if (nGpus > 1 && bk.ompPartitionMode() == Neon::set::OmpPartitionMode::concurrent) {
+            // One outer thread per partition, each one leading a nested team of threadsPerPartition threads.
+            const int                 threadsPerPartition = bk.ompThreadsPerPartition();
+            Neon::set::OmpNestedScope nestedScope;
+#pragma omp parallel num_threads(nGpus) default(shared)
+            {
+                // Only affects the parallel regions opened by this outer thread
+                omp_set_num_threads(threadsPerPartition);
+                // The outer team may be smaller than requested (e.g. when nested parallelism is exhausted):
+                // partitions are then distributed over the threads that are available.
+                for (int idx = omp_get_thread_num(); idx < nGpus; idx += omp_get_num_threads()) {
+                    launchOnPartition(idx);
                 }
             }
+            return;
+        }
+
+        for (int idx = 0; idx < nGpus; idx++) {
+            launchOnPartition(idx);
         }
         return;
     }
@@ -518,18 +540,22 @@ class DevSet
             using IndexType = typename DataSetContainer::ExecutionThreadSpanIndexType;
             Neon::set::details::denseSpan::launchLambdaOnSpanOMP<IndexType,
                                                                  DataSetContainer,
-                                                                 Lambda>(launchInfoSet[setIdx].domainGrid().newType<IndexType>(), iterator, lambda);
+                                                                 Lambda>(launchInfoSet[setIdx].domainGrid().newType<IndexType>(),
+                                                                         launchInfoSet.ompLaunchConfig(),
+                                                                         iterator,
+                                                                         lambda);
         } else {
             using IndexType = typename DataSetContainer::ExecutionThreadSpanIndexType;
 
-            auto const&                       cudaBlock = launchInfoSet[setIdx].cudaBlock();
             auto const&                       cudaGrid = launchInfoSet[setIdx].cudaGrid();
-            const Neon::Integer_3d<IndexType> blockSize(cudaBlock.x, cudaBlock.y, cudaBlock.z);
             const Neon::Integer_3d<IndexType> gridSize(cudaGrid.x, cudaGrid.y, cudaGrid.z);
 
             Neon::set::details::blockSpan::launchLambdaOnSpanOMP<IndexType,
                                                                  DataSetContainer,
-                                                                 Lambda>(blockSize, gridSize, iterator, lambda);
+                                                                 Lambda>(gridSize,
+                                                                         launchInfoSet.ompLaunchConfig(),
+                                                                         iterator,
+                                                                         lambda);
         }
         return;
     }
@@ -629,7 +655,8 @@ class DevSet
                       Neon::DeviceType                    devType,
                       const Neon::Allocator&              allocType,
                       const Neon::set::DataSet<uint64_t>& nElementVec,
-                      Neon::MemoryLayout                  order = Neon::MemoryLayout::structOfArrays) const
+                      Neon::MemoryLayout                  order = Neon::MemoryLayout::structOfArrays,
+                      const Neon::sys::FirstTouchTiling&  firstTouchTiling = Neon::sys::FirstTouchTiling()) const
         -> MemDevSet<T_ta>
     {
         if (m_devType != Neon::DeviceType::CUDA &&
@@ -656,7 +683,8 @@ class DevSet
                                        devType,
                                        idVec,
                                        std::forward<const Neon::Allocator>(allocType),
-                                       nElementVec);
+                                       nElementVec,
+                                       firstTouchTiling);
             }
             default: {
                 Neon::NeonException exp("GpuSet");
@@ -677,7 +705,11 @@ class DevSet
 
         Neon::set::MemSet<T_ta> mirror(this->setCardinality());
 
-        MemDevSet<T_ta> memCpu = newMemDevSet<T_ta>(cardinality, Neon::DeviceType::CPU, memoryOptions.getIOAllocator(dataUse), nElementVec, memoryOptions.getOrder());
+        // Only the buffers computed on by the OpenMP runtime are first touched, not the host mirrors of GPU buffers
+        Neon::sys::FirstTouchTiling firstTouchTiling = memoryOptions.getFirstTouchTiling();
+        firstTouchTiling.enabled = m_devType == Neon::DeviceType::CPU;
+
+        MemDevSet<T_ta> memCpu = newMemDevSet<T_ta>(cardinality, Neon::DeviceType::CPU, memoryOptions.getIOAllocator(dataUse), nElementVec, memoryOptions.getOrder(), firstTouchTiling);
         MemDevSet<T_ta> memGpu = newMemDevSet<T_ta>(cardinality, Neon::DeviceType::CUDA, memoryOptions.getDeviceAllocator(dataUse), nElementVec, memoryOptions.getOrder());
 
         mirror.link(memCpu);
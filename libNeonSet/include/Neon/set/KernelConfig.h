@@ -70,6 +70,11 @@ class KernelConfig
      */
     auto launchInfoSet() const -> const LaunchParameters&;
 
+    /**
+     * Return const reference to the tiling and schedule used by the OpenMP launchers
+     */
+    auto ompLaunchConfig() const -> const OmpLaunchConfig&;
+
     auto runMode() const -> Neon::run_et::et;
 
     /**
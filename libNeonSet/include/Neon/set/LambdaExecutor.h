@@ -1,6 +1,12 @@
 #pragma once
+#include <algorithm>
 #include <functional>
+#include <vector>
+
+#include <omp.h>
+
 #include "Neon/set/ExecutionThreadSpan.h"
+#include "Neon/set/OmpLaunchConfig.h"
 
 namespace Neon::set::details {
 
@@ -39,10 +45,56 @@ NEON_CUDA_KERNEL auto launchLambdaOnSpanCUDA(typename DataSetContainer::Span spa
 #endif
 
 
+/**
+ * Runs all the cells of a tile [begin, end) of a span.
+ * The inner x loop is kept contiguous so that the compiler can vectorize it.
+ * For d1 spans only the x components of the tile are used.
+ */
+template <typename IndexType,
+          typename DataSetContainer,
+          typename UserLambda_ta>
+inline void launchLambdaOnTileOMP(Neon::Integer_3d<IndexType> const&     begin,
+                                  Neon::Integer_3d<IndexType> const&     end,
+                                  typename DataSetContainer::Span const& span,
+                                  UserLambda_ta&                         userLambdaTa)
+{
+    if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d1) {
+        for (IndexType x = begin.x; x < end.x; x++) {
+            typename DataSetContainer::Idx e;
+            if (span.setAndValidate(e, x)) {
+                userLambdaTa(e);
+            }
+        }
+    }
+    if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d2) {
+        for (IndexType y = begin.y; y < end.y; y++) {
+            for (IndexType x = begin.x; x < end.x; x++) {
+                typename DataSetContainer::Idx e;
+                if (span.setAndValidate(e, x, y)) {
+                    userLambdaTa(e);
+                }
+            }
+        }
+    }
+    if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d3) {
+        for (IndexType z = begin.z; z < end.z; z++) {
+            for (IndexType y = begin.y; y < end.y; y++) {
+                for (IndexType x = begin.x; x < end.x; x++) {
+                    typename DataSetContainer::Idx e;
+                    if (span.setAndValidate(e, x, y, z)) {
+                        userLambdaTa(e);
+                    }
+                }
+            }
+        }
+    }
+}
+
 template <typename IndexType,
           typename DataSetContainer,
           typename UserLambda_ta>
 void launchLambdaOnSpanOMP(Neon::Integer_3d<IndexType> const&     gridDim,
+                           Neon::set::OmpLaunchConfig const&      ompLaunchConfig,
                            typename DataSetContainer::Span const& span,
                            UserLambda_ta                          userLambdaTa)
 {
@@ -60,40 +112,135 @@ void launchLambdaOnSpanOMP(Neon::Integer_3d<IndexType> const&     gridDim,
         }
     }
 
+    if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d2 ||
+                  DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d3) {
+        // The d2 span ignores the z component
+        Neon::Integer_3d<IndexType> dim = gridDim;
+        if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d2) {
+            dim.z = 1;
+        }
+        if (dim.x <= 0 || dim.y <= 0 || dim.z <= 0) {
+            return;
+        }
+        const Neon::Integer_3d<IndexType> tile = ompLaunchConfig.getTile(dim);
+        const Neon::Integer_3d<IndexType> nTiles((dim.x + tile.x - 1) / tile.x,
+                                                 (dim.y + tile.y - 1) / tile.y,
+                                                 (dim.z + tile.z - 1) / tile.z);
+        // A single flat loop over the tiles: it does not require collapse,
+        // which is not available in the OpenMP version supported on Windows.
+        const int nTotalTiles = static_cast<int>(nTiles.template rMulTyped<int64_t>());
+        const int chunk = ompLaunchConfig.chunk();
 
-    if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d2) {
-#ifdef NEON_OS_WINDOWS
-#pragma omp parallel for default(shared)
-#else
-// #pragma omp parallel for simd collapse(2) default(shared)
-#endif
-        for (IndexType y = 0; y < gridDim.y; y++) {
-            for (IndexType x = 0; x < gridDim.x; x++) {
-                typename DataSetContainer::Idx e;
-                if (span.setAndValidate(e, x, y)) {
-                    userLambdaTa(e);
+        auto runTile = [&](int tileIdx) {
+            const IndexType tx = IndexType(tileIdx % nTiles.x);
+            const IndexType ty = IndexType((tileIdx / nTiles.x) % nTiles.y);
+            const IndexType tz = IndexType(tileIdx / (nTiles.x * nTiles.y));
+
+            const Neon::Integer_3d<IndexType> begin(tx * tile.x, ty * tile.y, tz * tile.z);
+            const Neon::Integer_3d<IndexType> end(std::min(IndexType(begin.x + tile.x), dim.x),
+                                                  std::min(IndexType(begin.y + tile.y), dim.y),
+                                                  std::min(IndexType(begin.z + tile.z), dim.z));
+            launchLambdaOnTileOMP<IndexType, DataSetContainer>(begin, end, span, userLambdaTa);
+        };
+
+        switch (ompLaunchConfig.schedule()) {
+            case Neon::set::OmpSchedule::staticSchedule: {
+#pragma omp parallel for default(shared) schedule(static, chunk)
+                for (int tileIdx = 0; tileIdx < nTotalTiles; tileIdx++) {
+                    runTile(tileIdx);
                 }
+                return;
+            }
+            case Neon::set::OmpSchedule::dynamicSchedule: {
+#pragma omp parallel for default(shared) schedule(dynamic, chunk)
+                for (int tileIdx = 0; tileIdx < nTotalTiles; tileIdx++) {
+                    runTile(tileIdx);
+                }
+                return;
+            }
+            case Neon::set::OmpSchedule::guidedSchedule: {
+#pragma omp parallel for default(shared) schedule(guided, chunk)
+                for (int tileIdx = 0; tileIdx < nTotalTiles; tileIdx++) {
+                    runTile(tileIdx);
+                }
+                return;
             }
         }
     }
+}
+/**
+ * Reduces the values returned by userLambdaTa on all the cells of a span.
+ *
+ * Each OpenMP thread combines the values of its tiles into a private partial result,
+ * then the partial results are combined in thread order.
+ * The static schedule makes the result reproducible for a given number of threads,
+ * also when combineOp is not associative (e.g. floating point sums).
+ */
+template <typename IndexType,
+          typename DataSetContainer,
+          typename T,
+          typename CombineOp,
+          typename UserLambda_ta>
+auto reduceLambdaOnSpanOMP(Neon::Integer_3d<IndexType> const&     gridDim,
+                           Neon::set::OmpLaunchConfig const&      ompLaunchConfig,
+                           typename DataSetContainer::Span const& span,
+                           T const&                               identity,
+                           CombineOp                              combineOp,
+                           UserLambda_ta                          userLambdaTa)
+    -> T
+{
+    Neon::Integer_3d<IndexType> dim = gridDim;
+    if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d1) {
+        dim.y = 1;
+        dim.z = 1;
+    }
+    if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d2) {
+        dim.z = 1;
+    }
+    if (dim.x <= 0 || dim.y <= 0 || dim.z <= 0) {
+        return identity;
+    }
 
-    if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d3) {
-#ifdef NEON_OS_WINDOWS
-#pragma omp parallel for default(shared)
-#else
-// #pragma omp parallel for simd collapse(1) default(shared) schedule(guided)
-#endif
-        for (IndexType z = 0; z < gridDim.z; z++) {
-            for (IndexType y = 0; y < gridDim.y; y++) {
-                for (IndexType x = 0; x < gridDim.x; x++) {
-                    typename DataSetContainer::Idx e;
-                    if (span.setAndValidate(e, x, y, z)) {
-                        userLambdaTa(e);
-                    }
-                }
-            }
+    const int                   nThreads = omp_get_max_threads();
+    Neon::Integer_3d<IndexType> tile = ompLaunchConfig.getTile(dim);
+    if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d1) {
+        // A few chunks per thread to balance the active cells of sparse spans
+        tile = Neon::Integer_3d<IndexType>(std::max(IndexType(1), IndexType((dim.x + 8 * nThreads - 1) / (8 * nThreads))), 1, 1);
+    }
+    const Neon::Integer_3d<IndexType> nTiles((dim.x + tile.x - 1) / tile.x,
+                                             (dim.y + tile.y - 1) / tile.y,
+                                             (dim.z + tile.z - 1) / tile.z);
+    const int                         nTotalTiles = static_cast<int>(nTiles.template rMulTyped<int64_t>());
+
+    std::vector<T> threadResults(nThreads, identity);
+#pragma omp parallel num_threads(nThreads) default(shared)
+    {
+        UserLambda_ta threadLambda = userLambdaTa;
+        T             threadResult = identity;
+        auto          accumulate = [&](const typename DataSetContainer::Idx& e) {
+            threadResult = combineOp(threadResult, threadLambda(e));
+        };
+
+#pragma omp for schedule(static)
+        for (int tileIdx = 0; tileIdx < nTotalTiles; tileIdx++) {
+            const IndexType tx = IndexType(tileIdx % nTiles.x);
+            const IndexType ty = IndexType((tileIdx / nTiles.x) % nTiles.y);
+            const IndexType tz = IndexType(tileIdx / (nTiles.x * nTiles.y));
+
+            const Neon::Integer_3d<IndexType> begin(tx * tile.x, ty * tile.y, tz * tile.z);
+            const Neon::Integer_3d<IndexType> end(std::min(IndexType(begin.x + tile.x), dim.x),
+                                                  std::min(IndexType(begin.y + tile.y), dim.y),
+                                                  std::min(IndexType(begin.z + tile.z), dim.z));
+            launchLambdaOnTileOMP<IndexType, DataSetContainer>(begin, end, span, accumulate);
         }
+        threadResults[omp_get_thread_num()] = threadResult;
+    }
+
+    T result = identity;
+    for (auto const& threadResult : threadResults) {
+        result = combineOp(result, threadResult);
     }
+    return result;
 }
 }  // namespace denseSpan
 
@@ -116,32 +263,102 @@ NEON_CUDA_KERNEL auto launchLambdaOnSpanCUDA(typename DataSetContainer::Span spa
 #endif
 
 
+/**
+ * Blocks are distributed across OpenMP threads following the schedule of ompLaunchConfig.
+ * Within a block, the span visits only the active voxels (see bSpan::forEachActiveCPUDevice),
+ * as omp simd loops if the configuration asks for it.
+ */
+template <typename IndexType, bool vectorize, typename DataSetContainer, typename UserLambda_ta>
+void launchLambdaOnBlocksOMP(const Neon::Integer_3d<IndexType>& blockGridSize,
+                             Neon::set::OmpLaunchConfig const&  ompLaunchConfig,
+                             typename DataSetContainer::Span    span,
+                             UserLambda_ta                      userLambdaTa)
+{
+    const int nBlocks = static_cast<int>(blockGridSize.x);
+    const int chunk = ompLaunchConfig.chunk();
+
+    switch (ompLaunchConfig.schedule()) {
+        case Neon::set::OmpSchedule::staticSchedule: {
+#pragma omp parallel for default(shared) schedule(static, chunk)
+            for (int bIdx = 0; bIdx < nBlocks; bIdx++) {
+                span.template forEachActiveCPUDevice<vectorize>(static_cast<uint32_t>(bIdx), userLambdaTa);
+            }
+            return;
+        }
+        case Neon::set::OmpSchedule::dynamicSchedule: {
+#pragma omp parallel for default(shared) schedule(dynamic, chunk)
+            for (int bIdx = 0; bIdx < nBlocks; bIdx++) {
+                span.template forEachActiveCPUDevice<vectorize>(static_cast<uint32_t>(bIdx), userLambdaTa);
+            }
+            return;
+        }
+        case Neon::set::OmpSchedule::guidedSchedule: {
+#pragma omp parallel for default(shared) schedule(guided, chunk)
+            for (int bIdx = 0; bIdx < nBlocks; bIdx++) {
+                span.template forEachActiveCPUDevice<vectorize>(static_cast<uint32_t>(bIdx), userLambdaTa);
+            }
+            return;
+        }
+    }
+}
+
 template <typename IndexType, typename DataSetContainer, typename UserLambda_ta>
-void launchLambdaOnSpanOMP(const Neon::Integer_3d<IndexType>& blockSize,
-                           const Neon::Integer_3d<IndexType>& blockGridSize,
+void launchLambdaOnSpanOMP(const Neon::Integer_3d<IndexType>& blockGridSize,
+                           Neon::set::OmpLaunchConfig const&  ompLaunchConfig,
                            typename DataSetContainer::Span    span,
                            UserLambda_ta                      userLambdaTa)
 {
 
     if constexpr (DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d1b3) {
-        // #pragma omp parallel for schedule(guided)
-        for (IndexType bIdx = 0; bIdx < blockGridSize.x; bIdx++) {
-            for (IndexType z = 0; z < blockSize.z; z++) {
-                for (IndexType y = 0; y < blockSize.y; y++) {
-#ifndef NEON_OS_WINDOWS
-// #pragma omp simd
-#endif
-                    for (IndexType x = 0; x < blockSize.x; x++) {
-                        typename DataSetContainer::Idx e;
-                        if (span.setAndValidateCPUDevice(e, bIdx, x, y, z)) {
-                            userLambdaTa(e);
-                        }
-                    }
-                }
-            }
+        if (ompLaunchConfig.simd()) {
+            launchLambdaOnBlocksOMP<IndexType, true, DataSetContainer>(blockGridSize, ompLaunchConfig, span, userLambdaTa);
+        } else {
+            launchLambdaOnBlocksOMP<IndexType, false, DataSetContainer>(blockGridSize, ompLaunchConfig, span, userLambdaTa);
         }
     }
 }
+/**
+ * Reduces the values returned by userLambdaTa on the active voxels of all the blocks of a span.
+ * Blocks are statically distributed across OpenMP threads (see denseSpan::reduceLambdaOnSpanOMP).
+ */
+template <typename IndexType,
+          typename DataSetContainer,
+          typename T,
+          typename CombineOp,
+          typename UserLambda_ta>
+auto reduceLambdaOnSpanOMP(const Neon::Integer_3d<IndexType>& blockGridSize,
+                           typename DataSetContainer::Span    span,
+                           T const&                           identity,
+                           CombineOp                          combineOp,
+                           UserLambda_ta                      userLambdaTa)
+    -> T
+{
+    static_assert(DataSetContainer::executionThreadSpan == ExecutionThreadSpan::d1b3);
+
+    const int      nBlocks = static_cast<int>(blockGridSize.x);
+    const int      nThreads = omp_get_max_threads();
+    std::vector<T> threadResults(nThreads, identity);
+#pragma omp parallel num_threads(nThreads) default(shared)
+    {
+        UserLambda_ta threadLambda = userLambdaTa;
+        T             threadResult = identity;
+        auto          accumulate = [&](const typename DataSetContainer::Idx& e) {
+            threadResult = combineOp(threadResult, threadLambda(e));
+        };
+
+#pragma omp for schedule(static)
+        for (int bIdx = 0; bIdx < nBlocks; bIdx++) {
+            span.forEachActiveCPUDevice(static_cast<uint32_t>(bIdx), accumulate);
+        }
+        threadResults[omp_get_thread_num()] = threadResult;
+    }
+
+    T result = identity;
+    for (auto const& threadResult : threadResults) {
+        result = combineOp(result, threadResult);
+    }
+    return result;
+}
 }  // namespace blockSpan
 
 }  // namespace Neon::set::details
\ No newline at end of file
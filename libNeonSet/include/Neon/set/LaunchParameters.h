@@ -3,6 +3,7 @@
 
 #include "Neon/core/core.h"
 #include "Neon/set/DataSet.h"
+#include "Neon/set/OmpLaunchConfig.h"
 
 #include "Neon/sys/devices/DevInterface.h"
 #include "Neon/sys/devices/gpu/GpuKernelInfo.h"
@@ -64,6 +65,16 @@ class LaunchParameters
              index_t                          blockDim,
              size_t                           shareMemorySize) -> void;
 
+    /**
+     * Returns the configuration used by the OpenMP launchers (tile shape and schedule)
+     */
+    auto ompLaunchConfig() -> OmpLaunchConfig&;
+
+    /**
+     * Returns the configuration used by the OpenMP launchers (tile shape and schedule)
+     */
+    auto ompLaunchConfig() const -> const OmpLaunchConfig&;
+
     template <typename LambdaFun>
     auto forEachSeq(LambdaFun const& lambdaFun) -> void
     {
@@ -72,6 +83,9 @@ class LaunchParameters
             lambdaFun(setIdx, this->get(i));
         }
     }
+
+   private:
+    OmpLaunchConfig mOmpLaunchConfig;
 };
 // New name after refactoring: https://git.autodesk.com/Research/gd-Neon/issues/374
 }  // namespace set
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include "Neon/set/Transfer.h"
+#include "Neon/sys/memory/FirstTouchTiling.h"
 
 namespace Neon {
 namespace set {
@@ -73,6 +74,28 @@ struct MemoryOptions
     auto setOrder(Neon::MemoryLayout)
         -> void;
 
+    /**
+     * Set the allocator used for io buffers.
+     * On CPU backends this is also the storage used by the computation,
+     * for example Neon::Allocator::HUGE_PAGE_MEM can be selected for large fields.
+     */
+    auto setIOAllocator(Neon::Allocator allocator)
+        -> void;
+
+    /**
+     * Set the traversal of the dense OpenMP launchers that will compute on the buffers.
+     * CPU buffers are then first touched with the same thread mapping,
+     * which places their pages on the NUMA nodes of the threads that use them.
+     */
+    auto setFirstTouchTiling(const Neon::sys::FirstTouchTiling& firstTouchTiling)
+        -> void;
+
+    /**
+     * Returns the traversal used to first touch CPU buffers
+     */
+    auto getFirstTouchTiling() const
+        -> const Neon::sys::FirstTouchTiling&;
+
    private:
     /**
      * Helper method to check if the object was initialized by the backend
@@ -108,5 +131,7 @@ struct MemoryOptions
     Neon::DeviceType   mHostType = Neon::DeviceType::NONE /** Host device type */;
     Neon::Allocator    mHostAllocator = Neon::Allocator::NULL_MEM /** Host allocator type */;
     Neon::MemoryLayout mMemOrder = Neon::MemoryLayout::structOfArrays /** Memory order */;
+
+    Neon::sys::FirstTouchTiling mFirstTouchTiling /** Traversal used to first touch CPU buffers */;
 };
 }  // namespace Neon
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace Neon::set::interface {
+
+/**
+ * Counter shared by a multi-XPU data object and its copies.
+ * It is incremented every time one of these objects is assigned or swapped,
+ * i.e. when the partitions seen through the object may be replaced.
+ * Containers record the counters of the objects loaded by a loading lambda
+ * to detect that the partitions captured by the extracted compute lambda may be outdated.
+ */
+class MultiXpuDataEpoch
+{
+   public:
+    MultiXpuDataEpoch();
+
+    /**
+     * Returns the current epoch
+     */
+    auto get() const -> uint64_t;
+
+    /**
+     * Starts a new epoch
+     */
+    auto increment() -> void;
+
+   private:
+    std::shared_ptr<uint64_t> mCounter;
+};
+
+}  // namespace Neon::set::interface
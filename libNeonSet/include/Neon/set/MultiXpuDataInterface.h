@@ -4,6 +4,7 @@
 
 #include "Neon/core/core.h"
 #include "Neon/core/types/Execution.h"
+#include "Neon/set/MultiXpuDataEpoch.h"
 #include "Neon/set/MultiXpuDataUid.h"
 
 namespace Neon::set::interface {
@@ -21,6 +22,16 @@ class MultiXpuDataInterface
 
     MultiXpuDataInterface();
 
+    MultiXpuDataInterface(const Self& other) = default;
+    MultiXpuDataInterface(Self&& other) noexcept = default;
+
+    /**
+     * Assignments replace the data seen through this object:
+     * they start a new epoch of the replaced data so that cached compute lambdas are extracted again.
+     */
+    auto operator=(const Self& other) -> Self&;
+    auto operator=(Self&& other) noexcept -> Self&;
+
     virtual auto updateHostData([[maybe_unused]] int streamId = 0)
         -> void
     {
@@ -52,12 +63,18 @@ class MultiXpuDataInterface
 
     auto getUid() const -> Neon::set::dataDependency::MultiXpuDataUid;
 
+    /**
+     * Returns the epoch of the data seen through this object (see MultiXpuDataEpoch).
+     */
+    auto getEpoch() const -> const MultiXpuDataEpoch&;
+
    protected:
     static auto swapUIDs(Self& A, Self& B) -> void;
 
    private:
     std::shared_ptr<int>     mUid;
     std::shared_ptr<Storage> mStorage;
+    MultiXpuDataEpoch        mEpoch;
 };
 
 template <typename P, typename S>
@@ -86,10 +103,39 @@ MultiXpuDataInterface<P, S>::MultiXpuDataInterface()
     mUid = std::make_shared<int>();
 }
 
+template <typename P, typename S>
+auto MultiXpuDataInterface<P, S>::getEpoch() const -> const MultiXpuDataEpoch&
+{
+    return mEpoch;
+}
+
+template <typename P, typename S>
+auto MultiXpuDataInterface<P, S>::operator=(const Self& other) -> Self&
+{
+    mEpoch.increment();
+    mUid = other.mUid;
+    mStorage = other.mStorage;
+    mEpoch = other.mEpoch;
+    return *this;
+}
+
+template <typename P, typename S>
+auto MultiXpuDataInterface<P, S>::operator=(Self&& other) noexcept -> Self&
+{
+    mEpoch.increment();
+    mUid = std::move(other.mUid);
+    mStorage = std::move(other.mStorage);
+    mEpoch = std::move(other.mEpoch);
+    return *this;
+}
+
 template <typename P, typename S>
 auto MultiXpuDataInterface<P, S>::swapUIDs(MultiXpuDataInterface::Self& A, MultiXpuDataInterface::Self& B) -> void
 {
+    A.mEpoch.increment();
+    B.mEpoch.increment();
     std::swap(A.mUid, B.mUid);
+    std::swap(A.mEpoch, B.mEpoch);
 }
 
 }  // namespace Neon::set::interface
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <string>
+
+#include "Neon/core/core.h"
+
+namespace Neon::set {
+
+/**
+ * OpenMP loop schedules supported by the CPU launchers.
+ */
+enum struct OmpSchedule
+{
+    staticSchedule = 0 /**< tiles are statically distributed to threads */,
+    dynamicSchedule = 1 /**< tiles are handed out on demand */,
+    guidedSchedule = 2 /**< tiles are handed out on demand with decreasing chunk sizes */
+};
+
+struct OmpScheduleUtils
+{
+    static constexpr int nOptions = 3;
+
+    static auto toString(OmpSchedule schedule) -> std::string;
+    static auto fromString(const std::string& schedule) -> OmpSchedule;
+};
+
+/**
+ * How the partitions of a multi-partition OpenMP backend are executed.
+ */
+enum struct OmpPartitionMode
+{
+    sequential = 0 /**< partitions run one after the other, each one using all the available threads */,
+    concurrent = 1 /**< partitions run at the same time, each one on its own OpenMP thread team */
+};
+
+struct OmpPartitionModeUtils
+{
+    static constexpr int nOptions = 2;
+
+    static auto toString(OmpPartitionMode mode) -> std::string;
+    static auto fromString(const std::string& mode) -> OmpPartitionMode;
+};
+
+/**
+ * Semantic of the streams of an OpenMP backend.
+ */
+enum struct OmpStreamMode
+{
+    synchronous = 0 /**< every operation runs on the calling thread and streams are only labels */,
+    asynchronous = 1 /**< streams other than the main one are worker queues synchronized through host events */
+};
+
+struct OmpStreamModeUtils
+{
+    static constexpr int nOptions = 2;
+
+    static auto toString(OmpStreamMode mode) -> std::string;
+    static auto fromString(const std::string& mode) -> OmpStreamMode;
+};
+
+/**
+ * Configuration used by the OpenMP launchers to distribute the iteration space of a span over threads.
+ *
+ * The 3D iteration space is split into tiles of shape tile(), and tiles are spread across threads
+ * following schedule(). A tile component set to zero spans the whole extent of the domain in that direction.
+ * The default keeps full x rows (contiguous in memory and vectorizable) and uses small y-z tiles
+ * so that neighbouring rows read by stencil operations stay in cache.
+ */
+class OmpLaunchConfig
+{
+   public:
+    static constexpr int defaultTileX = 0;
+    static constexpr int defaultTileY = 8;
+    static constexpr int defaultTileZ = 4;
+
+    /**
+     * Default configuration: {full x row, 8, 4} tiles with a static schedule
+     */
+    OmpLaunchConfig() = default;
+
+    /**
+     * Configuration with a user defined tile shape and schedule
+     */
+    explicit OmpLaunchConfig(const Neon::index_3d& tile,
+                             OmpSchedule           schedule = OmpSchedule::staticSchedule,
+                             int                   chunk = 1);
+
+    /**
+     * Returns the tile shape as set by the user (zero components are not resolved)
+     */
+    auto tile() const -> const Neon::index_3d&;
+
+    /**
+     * Returns the OpenMP schedule used to distribute tiles to threads
+     */
+    auto schedule() const -> OmpSchedule;
+
+    /**
+     * Returns the number of tiles handed to a thread at once
+     */
+    auto chunk() const -> int;
+
+    auto setTile(const Neon::index_3d& tile) -> OmpLaunchConfig&;
+
+    auto setSchedule(OmpSchedule schedule, int chunk = 1) -> OmpLaunchConfig&;
+
+    /**
+     * Returns true if the runs of active voxels of block spans are executed as omp simd loops
+     */
+    auto simd() const -> bool;
+
+    /**
+     * Marks the runs of active voxels of block spans as omp simd loops (disabled by default).
+     * Only enable it when the compute lambda has no dependency between voxels,
+     * i.e. each voxel only writes its own data and does not carry state to the next voxel.
+     */
+    auto setSimd(bool enabled) -> OmpLaunchConfig&;
+
+    /**
+     * Returns the tile shape for a domain of size domainDim.
+     * Zero components are replaced by the domain extent and the tile is clamped to the domain.
+     */
+    template <typename IndexType>
+    auto getTile(const Neon::Integer_3d<IndexType>& domainDim) const -> Neon::Integer_3d<IndexType>;
+
+    auto toString() const -> std::string;
+
+   private:
+    Neon::index_3d mTile{defaultTileX, defaultTileY, defaultTileZ};
+    OmpSchedule    mSchedule{OmpSchedule::staticSchedule};
+    int            mChunk{1};
+    bool           mSimd{false};
+};
+
+template <typename IndexType>
+auto OmpLaunchConfig::getTile(const Neon::Integer_3d<IndexType>& domainDim) const -> Neon::Integer_3d<IndexType>
+{
+    auto resolve = [](int userTile, IndexType domain) -> IndexType {
+        if (domain <= 0) {
+            return 1;
+        }
+        if (userTile <= 0 || IndexType(userTile) > domain) {
+            return domain;
+        }
+        return IndexType(userTile);
+    };
+    return Neon::Integer_3d<IndexType>(resolve(mTile.x, domainDim.x),
+                                       resolve(mTile.y, domainDim.y),
+                                       resolve(mTile.z, domainDim.z));
+}
+
+}  // namespace Neon::set
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace Neon::set {
+
+/**
+ * Allows one more level of nested OpenMP parallel regions below the current one
+ * for the lifetime of the object.
+ *
+ * The OpenMP settings of the calling thread are restored on destruction,
+ * so a launcher can open nested teams without changing the state seen by the rest of the process.
+ */
+class OmpNestedScope
+{
+   public:
+    /**
+     * Enables one nested level if enable is true, otherwise the object does nothing
+     */
+    explicit OmpNestedScope(bool enable = true);
+
+    ~OmpNestedScope();
+
+    OmpNestedScope(const OmpNestedScope&) = delete;
+    auto operator=(const OmpNestedScope&) -> OmpNestedScope& = delete;
+
+   private:
+    bool mEnabled = false;
+    int  mPreviousNested = 0 /**< value of omp_get_nested before the scope (Windows) */;
+    int  mPreviousMaxActiveLevels = 0 /**< value of omp_get_max_active_levels before the scope */;
+};
+
+}  // namespace Neon::set
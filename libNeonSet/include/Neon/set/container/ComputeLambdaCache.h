@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "Neon/core/core.h"
+#include "Neon/core/types/DataView.h"
+#include "Neon/set/MultiXpuDataEpoch.h"
+
+namespace Neon::set::internal {
+
+/**
+ * Cache of the compute lambdas extracted from a loading lambda, one entry per (SetIdx, DataView).
+ *
+ * Extracting a compute lambda requires a Loader and a call to the user's loading lambda.
+ * As the extracted lambda only depends on the partitions of the loaded objects,
+ * an entry is reused until one of the objects it loaded is assigned or swapped (see MultiXpuDataEpoch).
+ * Host values read by the loading lambda are not tracked, which is why the cache is opt-in
+ * (see ContainerAPI::setComputeLambdaCache).
+ */
+template <typename UserComputeLambdaT>
+class ComputeLambdaCache
+{
+   public:
+    using Epochs = std::vector<Neon::set::interface::MultiXpuDataEpoch>;
+
+    ComputeLambdaCache() = default;
+
+    explicit ComputeLambdaCache(int nDevices)
+        : mEntries(size_t(nDevices) * Neon::DataViewUtil::nConfig)
+    {
+    }
+
+    /**
+     * Returns the compute lambda for the target partition and data view.
+     * The lambda is extracted through extractLambda(setIdx, dataView, epochs) when the cache entry is missing or outdated.
+     * extractLambda records the epochs of the loaded objects in epochs, which is null when the cache is disabled.
+     */
+    template <typename ExtractLambdaT>
+    auto get(Neon::SetIdx          setIdx,
+             Neon::DataView        dataView,
+             bool                  cacheEnabled,
+             const ExtractLambdaT& extractLambda)
+        -> UserComputeLambdaT
+    {
+        const size_t entryIdx = size_t(setIdx.idx()) * Neon::DataViewUtil::nConfig + Neon::DataViewUtil::toInt(dataView);
+        if (!cacheEnabled || entryIdx >= mEntries.size()) {
+            return extractLambda(setIdx, dataView, nullptr);
+        }
+        Entry& entry = mEntries[entryIdx];
+        if (!entry.lambda.has_value() || entry.isOutdated()) {
+            entry.lambda.reset();
+            entry.epochs.clear();
+            entry.values.clear();
+            entry.lambda.emplace(extractLambda(setIdx, dataView, &entry.epochs));
+            for (const auto& epoch : entry.epochs) {
+                entry.values.push_back(epoch.get());
+            }
+        }
+        return entry.lambda.value();
+    }
+
+    /**
+     * Drops all the cached lambdas
+     */
+    auto clear() -> void
+    {
+        for (auto& entry : mEntries) {
+            entry.lambda.reset();
+        }
+    }
+
+   private:
+    struct Entry
+    {
+        std::optional<UserComputeLambdaT> lambda;
+        Epochs                            epochs /**< Epochs of the objects loaded by the loading lambda */;
+        std::vector<uint64_t>             values /**< Values of the epochs when the lambda was extracted */;
+
+        auto isOutdated() const -> bool
+        {
+            for (size_t i = 0; i < epochs.size(); i++) {
+                if (epochs[i].get() != values[i]) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    std::vector<Entry> mEntries;
+};
+
+}  // namespace Neon::set::internal
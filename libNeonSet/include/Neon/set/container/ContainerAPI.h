@@ -125,6 +125,96 @@ struct ContainerAPI
     auto getDataViewSupport() const
         -> DataViewSupport;
 
+    /**
+     * Set the tiling and schedule used by the OpenMP launchers for all the data views.
+     * It only affects the compute Containers created by a grid,
+     * which start from the configuration of their backend (see Backend::setOmpLaunchConfig).
+     */
+    auto setOmpLaunchConfig(const Neon::set::OmpLaunchConfig& ompLaunchConfig)
+        -> void;
+
+    /**
+     * Returns the tiling and schedule used by the OpenMP launchers for a data view.
+     */
+    auto getOmpLaunchConfig(Neon::DataView dw) const
+        -> const Neon::set::OmpLaunchConfig&;
+
+    /**
+     * Enables or disables omp simd on the runs of active voxels of block spans, for all the data views.
+     * The tiling and schedule are left unchanged.
+     */
+    auto setOmpSimd(bool enabled)
+        -> void;
+
+    /**
+     * Enables or disables the reuse of the extracted compute lambdas across runs (disabled by default).
+     * When enabled, the loading lambda runs again only after one of the objects it loads is assigned or swapped,
+     * so it must not read host values that change in between runs.
+     */
+    auto setComputeLambdaCache(bool enabled)
+        -> void;
+
+    /**
+     * Returns true if extracted compute lambdas are reused across runs.
+     */
+    auto isComputeLambdaCacheEnabled() const
+        -> bool;
+
+    /**
+     * Function running a Container on the tile [begin, end) of the iteration space of a partition.
+     */
+    using TileRunner = std::function<void(const Neon::index_3d& begin, const Neon::index_3d& end)>;
+
+    /**
+     * Returns true if the Container can be executed one tile at a time through newTileRunner.
+     * Only device compute Containers on the OpenMP runtime support it.
+     */
+    virtual auto isTileable() const
+        -> bool;
+
+    /**
+     * Returns an identifier of the data structure the Container iterates on (e.g. the grid uid).
+     * Tileable Containers with the same identifier visit the same cells for the same tile.
+     */
+    virtual auto getTilingUid() const
+        -> size_t;
+
+    /**
+     * Returns the extent of the iteration space of a partition:
+     * cells for dense spans, blocks (along x) for block spans.
+     */
+    virtual auto getTileSpace(Neon::SetIdx   setIdx,
+                              Neon::DataView dataView) const
+        -> Neon::index_3d;
+
+    /**
+     * Returns the shape of the tiles used by the OpenMP launchers for a partition.
+     */
+    virtual auto getTileShape(Neon::SetIdx   setIdx,
+                              Neon::DataView dataView) const
+        -> Neon::index_3d;
+
+    /**
+     * Returns true if the coordinates of the tile space are the cell coordinates of a dense grid partition.
+     * Stencil neighbours of a cell are then at most getStencilRadius() away along each axis.
+     */
+    virtual auto hasStructuredTileSpace() const
+        -> bool;
+
+    /**
+     * Returns the radius of the stencil of the data structure the Container iterates on.
+     */
+    virtual auto getStencilRadius() const
+        -> int;
+
+    /**
+     * Returns a function that runs the Container on a tile of a partition.
+     * The returned function can be called concurrently on different tiles.
+     */
+    virtual auto newTileRunner(Neon::SetIdx   setIdx,
+                               Neon::DataView dataView)
+        -> TileRunner;
+
     /**
      * Log information on the parsed tokens.
      */
@@ -143,6 +233,14 @@ struct ContainerAPI
     auto addToken(Neon::set::dataDependency::Token& dataParsing)
         -> void;
 
+    /**
+     * Adds the tokens of another Container.
+     * Tokens on data that is already in the list are merged: access types are combined
+     * and a stencil compute pattern takes precedence over a map one.
+     */
+    auto mergeTokens(const std::vector<Neon::set::dataDependency::Token>& tokens)
+        -> void;
+
     /**
      * Set the name for the container
      */
@@ -215,8 +313,9 @@ struct ContainerAPI
     std::array<Neon::set::LaunchParameters, Neon::DataViewUtil::nConfig> mLaunchParameters;
     Neon::set::ContainerExecutionType                                    mContainerExecutionType;
     Neon::set::ContainerOperationType                                    mContainerOperationType;
-    Neon::set::ContainerPatternType                                      mContainerPatternType;
+    Neon::set::ContainerPatternType                                      mContainerPatternType = ContainerPatternType::map; /**< Containers without tokens, e.g. anchors, are never parsed */
     DataViewSupport                                                      mDataViewSupport = DataViewSupport::on;
+    bool                                                                 mComputeLambdaCache = false;
 };
 
 }  // namespace Neon::set::internal
@@ -1,11 +1,25 @@
 #pragma once
 #include "Neon/core/core.h"
 
+#include "Neon/set/container/ComputeLambdaCache.h"
 #include "Neon/set/container/ContainerAPI.h"
 #include "Neon/set/container/Loader.h"
 
 namespace Neon::set::internal {
 
+/**
+ * Detects data iterator containers that expose a grid uid (i.e. grids)
+ */
+template <typename T, typename = void>
+struct HasGridUID : std::false_type
+{
+};
+
+template <typename T>
+struct HasGridUID<T, std::void_t<decltype(std::declval<const T&>().getGridUID())>> : std::true_type
+{
+};
+
 template <typename DataIteratorContainerT,
           typename UserComputeLambdaT>
 struct DeviceContainer : ContainerAPI
@@ -21,7 +35,8 @@ struct DeviceContainer : ContainerAPI
                     const Neon::index_3d&                         blockSize,
                     std::function<int(const index_3d& blockSize)> shMemSizeFun)
         : m_loadingLambda(loadingLambda),
-          m_dataIteratorContainer(dataIteratorContainer)
+          m_dataIteratorContainer(dataIteratorContainer),
+          mComputeLambdaCache(dataIteratorContainer.getBackend().devSet().setCardinality())
     {
         setName(name);
         mExecution = execution;
@@ -44,6 +59,7 @@ struct DeviceContainer : ContainerAPI
                         DataView::INTERNAL}) {
             this->setLaunchParameters(dw) = dataIteratorContainer.getLaunchParameters(dw, blockSize, sharedMem);
         }
+        this->setOmpLaunchConfig(dataIteratorContainer.getBackend().ompLaunchConfig());
     }
 
     auto newLoader(Neon::SetIdx     setIdx,
@@ -68,6 +84,25 @@ struct DeviceContainer : ContainerAPI
         return parser;
     }
 
+    /**
+     * Returns the compute lambda for a partition and data view,
+     * running the loading lambda only if the cached one is missing or outdated.
+     */
+    auto getComputeLambda(Neon::SetIdx   setIdx,
+                          Neon::DataView dataView)
+        -> UserComputeLambdaT
+    {
+        return mComputeLambdaCache.get(setIdx, dataView, this->isComputeLambdaCacheEnabled(),
+                                       [this](Neon::SetIdx                                          setIdx,
+                                              Neon::DataView                                        dataView,
+                                              std::vector<Neon::set::interface::MultiXpuDataEpoch>* epochs) -> UserComputeLambdaT {
+                                           Loader loader = this->newLoader(setIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
+                                           loader.recordEpochs(epochs);
+                                           UserComputeLambdaT userLambda = this->m_loadingLambda(loader);
+                                           return userLambda;
+                                       });
+    }
+
     auto parse() -> const std::vector<Neon::set::dataDependency::Token>& override
     {
         if (!this->isParsingDataUpdated()) {
@@ -100,9 +135,7 @@ struct DeviceContainer : ContainerAPI
                 [&](Neon::SetIdx   setIdx,
                     Neon::DataView dataView)
                     -> UserComputeLambdaT {
-                    Loader             loader = this->newLoader(setIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
-                    UserComputeLambdaT userLambda = this->m_loadingLambda(loader);
-                    return userLambda;
+                    return this->getComputeLambda(setIdx, dataView);
                 });
             return;
         }
@@ -139,9 +172,7 @@ struct DeviceContainer : ContainerAPI
                 [&](Neon::SetIdx   setIdx,
                     Neon::DataView dataView)
                     -> UserComputeLambdaT {
-                    Loader             loader = this->newLoader(setIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
-                    UserComputeLambdaT userLambda = this->m_loadingLambda(loader);
-                    return userLambda;
+                    return this->getComputeLambda(setIdx, dataView);
                 });
             return;
         }
@@ -149,14 +180,103 @@ struct DeviceContainer : ContainerAPI
         NEON_THROW_UNSUPPORTED_OPTION("");
     }
 
+    auto isTileable() const -> bool override
+    {
+        if constexpr (HasGridUID<DataIteratorContainerT>::value) {
+            return Neon::Runtime::openmp == m_dataIteratorContainer.getBackend().runtime();
+        } else {
+            return false;
+        }
+    }
+
+    auto getTilingUid() const -> size_t override
+    {
+        if constexpr (HasGridUID<DataIteratorContainerT>::value) {
+            return m_dataIteratorContainer.getGridUID();
+        } else {
+            return ContainerAPI::getTilingUid();
+        }
+    }
+
+    auto getTileSpace(Neon::SetIdx   setIdx,
+                      Neon::DataView dataView) const -> Neon::index_3d override
+    {
+        const Neon::sys::GpuLaunchInfo& launchInfo = this->getLaunchParameters(dataView)[setIdx.idx()];
+        if constexpr (!Neon::set::details::ExecutionThreadSpanUtils::isBlockSpan(DataIteratorContainerT::executionThreadSpan)) {
+            Neon::index_3d space = launchInfo.domainGrid().template newType<int32_t>();
+            if constexpr (DataIteratorContainerT::executionThreadSpan == Neon::set::details::ExecutionThreadSpan::d1) {
+                space.y = 1;
+                space.z = 1;
+            }
+            if constexpr (DataIteratorContainerT::executionThreadSpan == Neon::set::details::ExecutionThreadSpan::d2) {
+                space.z = 1;
+            }
+            return space;
+        } else {
+            return Neon::index_3d(int32_t(launchInfo.cudaGrid().x), 1, 1);
+        }
+    }
+
+    auto getTileShape(Neon::SetIdx   setIdx,
+                      Neon::DataView dataView) const -> Neon::index_3d override
+    {
+        if constexpr (!Neon::set::details::ExecutionThreadSpanUtils::isBlockSpan(DataIteratorContainerT::executionThreadSpan)) {
+            return this->getLaunchParameters(dataView).ompLaunchConfig().getTile(getTileSpace(setIdx, dataView));
+        } else {
+            // Blocks are the unit of work of block spans
+            return Neon::index_3d(1, 1, 1);
+        }
+    }
+
+    auto hasStructuredTileSpace() const -> bool override
+    {
+        return isTileable() &&
+               DataIteratorContainerT::executionThreadSpan == Neon::set::details::ExecutionThreadSpan::d3;
+    }
+
+    auto getStencilRadius() const -> int override
+    {
+        if constexpr (HasGridUID<DataIteratorContainerT>::value) {
+            return m_dataIteratorContainer.getStencil().getRadius();
+        } else {
+            return ContainerAPI::getStencilRadius();
+        }
+    }
+
+    auto newTileRunner(Neon::SetIdx   setIdx,
+                       Neon::DataView dataView) -> TileRunner override
+    {
+        using Span = typename DataIteratorContainerT::Span;
+        using IndexType = typename DataIteratorContainerT::ExecutionThreadSpanIndexType;
+
+        Span               span = m_dataIteratorContainer.getSpan(mExecution, setIdx, dataView);
+        UserComputeLambdaT lambda = this->getComputeLambda(setIdx, dataView);
+
+        if constexpr (!Neon::set::details::ExecutionThreadSpanUtils::isBlockSpan(DataIteratorContainerT::executionThreadSpan)) {
+            return [span, lambda](const Neon::index_3d& begin, const Neon::index_3d& end) mutable {
+                Neon::set::details::denseSpan::launchLambdaOnTileOMP<IndexType, DataIteratorContainerT>(begin.template newType<IndexType>(),
+                                                                                                          end.template newType<IndexType>(),
+                                                                                                          span,
+                                                                                                          lambda);
+            };
+        } else {
+            return [span, lambda](const Neon::index_3d& begin, const Neon::index_3d& end) mutable {
+                for (int32_t bIdx = begin.x; bIdx < end.x; bIdx++) {
+                    span.forEachActiveCPUDevice(static_cast<uint32_t>(bIdx), lambda);
+                }
+            };
+        }
+    }
+
    private:
     std::function<UserComputeLambdaT(Loader&)> m_loadingLambda;
     /**
      * This is the container on which the function will be called
      * Most probably, this is going to be one of the grids: dGrid, eGrid
      */
-    DataIteratorContainerT m_dataIteratorContainer;
-    Neon::Execution        mExecution;
+    DataIteratorContainerT                 m_dataIteratorContainer;
+    Neon::Execution                        mExecution;
+    ComputeLambdaCache<UserComputeLambdaT> mComputeLambdaCache /**< Compute lambdas extracted in previous runs */;
 };
 
 }  // namespace Neon::set::internal
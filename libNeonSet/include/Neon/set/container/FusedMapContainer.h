@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Neon/set/container/ContainerAPI.h"
+#include "Neon/set/container/Loader.h"
+
+namespace Neon::set::internal {
+
+/**
+ * Container running a sequence of map Containers in a single traversal of the iteration space.
+ *
+ * Each tile of a partition is visited once and all the fused Containers are executed on it, in order.
+ * As map Containers only access the cell they are running on, the result is the same as
+ * running the Containers one after the other, while data loaded by one Container is still in cache for the next ones.
+ *
+ * The fused Containers must be tileable and must iterate on the same data structure (see ContainerAPI::isTileable).
+ * When their tiling does not match for a partition, the Containers are executed one after the other.
+ */
+struct FusedMapContainer : ContainerAPI
+{
+   public:
+    ~FusedMapContainer() override = default;
+
+    FusedMapContainer(const std::string&                                                    name,
+                      int                                                                   setCardinality,
+                      const std::vector<std::shared_ptr<Neon::set::internal::ContainerAPI>>& containers);
+
+    auto parse()
+        -> const std::vector<Neon::set::dataDependency::Token>& override;
+
+    auto run(int            streamIdx = 0,
+             Neon::DataView dataView = Neon::DataView::STANDARD)
+        -> void override;
+
+    auto run(Neon::SetIdx   setIdx,
+             int            streamIdx = 0,
+             Neon::DataView dataView = Neon::DataView::STANDARD)
+        -> void override;
+
+    /**
+     * Returns the number of fused Containers
+     */
+    auto getNumberOfFusedContainers() const
+        -> int;
+
+   private:
+    std::vector<std::shared_ptr<Neon::set::internal::ContainerAPI>> mContainers;
+    int                                                             mSetCardinality = 0;
+};
+
+}  // namespace Neon::set::internal
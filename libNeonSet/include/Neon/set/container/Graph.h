@@ -293,6 +293,14 @@ struct Graph
     auto helpExecuteWithOmpAtNodeLevel(int anchorStream)
         -> void;
 
+    /**
+     * Helper - it executes the graph on all devices by running each node as an OpenMP task.
+     * A node is released as soon as all the nodes it depends on have completed.
+     * Runtimes other than OpenMP fall back to helpExecuteWithOmpAtNodeLevel.
+     */
+    auto helpExecuteWithOmpTasks(int anchorStream)
+        -> void;
+
     /**
      * Helper - it executes the graph on a target device
      */
@@ -340,6 +348,13 @@ struct Graph
     auto helpComputeScheduling_05_executionOrder(bool filterOutAnchors, Bfs& bfs)
         -> void;
 
+    /**
+     * Helper - it stores in each node the data and user dependencies
+     * in terms of execution order, as required by task based executors.
+     */
+    auto helpComputeScheduling_06_taskDependencies(Bfs& bfs)
+        -> void;
+
     using RawGraph = DiGraph<GraphNode, GraphDependency>;
 
     Uid      mUidCounter /**< internal counter to create node uids */;
@@ -1,6 +1,7 @@
 #pragma once
 #include "Neon/core/core.h"
 
+#include "Neon/set/container/ComputeLambdaCache.h"
 #include "Neon/set/container/ContainerAPI.h"
 #include "Neon/set/container/Loader.h"
 
@@ -20,7 +21,8 @@ struct HostContainer : ContainerAPI
                   const Neon::index_3d&                         blockSize,
                   std::function<int(const index_3d& blockSize)> shMemSizeFun)
         : m_loadingLambda(loadingLambda),
-          m_dataIteratorContainer(dataIteratorContainer)
+          m_dataIteratorContainer(dataIteratorContainer),
+          mComputeLambdaCache(dataIteratorContainer.getBackend().devSet().setCardinality())
     {
         setName(name);
         setContainerExecutionType(ContainerExecutionType::host);
@@ -43,6 +45,7 @@ struct HostContainer : ContainerAPI
                         DataView::INTERNAL}) {
             this->setLaunchParameters(dw) = dataIteratorContainer.getLaunchParameters(dw, blockSize, sharedMem);
         }
+        this->setOmpLaunchConfig(dataIteratorContainer.getBackend().ompLaunchConfig());
     }
 
     auto newLoader(Neon::SetIdx     setIdx,
@@ -67,6 +70,25 @@ struct HostContainer : ContainerAPI
         return parser;
     }
 
+    /**
+     * Returns the compute lambda for a partition and data view,
+     * running the loading lambda only if the cached one is missing or outdated.
+     */
+    auto getComputeLambda(Neon::SetIdx   setIdx,
+                          Neon::DataView dataView)
+        -> UserComputeLambdaT
+    {
+        return mComputeLambdaCache.get(setIdx, dataView, this->isComputeLambdaCacheEnabled(),
+                                       [this](Neon::SetIdx                                          setIdx,
+                                              Neon::DataView                                        dataView,
+                                              std::vector<Neon::set::interface::MultiXpuDataEpoch>* epochs) -> UserComputeLambdaT {
+                                           Loader loader = this->newLoader(setIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
+                                           loader.recordEpochs(epochs);
+                                           UserComputeLambdaT userLambda = this->m_loadingLambda(loader);
+                                           return userLambda;
+                                       });
+    }
+
     auto parse() -> const std::vector<Neon::set::dataDependency::Token>& override
     {
         if (!this->isParsingDataUpdated()) {
@@ -96,9 +118,7 @@ struct HostContainer : ContainerAPI
                 kernelConfig,
                 m_dataIteratorContainer,
                 [&](Neon::SetIdx setIdx, Neon::DataView dataView) -> UserComputeLambdaT {
-                    Loader             loader = this->newLoader(setIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
-                    UserComputeLambdaT userLambda = this->m_loadingLambda(loader);
-                    return userLambda;
+                    return this->getComputeLambda(setIdx, dataView);
                 });
             return;
         }
@@ -135,9 +155,7 @@ struct HostContainer : ContainerAPI
                     Neon::SetIdx   setIdx,
                     Neon::DataView dataView)
                     -> UserComputeLambdaT {
-                    Loader             loader = this->newLoader(setIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
-                    UserComputeLambdaT userLambda = this->m_loadingLambda(loader);
-                    return userLambda;
+                    return this->getComputeLambda(setIdx, dataView);
                 });
             return;
         }
@@ -152,6 +170,8 @@ struct HostContainer : ContainerAPI
      * Most probably, this is going to be one of the grids: dGrid, eGrid
      */
     DataIteratorContainerT m_dataIteratorContainer;
+
+    ComputeLambdaCache<UserComputeLambdaT> mComputeLambdaCache /**< Compute lambdas extracted in previous runs */;
 };
 
 }  // namespace Neon::set::internal
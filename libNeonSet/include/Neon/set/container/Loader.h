@@ -4,6 +4,7 @@
 
 #include "Neon/set/DevSet.h"
 #include "Neon/set/HuOptions.h"
+#include "Neon/set/MultiXpuDataEpoch.h"
 #include "Neon/set/StencilSemantic.h"
 #include "Neon/set/container/ContainerAPI.h"
 #include "Neon/set/dependency/AccessType.h"
@@ -45,6 +46,8 @@ struct Loader
     Neon::DataView                        m_dataView;
     Neon::set::internal::LoadingMode_e::e m_loadingMode;
 
+    std::vector<Neon::set::interface::MultiXpuDataEpoch>* mEpochs = nullptr;
+
    public:
     Loader(Neon::set::internal::ContainerAPI&    container,
            Neon::Execution                       execution,
@@ -59,6 +62,12 @@ struct Loader
     {
     }
 
+    /**
+     * Records the epochs of the objects loaded while extracting a compute lambda into epochs,
+     * which a ComputeLambdaCache uses to know when the lambda must be extracted again.
+     */
+    auto recordEpochs(std::vector<Neon::set::interface::MultiXpuDataEpoch>* epochs) -> void;
+
     auto getExecution() const -> Neon::Execution;
     auto getSetIdx() const -> Neon::SetIdx;
     auto getDataView() const -> Neon::DataView;
@@ -126,6 +126,9 @@ auto Loader::
             return field.getPartition(mExecution, m_setIdx, m_dataView);
         }
         case Neon::set::internal::LoadingMode_e::EXTRACT_LAMBDA: {
+            if (mEpochs != nullptr) {
+                mEpochs->push_back(field.getEpoch());
+            }
             return field.getPartition(mExecution, m_setIdx, m_dataView);
         }
     }
@@ -180,6 +183,9 @@ auto Loader::
             return field.getPartition(mExecution, m_setIdx, m_dataView);
         }
         case Neon::set::internal::LoadingMode_e::EXTRACT_LAMBDA: {
+            if (mEpochs != nullptr) {
+                mEpochs->push_back(field.getEpoch());
+            }
             return field.getPartition(mExecution, m_setIdx, m_dataView);
         }
     }
@@ -41,13 +41,13 @@ struct OldDeviceManagedContainer : ContainerAPI
         setDataViewSupport(dataViewSupport);
     }
 
-    auto newLoader(Neon::DeviceType devE,
+    auto newLoader(Neon::Execution  execution,
                    Neon::SetIdx     setIdx,
                    Neon::DataView   dataView,
                    LoadingMode_e::e loadingMode) -> Loader
     {
         auto loader = Loader(*this,
-                             devE,
+                             execution,
                              setIdx,
                              dataView,
                              loadingMode);
@@ -57,7 +57,7 @@ struct OldDeviceManagedContainer : ContainerAPI
     auto newParser() -> Loader
     {
         auto parser = Loader(*this,
-                             Neon::DeviceType::CPU,
+                             Neon::Execution::host,
                              Neon::SetIdx(0),
                              Neon::DataView::STANDARD,
                              Neon::set::internal::LoadingMode_e::PARSE_AND_EXTRACT_LAMBDA);
@@ -66,8 +66,11 @@ struct OldDeviceManagedContainer : ContainerAPI
 
     auto parse() -> const std::vector<Neon::set::dataDependency::Token>& override
     {
-        auto parser = newParser();
-        this->mLoadingLambda(parser);
+        if (!this->isParsingDataUpdated()) {
+            auto parser = newParser();
+            this->mLoadingLambda(parser);
+            this->setParsingDataUpdated(true);
+        }
         return getTokens();
     }
 
@@ -88,12 +91,10 @@ struct OldDeviceManagedContainer : ContainerAPI
      */
     virtual auto run(int streamIdx = 0, Neon::DataView dataView = Neon::DataView::STANDARD) -> void override
     {
-        const Neon::Backend& bk = mDataContainer.getBackend();
-
         // We use device 0 as a dummy setIdx to create a loader.
         // The actual value is not important as the managed container will take care of launching on all devices.
         SetIdx         dummyTargetSetIdx = 0;
-        Loader         loader = this->newLoader(bk.devType(), dummyTargetSetIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
+        Loader         loader = this->newLoader(Neon::Execution::device, dummyTargetSetIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
         ComputeLambdaT computeLambda = this->mLoadingLambda(loader);
         computeLambda(streamIdx, dataView);
     }
@@ -0,0 +1,214 @@
+#pragma once
+#include "Neon/core/core.h"
+
+#include "Neon/set/LambdaExecutor.h"
+#include "Neon/set/container/ComputeLambdaCache.h"
+#include "Neon/set/container/ContainerAPI.h"
+#include "Neon/set/container/Loader.h"
+
+namespace Neon::set::internal {
+
+/**
+ * Container reducing the values computed by a user lambda on each cell of a grid.
+ *
+ * The loading lambda has the same role as in a DeviceContainer,
+ * but the returned compute lambda maps a cell index to a value of type T:
+ * the values are combined by combineOp, starting from identity, into a single value for all the partitions.
+ * The result of each run is passed to resultWriter together with the data view of the run.
+ *
+ * The reduction runs on the host threads of the OpenMP runtime.
+ * With Neon::Execution::host it can also be used with any other runtime, on the host copy of the fields.
+ */
+template <typename DataIteratorContainerT,
+          typename UserComputeLambdaT,
+          typename T,
+          typename CombineOpT>
+struct ReduceContainer : ContainerAPI
+{
+   public:
+    ~ReduceContainer() override = default;
+
+    ReduceContainer(const std::string&                            name,
+                    Neon::Execution                               execution,
+                    ContainerAPI::DataViewSupport                 dataViewSupport,
+                    const DataIteratorContainerT&                 dataIteratorContainer,
+                    std::function<UserComputeLambdaT(Loader&)>    loadingLambda,
+                    const Neon::index_3d&                         blockSize,
+                    const T&                                      identity,
+                    CombineOpT                                    combineOp,
+                    std::function<void(Neon::DataView, const T&)> resultWriter)
+        : mLoadingLambda(loadingLambda),
+          mDataIteratorContainer(dataIteratorContainer),
+          mExecution(execution),
+          mIdentity(identity),
+          mCombineOp(combineOp),
+          mResultWriter(resultWriter),
+          mComputeLambdaCache(dataIteratorContainer.getBackend().devSet().setCardinality())
+    {
+        if (execution == Neon::Execution::device &&
+            dataIteratorContainer.getBackend().runtime() != Neon::Runtime::openmp) {
+            NeonException exc("ReduceContainer");
+            exc << "Container " << name << ": Neon::Execution::device requires the openmp runtime, use Neon::Execution::host";
+            NEON_THROW(exc);
+        }
+
+        setName(name);
+        setContainerExecutionType(execution == Neon::Execution::device
+                                      ? ContainerExecutionType::deviceManaged
+                                      : ContainerExecutionType::hostManaged);
+        setContainerOperationType(ContainerOperationType::compute);
+        setDataViewSupport(dataViewSupport);
+
+        for (auto dw : {DataView::STANDARD,
+                        DataView::BOUNDARY,
+                        DataView::INTERNAL}) {
+            this->setLaunchParameters(dw) = dataIteratorContainer.getLaunchParameters(dw, blockSize, 0);
+        }
+        this->setOmpLaunchConfig(dataIteratorContainer.getBackend().ompLaunchConfig());
+
+        this->parse();
+    }
+
+    auto newLoader(Neon::SetIdx     setIdx,
+                   Neon::DataView   dataView,
+                   LoadingMode_e::e loadingMode) -> Loader
+    {
+        auto loader = Loader(*this,
+                             mExecution,
+                             setIdx,
+                             dataView,
+                             loadingMode);
+        return loader;
+    }
+
+    auto newParser() -> Loader
+    {
+        auto parser = Loader(*this,
+                             Neon::Execution::host,
+                             Neon::SetIdx(0),
+                             Neon::DataView::STANDARD,
+                             Neon::set::internal::LoadingMode_e::PARSE_AND_EXTRACT_LAMBDA);
+        return parser;
+    }
+
+    /**
+     * Fields loaded with the default MAP pattern are registered as REDUCE,
+     * so that the Container is scheduled as a reduction (e.g. split in INTERNAL and BOUNDARY by OCC).
+     */
+    auto parse() -> const std::vector<Neon::set::dataDependency::Token>& override
+    {
+        if (!this->isParsingDataUpdated()) {
+            auto parser = newParser();
+            this->mLoadingLambda(parser);
+            this->setParsingDataUpdated(true);
+
+            for (auto& token : this->getTokensRef()) {
+                if (token.compute() == Neon::Pattern::MAP) {
+                    token.update(token.uid(), token.access(), Neon::Pattern::REDUCE);
+                }
+            }
+            this->setContainerPattern(this->getTokens());
+            this->setContainerPattern(Neon::set::ContainerPatternType::reduction);
+        }
+        return getTokens();
+    }
+
+    auto getHostContainer() -> std::shared_ptr<ContainerAPI> final
+    {
+        NEON_THROW_UNSUPPORTED_OPTION("This Container type can not be decoupled.");
+    }
+
+    auto getDeviceContainer() -> std::shared_ptr<ContainerAPI> final
+    {
+        NEON_THROW_UNSUPPORTED_OPTION("This Container type can not be decoupled.");
+    }
+
+    /**
+     * Reduces all the partitions and passes the result to the result writer.
+     * Partition results are combined in partition order.
+     */
+    auto run(int            streamIdx = 0,
+             Neon::DataView dataView = Neon::DataView::STANDARD) -> void override
+    {
+        const int nPartitions = mDataIteratorContainer.getBackend().devSet().setCardinality();
+        if (mExecution == Neon::Execution::host) {
+            // Host data must be up to date before reading it
+            mDataIteratorContainer.getBackend().sync(streamIdx);
+        }
+
+        T result = mIdentity;
+        for (int setIdx = 0; setIdx < nPartitions; setIdx++) {
+            result = mCombineOp(result, helpReducePartition(Neon::SetIdx(setIdx), dataView));
+        }
+        mResultWriter(dataView, result);
+    }
+
+    auto run(Neon::SetIdx   setIdx,
+             int            streamIdx = 0,
+             Neon::DataView dataView = Neon::DataView::STANDARD) -> void override
+    {
+        (void)setIdx;
+        (void)streamIdx;
+        (void)dataView;
+        NEON_THROW_UNSUPPORTED_OPTION("A reduction Container runs on all the partitions at once.");
+    }
+
+   private:
+    auto getComputeLambda(Neon::SetIdx   setIdx,
+                          Neon::DataView dataView)
+        -> UserComputeLambdaT
+    {
+        return mComputeLambdaCache.get(setIdx, dataView, this->isComputeLambdaCacheEnabled(),
+                                       [this](Neon::SetIdx                                          setIdx,
+                                              Neon::DataView                                        dataView,
+                                              std::vector<Neon::set::interface::MultiXpuDataEpoch>* epochs) -> UserComputeLambdaT {
+                                           Loader loader = this->newLoader(setIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
+                                           loader.recordEpochs(epochs);
+                                           UserComputeLambdaT userLambda = this->mLoadingLambda(loader);
+                                           return userLambda;
+                                       });
+    }
+
+    auto helpReducePartition(Neon::SetIdx   setIdx,
+                             Neon::DataView dataView)
+        -> T
+    {
+        using IndexType = typename DataIteratorContainerT::ExecutionThreadSpanIndexType;
+
+        const auto&        launchParameters = this->getLaunchParameters(dataView);
+        const auto&        launchInfo = launchParameters[setIdx.idx()];
+        const auto&        span = mDataIteratorContainer.getSpan(mExecution, setIdx, dataView);
+        UserComputeLambdaT lambda = this->getComputeLambda(setIdx, dataView);
+
+        if constexpr (!Neon::set::details::ExecutionThreadSpanUtils::isBlockSpan(DataIteratorContainerT::executionThreadSpan)) {
+            return Neon::set::details::denseSpan::reduceLambdaOnSpanOMP<IndexType, DataIteratorContainerT>(launchInfo.domainGrid().template newType<IndexType>(),
+                                                                                                           launchParameters.ompLaunchConfig(),
+                                                                                                           span,
+                                                                                                           mIdentity,
+                                                                                                           mCombineOp,
+                                                                                                           lambda);
+        } else {
+            auto const&                       cudaGrid = launchInfo.cudaGrid();
+            const Neon::Integer_3d<IndexType> gridSize(cudaGrid.x, cudaGrid.y, cudaGrid.z);
+            return Neon::set::details::blockSpan::reduceLambdaOnSpanOMP<IndexType, DataIteratorContainerT>(gridSize,
+                                                                                                           span,
+                                                                                                           mIdentity,
+                                                                                                           mCombineOp,
+                                                                                                           lambda);
+        }
+    }
+
+    std::function<UserComputeLambdaT(Loader&)> mLoadingLambda;
+    /**
+     * This is the container on which the function will be called
+     * Most probably, this is going to be one of the grids: dGrid, eGrid, bGrid
+     */
+    DataIteratorContainerT                        mDataIteratorContainer;
+    Neon::Execution                               mExecution;
+    T                                             mIdentity;
+    CombineOpT                                    mCombineOp;
+    std::function<void(Neon::DataView, const T&)> mResultWriter /**< Receives the result of each run */;
+    ComputeLambdaCache<UserComputeLambdaT>        mComputeLambdaCache /**< Compute lambdas extracted in previous runs */;
+};
+
+}  // namespace Neon::set::internal
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Neon/set/container/ContainerAPI.h"
+#include "Neon/set/container/Loader.h"
+
+namespace Neon::set::internal {
+
+/**
+ * Container running a sequence of map and stencil Containers with temporal blocking.
+ *
+ * The z axis of the partition is split in slabs whose thickness is at least the stencil radius.
+ * The Containers sweep the slabs as a wavefront: at each step the i-th Container processes
+ * the slab two positions behind the one of the (i-1)-th Container.
+ * A slab is therefore read by all the Containers of the sequence while it is still in cache,
+ * instead of streaming the whole domain through memory once per Container.
+ *
+ * With a lag of two slabs, the data read by a Container has always been produced
+ * (and is no longer needed by the previous Containers) in an earlier step of the wavefront,
+ * so all the slabs of a step can be processed concurrently.
+ *
+ * The wavefront requires a single partition, the STANDARD data view
+ * and Containers with a structured tile space (see ContainerAPI::hasStructuredTileSpace).
+ * In any other case the Containers are executed one after the other.
+ */
+struct WavefrontContainer : ContainerAPI
+{
+   public:
+    ~WavefrontContainer() override = default;
+
+    WavefrontContainer(const std::string&                                                    name,
+                       int                                                                   setCardinality,
+                       const std::vector<std::shared_ptr<Neon::set::internal::ContainerAPI>>& containers);
+
+    auto parse()
+        -> const std::vector<Neon::set::dataDependency::Token>& override;
+
+    auto run(int            streamIdx = 0,
+             Neon::DataView dataView = Neon::DataView::STANDARD)
+        -> void override;
+
+    auto run(Neon::SetIdx   setIdx,
+             int            streamIdx = 0,
+             Neon::DataView dataView = Neon::DataView::STANDARD)
+        -> void override;
+
+   private:
+    std::vector<std::shared_ptr<Neon::set::internal::ContainerAPI>> mContainers;
+    int                                                             mSetCardinality = 0;
+};
+
+}  // namespace Neon::set::internal
@@ -62,6 +62,25 @@ class GraphNodeScheduling
     auto setExecutionOerder(int)
         -> void;
 
+    /**
+     * Returns the execution order of the nodes that depend on this node.
+     * Used by task based executors to release the nodes that become ready.
+     */
+    auto getSubsequentTasks()
+        -> std::vector<int>&;
+
+    auto getSubsequentTasks()
+        const -> const std::vector<int>&;
+
+    /**
+     * Returns the number of nodes that have to complete before this node can run.
+     */
+    auto getNumberOfProceedingTasks() const
+        -> int;
+
+    auto setNumberOfProceedingTasks(int)
+        -> void;
+
     /**
      * Reset all scheduling data
      */
@@ -73,6 +92,8 @@ class GraphNodeScheduling
     int              mEvent{-1} /**< Event to be used to signal the completion of the node container */;
     int              mExecutionOrder;
     std::vector<int> mDependentEvents /**< Events to be waited for before running the Container */;
+    std::vector<int> mSubsequentTasks /**< Execution order of the nodes depending on this node */;
+    int              mNumberOfProceedingTasks{0} /**< Number of nodes this node depends on */;
     Neon::DataView   mDataView{DataView::STANDARD};
 };
 
@@ -59,7 +59,8 @@ class MemDevSet
               Neon::DeviceType                               devType,
               const Neon::set::DataSet<Neon::sys::DeviceID>& devId,
               Neon::Allocator                                allocType,
-              const Neon::set::DataSet<uint64_t>&            nElementVec);
+              const Neon::set::DataSet<uint64_t>&            nElementVec,
+              const Neon::sys::FirstTouchTiling&             firstTouchTiling = Neon::sys::FirstTouchTiling());
 
    public:
     /**
@@ -58,13 +58,14 @@ MemDevSet<T_ta>::MemDevSet(int                                            cardin
                            Neon::DeviceType                               devType,
                            const Neon::set::DataSet<Neon::sys::DeviceID>& devIds,
                            Neon::Allocator                                allocType,
-                           const Neon::set::DataSet<uint64_t>&            nElementVec)
+                           const Neon::set::DataSet<uint64_t>&            nElementVec,
+                           const Neon::sys::FirstTouchTiling&             firstTouchTiling)
 {
     m_storage = std::make_shared<Neon::set::DataSet<Neon::sys::MemDevice<T_ta>>>(static_cast<int>(devIds.size()));
     int setIdx = 0;
 
     for (auto&& id : devIds) {
-        vecRef()[setIdx] = Neon::sys::MemDevice<T_ta>(cardinality, order, devType, id, allocType, nElementVec[setIdx]);
+        vecRef()[setIdx] = Neon::sys::MemDevice<T_ta>(cardinality, order, devType, id, allocType, nElementVec[setIdx], firstTouchTiling);
         setIdx++;
     }
 }
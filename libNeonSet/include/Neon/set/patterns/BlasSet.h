@@ -89,6 +89,7 @@ class BlasSet
     std::shared_ptr<std::vector<Neon::sys::patterns::template Blas<T>>> mBlasVec;
     T                                                                   mAggregate;
     Neon::set::StreamSet                                                mStreams;
+    bool                                                                mIsOnHost = false; /**< Host partitions are reduced one after the other, each one by all the threads */
 };
 
 }  // namespace Neon::set::patterns
@@ -9,8 +9,14 @@ BlasSet<T>::BlasSet(const Neon::set::DevSet&          devSet,
                     const Neon::sys::patterns::Engine engine)
 {
     mBlasVec = std::make_shared<std::vector<Neon::sys::patterns::template Blas<T>>>(devSet.setCardinality());
+    mIsOnHost = devSet.type() == Neon::DeviceType::CPU || engine == Neon::sys::patterns::Engine::OpenMP;
 
     devSet.forEachSetIdxSeq([&](Neon::SetIdx& setIdx) {
+        if (mIsOnHost) {
+            // Host buffers only, no GPU is involved
+            (*mBlasVec)[setIdx.idx()] = Neon::sys::patterns::template Blas<T>(engine);
+            return;
+        }
         const Neon::sys::ComputeID  gpuId = devSet.devId(setIdx.idx());
         const Neon::sys::GpuDevice& dev = Neon::sys::globalSpace::gpuSysObj().dev(gpuId);
         (*mBlasVec)[setIdx.idx()] = Neon::sys::patterns::template Blas<T>(dev, devSet.type(), engine);
@@ -44,7 +50,7 @@ T BlasSet<T>::absoluteSum(const Neon::set::MemDevSet<T>& input,
                           Neon::set::DataSet<int>&       num_elements)
 {
     const int32_t numSet = static_cast<int>((*mBlasVec).size());
-#pragma omp parallel for num_threads(numSet)
+#pragma omp parallel for num_threads(numSet) if (!mIsOnHost)
     for (int i = 0; i < numSet; ++i) {
         (*mBlasVec)[i].absoluteSum(input.getMemDev(i), output.getMemDev(i), start_id[i], num_elements[i]);
     }
@@ -68,7 +74,7 @@ T BlasSet<T>::dot(const Neon::set::MemDevSet<T>& input1,
                   Neon::set::DataSet<int>&       num_elements)
 {
     const int32_t numSet = static_cast<int>((*mBlasVec).size());
-#pragma omp parallel for num_threads(numSet)
+#pragma omp parallel for num_threads(numSet) if (!mIsOnHost)
     for (int i = 0; i < numSet; ++i) {
         (*mBlasVec)[i].dot(input1.getMemDev(i), input2.getMemDev(i), output.getMemDev(i), start_id[i], num_elements[i]);
     }
@@ -90,7 +96,7 @@ T BlasSet<T>::norm2(const Neon::set::MemDevSet<T>& input,
                     Neon::set::DataSet<int>&       num_elements)
 {
     const int32_t numSet = static_cast<int>((*mBlasVec).size());
-#pragma omp parallel for num_threads(numSet)
+#pragma omp parallel for num_threads(numSet) if (!mIsOnHost)
     for (int i = 0; i < numSet; ++i) {
         (*mBlasVec)[i].norm2(input.getMemDev(i), output.getMemDev(i), start_id[i], num_elements[i]);
     }
@@ -6,6 +6,8 @@
 #include <thread>
 #include <tuple>
 #include <vector>
+#include <omp.h>
+#include "Neon/set/CpuStream.h"
 #include "Neon/set/DevSet.h"
 
 namespace Neon {
@@ -147,6 +149,130 @@ auto Backend::runtime()
     return selfData().runtime;
 }
 
+auto Backend::setOmpPartitionMode(Neon::set::OmpPartitionMode mode,
+                                  int                         threadsPerPartition)
+    -> void
+{
+    if (threadsPerPartition < 0) {
+        NeonException exp("Backend");
+        exp << "Invalid number of threads per partition " << threadsPerPartition;
+        NEON_THROW(exp);
+    }
+    selfData().ompPartitionMode = mode;
+    selfData().ompThreadsPerPartition = threadsPerPartition;
+}
+
+auto Backend::ompPartitionMode()
+    const
+    -> Neon::set::OmpPartitionMode
+{
+    return selfData().ompPartitionMode;
+}
+
+auto Backend::ompThreadsPerPartition()
+    const
+    -> int
+{
+    if (selfData().ompThreadsPerPartition > 0) {
+        return selfData().ompThreadsPerPartition;
+    }
+    const int nPartitions = std::max(1, getDeviceCount());
+    return std::max(1, omp_get_max_threads() / nPartitions);
+}
+
+auto Backend::setOmpLaunchConfig(const Neon::set::OmpLaunchConfig& ompLaunchConfig)
+    -> void
+{
+    selfData().ompLaunchConfig = ompLaunchConfig;
+}
+
+auto Backend::ompLaunchConfig()
+    const
+    -> const Neon::set::OmpLaunchConfig&
+{
+    return selfData().ompLaunchConfig;
+}
+
+auto Backend::setOmpStreamMode(Neon::set::OmpStreamMode mode,
+                               int                      threadsPerStream)
+    -> void
+{
+    if (threadsPerStream < 0) {
+        NeonException exp("Backend");
+        exp << "Invalid number of threads per stream " << threadsPerStream;
+        NEON_THROW(exp);
+    }
+    selfData().ompStreamMode = mode;
+    selfData().ompThreadsPerStream = threadsPerStream;
+    helpUpdateCpuStreams();
+}
+
+auto Backend::ompStreamMode()
+    const
+    -> Neon::set::OmpStreamMode
+{
+    return selfData().ompStreamMode;
+}
+
+auto Backend::ompThreadsPerStream()
+    const
+    -> int
+{
+    if (selfData().ompThreadsPerStream > 0) {
+        return selfData().ompThreadsPerStream;
+    }
+    const int nStreams = std::max(1, int(selfData().streamSetVec.size()));
+    return std::max(1, omp_get_max_threads() / nStreams);
+}
+
+auto Backend::runOnStream(int streamIdx, std::function<void()> task)
+    const
+    -> void
+{
+    Neon::set::CpuStream* cpuStream = helpGetCpuStream(streamIdx);
+    if (cpuStream == nullptr || cpuStream->isWorkerThread()) {
+        task();
+        return;
+    }
+    cpuStream->enqueue(std::move(task));
+}
+
+auto Backend::helpGetCpuStream(int streamIdx)
+    const
+    -> Neon::set::CpuStream*
+{
+    if (runtime() != Neon::Runtime::openmp ||
+        selfData().ompStreamMode != Neon::set::OmpStreamMode::asynchronous ||
+        streamIdx == mainStreamIdx ||
+        streamIdx >= int(selfData().cpuStreamVec.size())) {
+        return nullptr;
+    }
+    return selfData().cpuStreamVec[streamIdx].get();
+}
+
+auto Backend::helpUpdateCpuStreams()
+    -> void
+{
+    auto& cpuStreamVec = selfData().cpuStreamVec;
+    if (runtime() != Neon::Runtime::openmp ||
+        selfData().ompStreamMode != Neon::set::OmpStreamMode::asynchronous) {
+        // Workers drain their queues before being released
+        cpuStreamVec.clear();
+        return;
+    }
+    const int nStreams = int(selfData().streamSetVec.size());
+    while (int(cpuStreamVec.size()) < nStreams) {
+        // The main stream is executed by the calling thread and has no worker
+        cpuStreamVec.push_back(cpuStreamVec.empty() ? nullptr : std::make_shared<Neon::set::CpuStream>());
+    }
+    const int threadsPerStream = ompThreadsPerStream();
+    for (auto& cpuStream : cpuStreamVec) {
+        if (cpuStream) {
+            cpuStream->setNumThreads(threadsPerStream);
+        }
+    }
+}
+
 auto Backend::streamSet(Neon::StreamIdx streamIdx) const -> const Neon::set::StreamSet&
 {
     return selfData().streamSetVec.at(streamIdx);
@@ -191,6 +317,12 @@ auto Backend::pushEventOnStream(int eventId, int streamId)
 {
     switch (selfData().runtime) {
         case Neon::Runtime::openmp: {
+            if (selfData().ompStreamMode == Neon::set::OmpStreamMode::synchronous) {
+                return;
+            }
+            std::shared_ptr<Neon::set::CpuEvent> event = selfData().cpuEventVec.at(eventId);
+            const uint64_t                       epoch = event->record();
+            runOnStream(streamId, [event, epoch] { event->signal(epoch); });
             return;
         }
         case Neon::Runtime::stream: {
@@ -259,6 +391,12 @@ auto Backend::waitEventOnStream(int eventId, int streamId)
 {
     switch (selfData().runtime) {
         case Neon::Runtime::openmp: {
+            if (selfData().ompStreamMode == Neon::set::OmpStreamMode::synchronous) {
+                return;
+            }
+            std::shared_ptr<Neon::set::CpuEvent> event = selfData().cpuEventVec.at(eventId);
+            const uint64_t                       epoch = event->recorded();
+            runOnStream(streamId, [event, epoch] { event->wait(epoch); });
             return;
         }
         case Neon::Runtime::stream: {
@@ -361,8 +499,12 @@ auto Backend::waitEventOnStream(Neon::SetIdx setIdx, int eventId, int streamId)
 auto Backend::setAvailableStreamSet(int nStreamSets) -> void
 {
     if (runtime() == Neon::Runtime::openmp) {
-        selfData().streamSetVec = std::vector<Neon::set::StreamSet>(nStreamSets);
-        selfData().eventSetVec = std::vector<Neon::set::GpuEventSet>(nStreamSets);
+        // Like the other runtimes, streams are only added: skeletons built earlier may use more streams
+        if (nStreamSets > int(selfData().streamSetVec.size())) {
+            selfData().streamSetVec.resize(nStreamSets);
+            selfData().eventSetVec.resize(nStreamSets);
+        }
+        helpUpdateCpuStreams();
         return;
     }
     const int streamsToAdd = nStreamSets - int(selfData().streamSetVec.size());
@@ -377,7 +519,12 @@ auto Backend::setAvailableStreamSet(int nStreamSets) -> void
 auto Backend::setAvailableUserEvents(int nUserEventSets) -> void
 {
     if (runtime() == Neon::Runtime::openmp) {
-        selfData().userEventSetVec = std::vector<Neon::set::GpuEventSet>(nUserEventSets);
+        if (nUserEventSets > int(selfData().userEventSetVec.size())) {
+            selfData().userEventSetVec.resize(nUserEventSets);
+        }
+        while (int(selfData().cpuEventVec.size()) < nUserEventSets) {
+            selfData().cpuEventVec.push_back(std::make_shared<Neon::set::CpuEvent>());
+        }
         return;
     }
     const int eventToAdd = nUserEventSets - int(selfData().userEventSetVec.size());
@@ -404,6 +551,10 @@ auto Backend::sync() const -> void
 auto Backend::syncAll() const -> void
 {
     if (runtime() == Neon::Runtime::openmp) {
+        const int nStreamSetVec = int(selfData().streamSetVec.size());
+        for (int i = 0; i < nStreamSetVec; i++) {
+            sync(i);
+        }
         return;
     }
     if (runtime() == Neon::Runtime::stream) {
@@ -421,6 +572,10 @@ auto Backend::syncAll() const -> void
 auto Backend::sync(int idx) const -> void
 {
     if (runtime() == Neon::Runtime::openmp) {
+        Neon::set::CpuStream* cpuStream = helpGetCpuStream(idx);
+        if (cpuStream != nullptr && !cpuStream->isWorkerThread()) {
+            cpuStream->sync();
+        }
         return;
     }
     if (runtime() == Neon::Runtime::stream) {
@@ -435,6 +590,8 @@ auto Backend::sync(int idx) const -> void
 auto Backend::sync(Neon::SetIdx setIdx, int idx) const -> void
 {
     if (runtime() == Neon::Runtime::openmp) {
+        // A worker executes all the partitions of its stream
+        sync(idx);
         return;
     }
     if (runtime() == Neon::Runtime::stream) {
@@ -449,6 +606,10 @@ auto Backend::sync(Neon::SetIdx setIdx, int idx) const -> void
 auto Backend::syncEvent(Neon::SetIdx setIdx, int eventIdx) const -> void
 {
     if (runtime() == Neon::Runtime::openmp) {
+        if (selfData().ompStreamMode == Neon::set::OmpStreamMode::asynchronous) {
+            auto& event = selfData().cpuEventVec.at(eventIdx);
+            event->wait(event->recorded());
+        }
         return;
     }
     if (runtime() == Neon::Runtime::stream) {
@@ -558,6 +719,14 @@ auto Backend::toReport(Neon::Report& report, Report::SubBlock* subdocAPI) const
     report.addMember("Runtime", Neon::RuntimeUtils::toString(runtime()), targetSubDoc);
     report.addMember("DeviceType", Neon::DeviceTypeUtil::toString(devType()), targetSubDoc);
     report.addMember("NumberOfDevices", devSet().setCardinality(), targetSubDoc);
+    if (runtime() == Neon::Runtime::openmp) {
+        report.addMember("OmpPartitionMode", Neon::set::OmpPartitionModeUtils::toString(ompPartitionMode()), targetSubDoc);
+        report.addMember("OmpThreadsPerPartition", ompThreadsPerPartition(), targetSubDoc);
+        report.addMember("OmpStreamMode", Neon::set::OmpStreamModeUtils::toString(ompStreamMode()), targetSubDoc);
+        if (ompStreamMode() == Neon::set::OmpStreamMode::asynchronous) {
+            report.addMember("OmpThreadsPerStream", ompThreadsPerStream(), targetSubDoc);
+        }
+    }
     report.addMember(
         "Devices", [&] {
             std::vector<int> idsList;
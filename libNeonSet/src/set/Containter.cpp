@@ -1,5 +1,7 @@
 #include "Neon/set/Containter.h"
 #include "Neon/set/container/AnchorContainer.h"
+#include "Neon/set/container/FusedMapContainer.h"
+#include "Neon/set/container/WavefrontContainer.h"
 #include "Neon/set/container/SynchronizationContainer.h"
 #include "Neon/set/container/Loader.h"
 
@@ -52,6 +54,34 @@ auto Container::factoryDeviceThenHostManaged(const std::string& name,
     return Container(tmp);
 }
 
+auto Container::factoryFusedMap(const std::string&            name,
+                                int                           setCardinality,
+                                const std::vector<Container>& containers) -> Container
+{
+    std::vector<std::shared_ptr<Neon::set::internal::ContainerAPI>> containerApis;
+    for (auto container : containers) {
+        containerApis.push_back(container.getContainerInterfaceShrPtr());
+    }
+    auto k = new Neon::set::internal::FusedMapContainer(name, setCardinality, containerApis);
+
+    std::shared_ptr<Neon::set::internal::ContainerAPI> tmp(k);
+    return Container(tmp);
+}
+
+auto Container::factoryWavefront(const std::string&            name,
+                                 int                           setCardinality,
+                                 const std::vector<Container>& containers) -> Container
+{
+    std::vector<std::shared_ptr<Neon::set::internal::ContainerAPI>> containerApis;
+    for (auto container : containers) {
+        containerApis.push_back(container.getContainerInterfaceShrPtr());
+    }
+    auto k = new Neon::set::internal::WavefrontContainer(name, setCardinality, containerApis);
+
+    std::shared_ptr<Neon::set::internal::ContainerAPI> tmp(k);
+    return Container(tmp);
+}
+
 auto Container::factoryAnchor(const std::string& name) -> Container
 {
     auto                                               k = new Neon::set::internal::AnchorContainer(name);
@@ -110,6 +140,30 @@ auto Container::getContainerExecutionType() const
     return type;
 }
 
+auto Container::setComputeLambdaCache(bool enabled)
+    -> Container&
+{
+    auto& api = this->getContainerInterface();
+    api.setComputeLambdaCache(enabled);
+    return *this;
+}
+
+auto Container::setOmpLaunchConfig(const Neon::set::OmpLaunchConfig& ompLaunchConfig)
+    -> Container&
+{
+    auto& api = this->getContainerInterface();
+    api.setOmpLaunchConfig(ompLaunchConfig);
+    return *this;
+}
+
+auto Container::setOmpSimd(bool enabled)
+    -> Container&
+{
+    auto& api = this->getContainerInterface();
+    api.setOmpSimd(enabled);
+    return *this;
+}
+
 Container::Container(std::shared_ptr<Neon::set::internal::ContainerAPI>& container)
     : mContainer(container)
 {
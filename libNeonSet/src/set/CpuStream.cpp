@@ -0,0 +1,134 @@
+#include "Neon/set/CpuStream.h"
+
+#include <omp.h>
+
+namespace Neon::set {
+
+CpuStream::CpuStream()
+    : mState(std::make_shared<State>())
+{
+    mWorker = std::thread([state = mState] { helpWorkerLoop(state); });
+}
+
+CpuStream::~CpuStream()
+{
+    {
+        std::unique_lock<std::mutex> lock(mState->mutex);
+        mState->stop = true;
+    }
+    mState->workCondition.notify_all();
+    if (isWorkerThread()) {
+        // The last reference was released by one of our own tasks:
+        // the loop exits on its own and keeps the shared state alive until then
+        mWorker.detach();
+        return;
+    }
+    if (mWorker.joinable()) {
+        mWorker.join();
+    }
+}
+
+auto CpuStream::enqueue(std::function<void()> task) -> void
+{
+    {
+        std::unique_lock<std::mutex> lock(mState->mutex);
+        mState->queue.push_back(std::move(task));
+    }
+    mState->workCondition.notify_one();
+}
+
+auto CpuStream::sync() -> void
+{
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mState->mutex);
+        mState->idleCondition.wait(lock, [this] { return mState->queue.empty() && !mState->busy; });
+        std::swap(error, mState->error);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+auto CpuStream::isWorkerThread() const -> bool
+{
+    return std::this_thread::get_id() == mWorker.get_id();
+}
+
+auto CpuStream::setNumThreads(int numThreads) -> void
+{
+    mState->numThreads = numThreads;
+}
+
+auto CpuStream::helpWorkerLoop(std::shared_ptr<State> state) -> void
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->workCondition.wait(lock, [&state] { return state->stop || !state->queue.empty(); });
+            if (state->queue.empty()) {
+                // stop is set and there is no more pending work
+                return;
+            }
+            task = std::move(state->queue.front());
+            state->queue.pop_front();
+            state->busy = true;
+        }
+
+        const int numThreads = state->numThreads;
+        if (numThreads > 0) {
+            omp_set_num_threads(numThreads);
+        }
+        try {
+            task();
+        } catch (...) {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            if (!state->error) {
+                state->error = std::current_exception();
+            }
+        }
+        // The task may own the last reference to the stream: release it before taking the lock
+        task = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->busy = false;
+            if (state->queue.empty()) {
+                state->idleCondition.notify_all();
+            }
+        }
+    }
+}
+
+auto CpuEvent::record() -> uint64_t
+{
+    return ++mRecorded;
+}
+
+auto CpuEvent::recorded() const -> uint64_t
+{
+    return mRecorded;
+}
+
+auto CpuEvent::signal(uint64_t epoch) -> void
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (epoch > mCompleted) {
+            mCompleted = epoch;
+        }
+    }
+    mCondition.notify_all();
+}
+
+auto CpuEvent::wait(uint64_t epoch) -> void
+{
+    if (mCompleted >= epoch) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [&] { return mCompleted >= epoch; });
+}
+
+}  // namespace Neon::set
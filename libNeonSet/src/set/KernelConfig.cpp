@@ -53,6 +53,13 @@ auto KernelConfig::launchInfoSet()
     return mLaunchInfoSet;
 }
 
+auto KernelConfig::ompLaunchConfig()
+    const
+    -> const OmpLaunchConfig&
+{
+    return mLaunchInfoSet.ompLaunchConfig();
+}
+
 auto KernelConfig::expertSetDataView(const Neon::DataView& dataview)
     -> void
 {
@@ -89,6 +89,16 @@ auto LaunchParameters::set(Neon::sys::GpuLaunchInfo::mode_e mode,
                           shareMemorySize);
 }
 
+auto LaunchParameters::ompLaunchConfig() -> OmpLaunchConfig&
+{
+    return mOmpLaunchConfig;
+}
+
+auto LaunchParameters::ompLaunchConfig() const -> const OmpLaunchConfig&
+{
+    return mOmpLaunchConfig;
+}
+
 
 }  // namespace set
 }  // End of namespace Neon
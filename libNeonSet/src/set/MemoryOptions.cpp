@@ -102,6 +102,30 @@ auto MemoryOptions::setOrder(Neon::MemoryLayout order)
     mMemOrder = order;
 }
 
+auto MemoryOptions::setIOAllocator(Neon::Allocator allocator)
+    -> void
+{
+    helpThrowExceptionIfInitNotCompleted();
+    if (!Neon::AllocatorUtils::compatible(mHostType, allocator)) {
+        Neon::NeonException exception("MemoryOptions");
+        exception << "Allocator " << allocator << " is not compatible with the io device type " << mHostType << ".";
+        NEON_THROW(exception);
+    }
+    mHostAllocator = allocator;
+}
+
+auto MemoryOptions::setFirstTouchTiling(const Neon::sys::FirstTouchTiling& firstTouchTiling)
+    -> void
+{
+    mFirstTouchTiling = firstTouchTiling;
+}
+
+auto MemoryOptions::getFirstTouchTiling() const
+    -> const Neon::sys::FirstTouchTiling&
+{
+    return mFirstTouchTiling;
+}
+
 auto MemoryOptions::helpWasInitCompleted() const -> bool
 {
     const bool check1 = mDeviceAllocator == Neon::Allocator::NULL_MEM;
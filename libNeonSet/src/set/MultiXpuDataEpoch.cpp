@@ -0,0 +1,23 @@
+#include "Neon/set/MultiXpuDataEpoch.h"
+
+namespace Neon::set::interface {
+
+MultiXpuDataEpoch::MultiXpuDataEpoch()
+    : mCounter(std::make_shared<uint64_t>(0))
+{
+}
+
+auto MultiXpuDataEpoch::get() const -> uint64_t
+{
+    return mCounter ? *mCounter : 0;
+}
+
+auto MultiXpuDataEpoch::increment() -> void
+{
+    // Objects that were moved from have no counter
+    if (mCounter) {
+        (*mCounter)++;
+    }
+}
+
+}  // namespace Neon::set::interface
@@ -0,0 +1,154 @@
+#include "Neon/set/OmpLaunchConfig.h"
+
+#include <array>
+#include <sstream>
+
+namespace Neon::set {
+
+auto OmpScheduleUtils::toString(OmpSchedule schedule) -> std::string
+{
+    switch (schedule) {
+        case OmpSchedule::staticSchedule: {
+            return "static";
+        }
+        case OmpSchedule::dynamicSchedule: {
+            return "dynamic";
+        }
+        case OmpSchedule::guidedSchedule: {
+            return "guided";
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto OmpScheduleUtils::fromString(const std::string& schedule) -> OmpSchedule
+{
+    std::array<OmpSchedule, nOptions> schedules{OmpSchedule::staticSchedule,
+                                                OmpSchedule::dynamicSchedule,
+                                                OmpSchedule::guidedSchedule};
+    for (auto a : schedules) {
+        if (toString(a) == schedule) {
+            return a;
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto OmpPartitionModeUtils::toString(OmpPartitionMode mode) -> std::string
+{
+    switch (mode) {
+        case OmpPartitionMode::sequential: {
+            return "sequential";
+        }
+        case OmpPartitionMode::concurrent: {
+            return "concurrent";
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto OmpPartitionModeUtils::fromString(const std::string& mode) -> OmpPartitionMode
+{
+    std::array<OmpPartitionMode, nOptions> modes{OmpPartitionMode::sequential,
+                                                 OmpPartitionMode::concurrent};
+    for (auto a : modes) {
+        if (toString(a) == mode) {
+            return a;
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto OmpStreamModeUtils::toString(OmpStreamMode mode) -> std::string
+{
+    switch (mode) {
+        case OmpStreamMode::synchronous: {
+            return "synchronous";
+        }
+        case OmpStreamMode::asynchronous: {
+            return "asynchronous";
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto OmpStreamModeUtils::fromString(const std::string& mode) -> OmpStreamMode
+{
+    std::array<OmpStreamMode, nOptions> modes{OmpStreamMode::synchronous,
+                                              OmpStreamMode::asynchronous};
+    for (auto a : modes) {
+        if (toString(a) == mode) {
+            return a;
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+OmpLaunchConfig::OmpLaunchConfig(const Neon::index_3d& tile,
+                                 OmpSchedule           schedule,
+                                 int                   chunk)
+{
+    setTile(tile);
+    setSchedule(schedule, chunk);
+}
+
+auto OmpLaunchConfig::tile() const -> const Neon::index_3d&
+{
+    return mTile;
+}
+
+auto OmpLaunchConfig::schedule() const -> OmpSchedule
+{
+    return mSchedule;
+}
+
+auto OmpLaunchConfig::chunk() const -> int
+{
+    return mChunk;
+}
+
+auto OmpLaunchConfig::setTile(const Neon::index_3d& tile) -> OmpLaunchConfig&
+{
+    if (tile.x < 0 || tile.y < 0 || tile.z < 0) {
+        NeonException exp("OmpLaunchConfig");
+        exp << "Invalid tile shape " << tile.to_string() << ", components must be non negative.";
+        NEON_THROW(exp);
+    }
+    mTile = tile;
+    return *this;
+}
+
+auto OmpLaunchConfig::setSchedule(OmpSchedule schedule, int chunk) -> OmpLaunchConfig&
+{
+    if (chunk <= 0) {
+        NeonException exp("OmpLaunchConfig");
+        exp << "Invalid chunk size " << chunk << ", it must be positive.";
+        NEON_THROW(exp);
+    }
+    mSchedule = schedule;
+    mChunk = chunk;
+    return *this;
+}
+
+auto OmpLaunchConfig::simd() const -> bool
+{
+    return mSimd;
+}
+
+auto OmpLaunchConfig::setSimd(bool enabled) -> OmpLaunchConfig&
+{
+    mSimd = enabled;
+    return *this;
+}
+
+auto OmpLaunchConfig::toString() const -> std::string
+{
+    std::stringstream s;
+    s << "tile " << mTile.to_string() << " schedule " << OmpScheduleUtils::toString(mSchedule) << " chunk " << mChunk;
+    if (mSimd) {
+        s << " simd";
+    }
+    return s.str();
+}
+
+}  // namespace Neon::set
@@ -0,0 +1,36 @@
+#include "Neon/set/OmpNestedScope.h"
+#include <omp.h>
+#include "Neon/core/core.h"
+
+namespace Neon::set {
+
+OmpNestedScope::OmpNestedScope(bool enable)
+    : mEnabled(enable)
+{
+    if (!mEnabled) {
+        return;
+    }
+#ifdef NEON_OS_WINDOWS
+    mPreviousNested = omp_get_nested();
+    omp_set_nested(1);
+#else
+    mPreviousMaxActiveLevels = omp_get_max_active_levels();
+    if (mPreviousMaxActiveLevels < omp_get_level() + 2) {
+        omp_set_max_active_levels(omp_get_level() + 2);
+    }
+#endif
+}
+
+OmpNestedScope::~OmpNestedScope()
+{
+    if (!mEnabled) {
+        return;
+    }
+#ifdef NEON_OS_WINDOWS
+    omp_set_nested(mPreviousNested);
+#else
+    omp_set_max_active_levels(mPreviousMaxActiveLevels);
+#endif
+}
+
+}  // namespace Neon::set
@@ -11,6 +11,31 @@ auto ContainerAPI::
     mParsed.push_back(dataParsing);
 }
 
+auto ContainerAPI::
+    mergeTokens(const std::vector<Neon::set::dataDependency::Token>& tokens)
+        -> void
+{
+    for (const auto& token : tokens) {
+        bool foundMatch = false;
+        for (auto& acceptedToken : mParsed) {
+            if (token.uid() == acceptedToken.uid()) {
+                if (token.compute() == Neon::Pattern::STENCIL &&
+                    acceptedToken.compute() != Neon::Pattern::STENCIL) {
+                    auto merged = token;
+                    merged.mergeAccess(acceptedToken.access());
+                    acceptedToken = merged;
+                } else {
+                    acceptedToken.mergeAccess(token.access());
+                }
+                foundMatch = true;
+            }
+        }
+        if (!foundMatch) {
+            mParsed.push_back(token);
+        }
+    }
+}
+
 auto ContainerAPI::
     getName() const
     -> const std::string&
@@ -59,6 +84,40 @@ auto ContainerAPI::
     return mDataViewSupport;
 }
 
+auto ContainerAPI::
+    setOmpLaunchConfig(const Neon::set::OmpLaunchConfig& ompLaunchConfig) -> void
+{
+    for (auto& launchParameters : mLaunchParameters) {
+        launchParameters.ompLaunchConfig() = ompLaunchConfig;
+    }
+}
+
+auto ContainerAPI::
+    getOmpLaunchConfig(Neon::DataView dw) const -> const Neon::set::OmpLaunchConfig&
+{
+    return mLaunchParameters[DataViewUtil::toInt(dw)].ompLaunchConfig();
+}
+
+auto ContainerAPI::
+    setOmpSimd(bool enabled) -> void
+{
+    for (auto& launchParameters : mLaunchParameters) {
+        launchParameters.ompLaunchConfig().setSimd(enabled);
+    }
+}
+
+auto ContainerAPI::
+    setComputeLambdaCache(bool enabled) -> void
+{
+    mComputeLambdaCache = enabled;
+}
+
+auto ContainerAPI::
+    isComputeLambdaCacheEnabled() const -> bool
+{
+    return mComputeLambdaCache;
+}
+
 auto ContainerAPI::
     setDataViewSupport(ContainerAPI::DataViewSupport dataViewSupport)
         -> void
@@ -233,6 +292,83 @@ auto ContainerAPI::
     NEON_THROW(exp);
 }
 
+auto ContainerAPI::
+    isTileable()
+        const -> bool
+{
+    return false;
+}
+
+auto ContainerAPI::
+    getTilingUid()
+        const -> size_t
+{
+    std::string         description = helpGetNameForError();
+    Neon::NeonException exp("ContainerAPI");
+    exp << description << " "
+        << "getTilingUid"
+        << " is not supported.";
+    NEON_THROW(exp);
+}
+
+auto ContainerAPI::
+    getTileSpace(Neon::SetIdx /*setIdx*/,
+                 Neon::DataView /*dataView*/)
+        const -> Neon::index_3d
+{
+    std::string         description = helpGetNameForError();
+    Neon::NeonException exp("ContainerAPI");
+    exp << description << " "
+        << "getTileSpace"
+        << " is not supported.";
+    NEON_THROW(exp);
+}
+
+auto ContainerAPI::
+    getTileShape(Neon::SetIdx /*setIdx*/,
+                 Neon::DataView /*dataView*/)
+        const -> Neon::index_3d
+{
+    std::string         description = helpGetNameForError();
+    Neon::NeonException exp("ContainerAPI");
+    exp << description << " "
+        << "getTileShape"
+        << " is not supported.";
+    NEON_THROW(exp);
+}
+
+auto ContainerAPI::
+    hasStructuredTileSpace()
+        const -> bool
+{
+    return false;
+}
+
+auto ContainerAPI::
+    getStencilRadius()
+        const -> int
+{
+    std::string         description = helpGetNameForError();
+    Neon::NeonException exp("ContainerAPI");
+    exp << description << " "
+        << "getStencilRadius"
+        << " is not supported.";
+    NEON_THROW(exp);
+}
+
+auto ContainerAPI::
+    newTileRunner(Neon::SetIdx /*setIdx*/,
+                  Neon::DataView /*dataView*/)
+        -> TileRunner
+{
+    std::string         description = helpGetNameForError();
+    Neon::NeonException exp("ContainerAPI");
+    exp << description << " "
+        << "newTileRunner"
+        << " is not supported.";
+    NEON_THROW(exp);
+}
+
 
 auto ContainerAPI::
  configureWithScheduling([[maybe_unused]] Neon::set::container::GraphNode& graphNode)
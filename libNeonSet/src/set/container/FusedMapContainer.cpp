@@ -0,0 +1,120 @@
+#include "Neon/set/container/FusedMapContainer.h"
+#include "Neon/set/dependency/Token.h"
+
+#include <algorithm>
+
+namespace Neon::set::internal {
+
+FusedMapContainer::
+    FusedMapContainer(const std::string&                                                    name,
+                      int                                                                   setCardinality,
+                      const std::vector<std::shared_ptr<Neon::set::internal::ContainerAPI>>& containers)
+    : mContainers(containers),
+      mSetCardinality(setCardinality)
+{
+    if (mContainers.empty()) {
+        Neon::NeonException exp("FusedMapContainer");
+        exp << "A fused container requires at least one container.";
+        NEON_THROW(exp);
+    }
+
+    setName(name);
+    setContainerExecutionType(ContainerExecutionType::device);
+    setContainerOperationType(ContainerOperationType::compute);
+
+    DataViewSupport dataViewSupport = DataViewSupport::on;
+    for (auto const& container : mContainers) {
+        if (container->getDataViewSupport() == DataViewSupport::off) {
+            dataViewSupport = DataViewSupport::off;
+        }
+    }
+    setDataViewSupport(dataViewSupport);
+
+    this->parse();
+}
+
+auto FusedMapContainer::
+    parse()
+        -> const std::vector<Neon::set::dataDependency::Token>&
+{
+    if (!this->isParsingDataUpdated()) {
+        for (auto& container : mContainers) {
+            mergeTokens(container->parse());
+        }
+        this->setParsingDataUpdated(true);
+        setContainerPattern(getTokens());
+    }
+    return getTokens();
+}
+
+auto FusedMapContainer::
+    run(int            streamIdx,
+        Neon::DataView dataView)
+        -> void
+{
+    for (int setIdx = 0; setIdx < mSetCardinality; setIdx++) {
+        run(Neon::SetIdx(setIdx), streamIdx, dataView);
+    }
+}
+
+auto FusedMapContainer::
+    run(Neon::SetIdx   setIdx,
+        int            streamIdx,
+        Neon::DataView dataView)
+        -> void
+{
+    const Neon::index_3d space = mContainers[0]->getTileSpace(setIdx, dataView);
+    const Neon::index_3d tile = mContainers[0]->getTileShape(setIdx, dataView);
+
+    bool sameTiling = true;
+    for (auto const& container : mContainers) {
+        if (container->getTileSpace(setIdx, dataView) != space ||
+            container->getTileShape(setIdx, dataView) != tile) {
+            sameTiling = false;
+        }
+    }
+    if (!sameTiling) {
+        for (auto& container : mContainers) {
+            container->run(setIdx, streamIdx, dataView);
+        }
+        return;
+    }
+    if (space.x <= 0 || space.y <= 0 || space.z <= 0) {
+        return;
+    }
+
+    // Runners are created by the calling thread as they extract the compute lambdas
+    std::vector<TileRunner> runners;
+    runners.reserve(mContainers.size());
+    for (auto& container : mContainers) {
+        runners.push_back(container->newTileRunner(setIdx, dataView));
+    }
+
+    const Neon::index_3d nTiles((space.x + tile.x - 1) / tile.x,
+                                (space.y + tile.y - 1) / tile.y,
+                                (space.z + tile.z - 1) / tile.z);
+    const int            nTotalTiles = static_cast<int>(nTiles.rMulTyped<int64_t>());
+
+#pragma omp parallel for default(shared) schedule(static)
+    for (int tileIdx = 0; tileIdx < nTotalTiles; tileIdx++) {
+        const int            tx = tileIdx % nTiles.x;
+        const int            ty = (tileIdx / nTiles.x) % nTiles.y;
+        const int            tz = tileIdx / (nTiles.x * nTiles.y);
+        const Neon::index_3d begin(tx * tile.x, ty * tile.y, tz * tile.z);
+        const Neon::index_3d end(std::min(begin.x + tile.x, space.x),
+                                 std::min(begin.y + tile.y, space.y),
+                                 std::min(begin.z + tile.z, space.z));
+        for (auto& runner : runners) {
+            runner(begin, end);
+        }
+    }
+}
+
+auto FusedMapContainer::
+    getNumberOfFusedContainers()
+        const -> int
+{
+    return static_cast<int>(mContainers.size());
+}
+
+}  // namespace Neon::set::internal
@@ -1,6 +1,10 @@
 #include "Neon/set/container/Graph.h"
+#include <omp.h>
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include "Neon/set/Containter.h"
+#include "Neon/set/OmpNestedScope.h"
 #include "Neon/set/container/graph/Bfs.h"
 #ifdef NEON_USE_NVTX
 #include <nvtx3/nvToolsExt.h>
@@ -658,6 +662,7 @@ auto Graph::
     int maxEventId = helpComputeScheduling_03_events(mBfs);
     helpComputeScheduling_04_ensureResources(maxStreamId, maxEventId);
     helpComputeScheduling_05_executionOrder(filterOutAnchors, mBfs);
+    helpComputeScheduling_06_taskDependencies(mBfs);
 }
 
 auto Graph::
@@ -901,6 +906,25 @@ auto Graph::helpComputeScheduling_05_executionOrder(bool filterOutAnchors, Bfs&
     }
 }
 
+auto Graph::helpComputeScheduling_06_taskDependencies(Bfs& bfs) -> void
+{
+    // Scheduling dependencies only order work on streams, they are not needed for correctness.
+    bfs.forEachNodeByLevel(*this, [&](GraphNode& node, int /*levelId*/) {
+        const auto uid = node.getGraphData().getUid();
+        auto       outNgh = helpGetOutNeighbors(uid, false, {GraphDependencyType::data,
+                                                             GraphDependencyType::user});
+        for (auto nghUid : outNgh) {
+            auto& ngh = helpGetGraphNode(nghUid);
+            if (ngh.getScheduling().getExecutionOrder() < 0) {
+                // The node is not part of the execution (e.g. a filtered out anchor)
+                continue;
+            }
+            node.getScheduling().getSubsequentTasks().push_back(ngh.getScheduling().getExecutionOrder());
+            ngh.getScheduling().setNumberOfProceedingTasks(ngh.getScheduling().getNumberOfProceedingTasks() + 1);
+        }
+    });
+}
+
 Graph::
     Graph(const Backend& bk)
 {
@@ -1013,13 +1037,17 @@ auto Graph::
             for (auto toBeWaited : waitingEvents) {
                 mBackend.waitEventOnStream(toBeWaited, stream);
             }
+            // On an asynchronous OpenMP backend the container is queued on the worker of its stream,
+            // otherwise it runs right away on the calling thread.
+            mBackend.runOnStream(stream, [container, stream, dataView = scheduling.getDataView()]() mutable {
 #ifdef NEON_USE_NVTX
-            nvtxRangePush((std::string("Container Run") + container.getName()).c_str());
+                nvtxRangePush((std::string("Container Run") + container.getName()).c_str());
 #endif
-            container.run(stream, scheduling.getDataView());
+                container.run(stream, dataView);
 #ifdef NEON_USE_NVTX
-            nvtxRangePop();
+                nvtxRangePop();
 #endif
+            });
             if (signalEvents >= 0) {
                 mBackend.pushEventOnStream(signalEvents, stream);
             }
@@ -1069,6 +1097,93 @@ auto Graph::
     // #endif
 }
 
+auto Graph::
+    helpExecuteWithOmpTasks(int anchorStream)
+        -> void
+{
+    if (anchorStream > -1 && (anchorStream != mAnchorStreamPreSet || mFilterOutAnchorsPreSet == true)) {
+        Neon::NeonException ex("");
+        ex << "Execution parameters are inconsistent with the preset ones.";
+        NEON_THROW(ex);
+    }
+
+    if (mBackend.runtime() != Neon::Runtime::openmp) {
+        // Device containers return once their work is queued on a stream,
+        // so completion on the host does not release the dependent nodes.
+        helpExecuteWithOmpAtNodeLevel(anchorStream);
+        return;
+    }
+
+    std::vector<GraphNode*> tasks;
+    int                     maxLevelWidth = 1;
+    for (int i = 0; i < mBfs.getNumberOfLevels(); i++) {
+        int levelWidth = 0;
+        mBfs.forEachNodeAtLevel(i, *this, [&](Neon::set::container::GraphNode& graphNode) {
+            tasks.push_back(&graphNode);
+            levelWidth++;
+        });
+        maxLevelWidth = std::max(maxLevelWidth, levelWidth);
+    }
+    const int nTasks = int(tasks.size());
+    std::sort(tasks.begin(), tasks.end(), [](const GraphNode* a, const GraphNode* b) {
+        return a->getScheduling().getExecutionOrder() < b->getScheduling().getExecutionOrder();
+    });
+
+    std::vector<std::atomic<int>> pendingDependencies(nTasks);
+    for (int t = 0; t < nTasks; t++) {
+        pendingDependencies[t] = tasks[t]->getScheduling().getNumberOfProceedingTasks();
+    }
+
+    // The widest BFS level bounds the number of nodes that are likely to be ready at the same time.
+    // The pool gets one thread per such node, and the parallel loops of each container
+    // share the remaining threads through nested parallelism.
+    const int nThreads = omp_get_max_threads();
+    const int poolSize = std::max(1, std::min(nThreads, maxLevelWidth));
+    const int threadsPerTask = std::max(1, nThreads / poolSize);
+
+    // The previous nesting setting is restored when the graph completes
+    Neon::set::OmpNestedScope nestedScope(threadsPerTask > 1);
+
+    std::function<void(int)> runTask = [&](int taskIdx) {
+        auto&       graphNode = *tasks[taskIdx];
+        auto&       scheduling = graphNode.getScheduling();
+        auto&       container = graphNode.getContainer();
+        omp_set_num_threads(threadsPerTask);
+#ifdef NEON_USE_NVTX
+        nvtxRangePush((std::string("Container Run") + container.getName()).c_str());
+#endif
+        container.run(scheduling.getStream(), scheduling.getDataView());
+#ifdef NEON_USE_NVTX
+        nvtxRangePop();
+#endif
+        for (int subsequentIdx : scheduling.getSubsequentTasks()) {
+            if (pendingDependencies[subsequentIdx].fetch_sub(1) == 1) {
+#pragma omp task default(shared) firstprivate(subsequentIdx)
+                runTask(subsequentIdx);
+            }
+        }
+    };
+
+#ifdef NEON_USE_NVTX
+    nvtxRangePush("Graph Iteration");
+#endif
+#pragma omp parallel num_threads(poolSize) default(shared)
+    {
+#pragma omp single
+        {
+            for (int t = 0; t < nTasks; t++) {
+                if (tasks[t]->getScheduling().getNumberOfProceedingTasks() == 0) {
+#pragma omp task default(shared) firstprivate(t)
+                    runTask(t);
+                }
+            }
+        }
+    }
+#ifdef NEON_USE_NVTX
+    nvtxRangePop();
+#endif
+}
+
 auto Graph::runtimePreSet(int anchorStream) -> void
 {
     helpComputeScheduling(false, anchorStream);
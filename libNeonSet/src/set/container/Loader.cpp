@@ -12,6 +12,11 @@ auto Loader::
     return m_loadingMode == Neon::set::internal::LoadingMode_e::EXTRACT_LAMBDA;
 }
 
+auto Loader::recordEpochs(std::vector<Neon::set::interface::MultiXpuDataEpoch>* epochs) -> void
+{
+    mEpochs = epochs;
+}
+
 auto Loader::getExecution() const -> Neon::Execution
 {
     return mExecution;
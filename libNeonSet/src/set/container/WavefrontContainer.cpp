@@ -0,0 +1,124 @@
+#include "Neon/set/container/WavefrontContainer.h"
+#include "Neon/set/dependency/Token.h"
+
+#include <algorithm>
+
+namespace Neon::set::internal {
+
+WavefrontContainer::
+    WavefrontContainer(const std::string&                                                    name,
+                       int                                                                   setCardinality,
+                       const std::vector<std::shared_ptr<Neon::set::internal::ContainerAPI>>& containers)
+    : mContainers(containers),
+      mSetCardinality(setCardinality)
+{
+    if (mContainers.empty()) {
+        Neon::NeonException exp("WavefrontContainer");
+        exp << "A wavefront container requires at least one container.";
+        NEON_THROW(exp);
+    }
+
+    setName(name);
+    setContainerExecutionType(ContainerExecutionType::device);
+    setContainerOperationType(ContainerOperationType::compute);
+    setDataViewSupport(DataViewSupport::off);
+
+    this->parse();
+}
+
+auto WavefrontContainer::
+    parse()
+        -> const std::vector<Neon::set::dataDependency::Token>&
+{
+    if (!this->isParsingDataUpdated()) {
+        for (auto& container : mContainers) {
+            mergeTokens(container->parse());
+        }
+        this->setParsingDataUpdated(true);
+        setContainerPattern(getTokens());
+    }
+    return getTokens();
+}
+
+auto WavefrontContainer::
+    run(int            streamIdx,
+        Neon::DataView dataView)
+        -> void
+{
+    for (int setIdx = 0; setIdx < mSetCardinality; setIdx++) {
+        run(Neon::SetIdx(setIdx), streamIdx, dataView);
+    }
+}
+
+auto WavefrontContainer::
+    run(Neon::SetIdx   setIdx,
+        int            streamIdx,
+        Neon::DataView dataView)
+        -> void
+{
+    const Neon::index_3d space = mContainers[0]->getTileSpace(setIdx, dataView);
+    const Neon::index_3d tile = mContainers[0]->getTileShape(setIdx, dataView);
+
+    bool canUseWavefront = mSetCardinality == 1 && dataView == Neon::DataView::STANDARD;
+    int  radius = 1;
+    for (auto const& container : mContainers) {
+        if (!container->hasStructuredTileSpace() ||
+            container->getTileSpace(setIdx, dataView) != space) {
+            canUseWavefront = false;
+            break;
+        }
+        radius = std::max(radius, container->getStencilRadius());
+    }
+    if (!canUseWavefront) {
+        for (auto& container : mContainers) {
+            container->run(setIdx, streamIdx, dataView);
+        }
+        return;
+    }
+    if (space.x <= 0 || space.y <= 0 || space.z <= 0) {
+        return;
+    }
+
+    // Runners are created by the calling thread as they extract the compute lambdas
+    std::vector<TileRunner> runners;
+    runners.reserve(mContainers.size());
+    for (auto& container : mContainers) {
+        runners.push_back(container->newTileRunner(setIdx, dataView));
+    }
+
+    // Slabs along z are as thin as the stencil allows to keep the wavefront in cache.
+    // Within a slab, the x-y tiles of the OpenMP launch configuration are used.
+    const int  nContainers = static_cast<int>(mContainers.size());
+    const int  slab = radius;
+    const int  nSlabs = (space.z + slab - 1) / slab;
+    const int  lag = 2;
+    const int  nTilesX = (space.x + tile.x - 1) / tile.x;
+    const int  nTilesY = (space.y + tile.y - 1) / tile.y;
+    const int  nTilesPerSlab = nTilesX * nTilesY;
+    const int  nSteps = nSlabs + lag * (nContainers - 1);
+
+    for (int step = 0; step < nSteps; step++) {
+        // Containers working on a valid slab at this step of the wavefront
+        const int firstContainer = std::max(0, (step - nSlabs + lag) / lag);
+        const int lastContainer = std::min(nContainers - 1, step / lag);
+        const int nActiveContainers = lastContainer - firstContainer + 1;
+        const int nWorkItems = nActiveContainers * nTilesPerSlab;
+
+#pragma omp parallel for default(shared) schedule(static)
+        for (int workIdx = 0; workIdx < nWorkItems; workIdx++) {
+            const int containerIdx = firstContainer + workIdx / nTilesPerSlab;
+            const int slabIdx = step - lag * containerIdx;
+            const int tileIdx = workIdx % nTilesPerSlab;
+            const int tx = tileIdx % nTilesX;
+            const int ty = tileIdx / nTilesX;
+
+            const Neon::index_3d begin(tx * tile.x, ty * tile.y, slabIdx * slab);
+            const Neon::index_3d end(std::min(begin.x + tile.x, space.x),
+                                     std::min(begin.y + tile.y, space.y),
+                                     std::min(begin.z + slab, space.z));
+            runners[containerIdx](begin, end);
+        }
+    }
+}
+
+}  // namespace Neon::set::internal
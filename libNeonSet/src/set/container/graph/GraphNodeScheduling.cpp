@@ -59,6 +59,8 @@ auto GraphNodeScheduling::reset() -> void
     mEvent = -1;
     mExecutionOrder = -1;
     mDependentEvents.clear();
+    mSubsequentTasks.clear();
+    mNumberOfProceedingTasks = 0;
 }
 
 auto GraphNodeScheduling::getExecutionOrder()
@@ -73,5 +75,29 @@ auto GraphNodeScheduling::setExecutionOerder(int order)
     mExecutionOrder = order;
 }
 
+auto GraphNodeScheduling::getSubsequentTasks()
+    -> std::vector<int>&
+{
+    return mSubsequentTasks;
+}
+
+auto GraphNodeScheduling::getSubsequentTasks()
+    const -> const std::vector<int>&
+{
+    return mSubsequentTasks;
+}
+
+auto GraphNodeScheduling::getNumberOfProceedingTasks() const
+    -> int
+{
+    return mNumberOfProceedingTasks;
+}
+
+auto GraphNodeScheduling::setNumberOfProceedingTasks(int n)
+    -> void
+{
+    mNumberOfProceedingTasks = n;
+}
+
 
 }  // namespace Neon::set::container
@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+
+#include "Neon/Neon.h"
+
+#include "Neon/set/Backend.h"
+#include "Neon/set/CpuStream.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+TEST(cpuStream, fifoOrder)
+{
+    Neon::set::CpuStream stream;
+    std::vector<int>     order;
+    for (int i = 0; i < 100; i++) {
+        stream.enqueue([&order, i] { order.push_back(i); });
+    }
+    stream.sync();
+    ASSERT_EQ(order.size(), size_t(100));
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(order[i], i);
+    }
+}
+
+TEST(cpuStream, exceptionIsRethrownBySync)
+{
+    Neon::set::CpuStream stream;
+    stream.enqueue([] { throw std::runtime_error("task failure"); });
+    ASSERT_ANY_THROW(stream.sync());
+    ASSERT_NO_THROW(stream.sync());
+}
+
+TEST(cpuStream, destroyedByItsOwnTask)
+{
+    for (int iteration = 0; iteration < 50; iteration++) {
+        auto                                stream = std::make_shared<Neon::set::CpuStream>();
+        std::atomic<int>                    done{0};
+        std::weak_ptr<Neon::set::CpuStream> observer = stream;
+
+        // The first task waits until it holds the last reference, then drops it from the worker thread
+        stream->enqueue([&done, owner = stream]() mutable {
+            while (owner.use_count() > 1) {
+                std::this_thread::yield();
+            }
+            owner.reset();
+            done = 1;
+        });
+        stream.reset();
+
+        while (done == 0) {
+            std::this_thread::yield();
+        }
+        ASSERT_TRUE(observer.expired());
+    }
+    // Give the detached workers the time to leave their loop
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+}
+
+TEST(cpuStream, backendEventsOrderStreams)
+{
+    Neon::Backend backend(2, Neon::Runtime::openmp);
+    backend.setAvailableStreamSet(3);
+    backend.setAvailableUserEvents(2);
+    backend.setOmpStreamMode(Neon::set::OmpStreamMode::asynchronous);
+
+    for (int iteration = 0; iteration < 50; iteration++) {
+        std::atomic<int> producer{0};
+        int              consumer = 0;
+
+        backend.runOnStream(1, [&] {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            producer = 1;
+        });
+        backend.pushEventOnStream(0, 1);
+        backend.waitEventOnStream(0, 2);
+        backend.runOnStream(2, [&] { consumer = producer + 1; });
+        backend.pushEventOnStream(1, 2);
+        // The main stream is the calling thread: the wait blocks until stream 2 is done
+        backend.waitEventOnStream(1, Neon::Backend::mainStreamIdx);
+        ASSERT_EQ(consumer, 2);
+    }
+    backend.syncAll();
+}
+
+TEST(cpuStream, synchronousModeRunsInline)
+{
+    Neon::Backend backend(1, Neon::Runtime::openmp);
+    backend.setAvailableStreamSet(2);
+    const auto caller = std::this_thread::get_id();
+    bool       isInline = false;
+    backend.runOnStream(1, [&] { isInline = std::this_thread::get_id() == caller; });
+    ASSERT_TRUE(isInline);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    Neon::init();
+    return RUN_ALL_TESTS();
+}
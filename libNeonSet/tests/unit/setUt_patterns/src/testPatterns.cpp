@@ -244,6 +244,43 @@ TEST(BlasSet, Dot)
     }
 }
 
+TEST(BlasSet, OpenMP)
+{
+    using dataT = double;
+    int               buffer_size = 1024;
+    size_t            num_sets = 3;
+    std::vector<int>  dev_ids(num_sets, 0);
+    Neon::set::DevSet dev_set(Neon::DeviceType::CPU, dev_ids);
+    auto              start_id = dev_set.newDataSet<int>(0);
+    auto              num_elements = dev_set.newDataSet<int>(int(buffer_size));
+    auto              input1 = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CPU,
+                                              Neon::Allocator::MALLOC,
+                                              buffer_size);
+    auto              input2 = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CPU,
+                                              Neon::Allocator::MALLOC,
+                                              buffer_size);
+    auto              output = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CPU,
+                                              Neon::Allocator::MALLOC,
+                                              1);
+    for (int32_t i = 0; i < int32_t(num_sets); ++i) {
+        for (int j = 0; j < buffer_size; ++j) {
+            input1.mem(i)[j] = -2;
+            input2.mem(i)[j] = 2;
+        }
+    }
+
+    Neon::set::patterns::BlasSet<dataT> pattern(dev_set, Neon::sys::patterns::Engine::OpenMP);
+
+    dataT result = pattern.absoluteSum(input1, output, start_id, num_elements);
+    EXPECT_NEAR(result, 2.0 * num_sets * buffer_size, 0.001);
+
+    result = pattern.dot(input1, input2, output, start_id, num_elements);
+    EXPECT_NEAR(result, -2.0 * 2.0 * num_sets * buffer_size, 0.001);
+
+    result = pattern.norm2(input1, output, start_id, num_elements);
+    EXPECT_NEAR(result, std::sqrt(2.0 * 2.0 * num_sets * buffer_size), 0.001);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -8,12 +8,13 @@ namespace Neon::skeleton {
 enum class Executor
 {
     ompAtNodeLevel,
-    ompAtGraphLevel
+    ompAtGraphLevel,
+    ompTaskGraph /**< graph nodes run as OpenMP tasks, each released when its dependencies are completed */
 };
 
 struct ExecutorUtils
 {
-    static constexpr int nOptions = 2;
+    static constexpr int nOptions = 3;
 
     static auto toString(Executor forkJoin) -> std::string;
     static auto toInt(Executor forkJoin) -> int;
@@ -0,0 +1,28 @@
+#pragma once
+#include "Neon/Report.h"
+#include "Neon/set/Backend.h"
+#include "Neon/set/Containter.h"
+
+namespace Neon::skeleton {
+
+/**
+ * Container fusion applied by the skeleton before the dependency graph is built.
+ */
+enum class Fusion
+{
+    none /**< Containers are executed as provided by the user */,
+    map /**< consecutive map Containers on the same grid are executed in a single traversal (OpenMP runtime only) */,
+    wavefront /**< as map, and sequences of map and stencil Containers on a single partition dense grid
+                   are executed with temporal blocking along z (OpenMP runtime only) */,
+};
+
+struct FusionUtils
+{
+    static constexpr int nOptions = 3;
+
+    static auto toString(Fusion fusion) -> std::string;
+    static auto fromString(const std::string& fusion) -> Fusion;
+    static auto getOptions() -> std::array<Fusion, nOptions>;
+};
+
+}  // namespace Neon::skeleton
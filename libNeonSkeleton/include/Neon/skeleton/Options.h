@@ -3,6 +3,7 @@
 #include "Neon/set/Backend.h"
 #include "Neon/set/Containter.h"
 #include "Neon/skeleton/Executor.h"
+#include "Neon/skeleton/Fusion.h"
 #include "Neon/skeleton/Occ.h"
 
 namespace Neon::skeleton {
@@ -14,7 +15,10 @@ struct Options
     /**
      * Constructor that defines options for the skeleton
      */
-    explicit Options(Occ occ, Neon::set::TransferMode transferMode = Neon::set::TransferMode::get);
+    explicit Options(Occ                      occ,
+                     Neon::set::TransferMode  transferMode = Neon::set::TransferMode::get,
+                     Neon::skeleton::Executor executor = Neon::skeleton::Executor::ompAtNodeLevel,
+                     Neon::skeleton::Fusion   fusion = Neon::skeleton::Fusion::none);
     explicit Options() = default;
 
     void reportStore(Neon::Report& report);
@@ -22,11 +26,13 @@ struct Options
     auto occ() const -> Occ;
     auto transferMode() const -> Neon::set::TransferMode;
     auto executor()const -> Neon::skeleton::Executor;
+    auto fusion() const -> Neon::skeleton::Fusion;
 
    private:
     Neon::set::TransferMode  mTransferMode{Neon::set::TransferMode::get};
     Neon::skeleton::Occ      mOcc = Occ::none;
     Neon::skeleton::Executor mExecutor = Neon::skeleton::Executor::ompAtNodeLevel;
+    Neon::skeleton::Fusion   mFusion = Neon::skeleton::Fusion::none;
 };
 
 }  // namespace Neon::skeleton
\ No newline at end of file
@@ -135,6 +135,15 @@ struct MultiXpuGraph
 
 
    private:
+    /**
+     * Replaces sequences of consecutive Containers running on the same grid with fused Containers
+     * (see Neon::skeleton::Fusion). The returned list is the one used to build the dependency graph.
+     */
+    auto fuseContainers(const Neon::Backend&                     bk,
+                        const std::vector<Neon::set::Container>& operations,
+                        const Neon::skeleton::Options&           options)
+        -> std::vector<Neon::set::Container>;
+
     auto helpAddNewContainerToGraph(const Neon::set::Container& container)
         -> Neon::set::container::GraphInfo::NodeUid;
 
@@ -11,6 +11,9 @@ auto ExecutorUtils::toString(Executor option) -> std::string
         case Executor::ompAtGraphLevel: {
             return "ompAtGraphLevel";
         }
+        case Executor::ompTaskGraph: {
+            return "ompTaskGraph";
+        }
     }
     NEON_THROW_UNSUPPORTED_OPTION("");
 }
@@ -28,7 +31,7 @@ auto ExecutorUtils::fromString(const std::string& forkJoin) -> Executor
 
 auto ExecutorUtils::getOptions() -> std::array<Executor, nOptions>
 {
-    std::array<Executor, nOptions> options{Executor::ompAtGraphLevel, Executor::ompAtNodeLevel};
+    std::array<Executor, nOptions> options{Executor::ompAtGraphLevel, Executor::ompAtNodeLevel, Executor::ompTaskGraph};
     return options;
 }
 
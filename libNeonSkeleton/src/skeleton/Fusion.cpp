@@ -0,0 +1,37 @@
+#include "Neon/skeleton/Fusion.h"
+
+namespace Neon::skeleton {
+
+auto FusionUtils::toString(Fusion fusion) -> std::string
+{
+    switch (fusion) {
+        case Fusion::none: {
+            return "none";
+        }
+        case Fusion::map: {
+            return "map";
+        }
+        case Fusion::wavefront: {
+            return "wavefront";
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto FusionUtils::fromString(const std::string& fusion) -> Fusion
+{
+    for (auto a : getOptions()) {
+        if (toString(a) == fusion) {
+            return a;
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto FusionUtils::getOptions() -> std::array<Fusion, nOptions>
+{
+    std::array<Fusion, nOptions> opts = {Fusion::none, Fusion::map, Fusion::wavefront};
+    return opts;
+}
+
+}  // namespace Neon::skeleton
@@ -3,11 +3,15 @@
 namespace Neon {
 namespace skeleton {
 
-Options::Options(Occ                       occEOpt,
-                 Neon::set::TransferMode trensferModeOpt)
+Options::Options(Occ                      occEOpt,
+                 Neon::set::TransferMode  trensferModeOpt,
+                 Neon::skeleton::Executor executorOpt,
+                 Neon::skeleton::Fusion   fusionOpt)
 {
     mOcc = occEOpt;
     mTransferMode = trensferModeOpt;
+    mExecutor = executorOpt;
+    mFusion = fusionOpt;
 }
 
 void Options::reportStore(Neon::Report& report)
@@ -16,6 +20,8 @@ void Options::reportStore(Neon::Report& report)
     auto subdoc = report.getSubdoc();
     report.addMember("OCC", OccUtils::toString(mOcc), &subdoc);
     report.addMember("TransferMode", Neon::set::TransferModeUtils::toString(mTransferMode), &subdoc);
+    report.addMember("Executor", ExecutorUtils::toString(mExecutor), &subdoc);
+    report.addMember("Fusion", FusionUtils::toString(mFusion), &subdoc);
     report.addSubdoc("SkeletonOptions", subdoc);
 }
 
@@ -33,5 +39,10 @@ auto Options::executor() const -> Neon::skeleton::Executor
     return mExecutor;
 }
 
+auto Options::fusion() const -> Neon::skeleton::Fusion
+{
+    return mFusion;
+}
+
 }  // namespace skeleton
 }  // namespace Neon
\ No newline at end of file
@@ -7,12 +7,12 @@ namespace skeleton {
 Skeleton::Skeleton(const Neon::Backend& bk)
 {
     setBackend(bk);
-    m_inited = true;
 }
 
 void Skeleton::setBackend(const Neon::Backend& bk)
 {
     mBackend = bk;
+    m_inited = true;
 }
 
 }  // namespace skeleton
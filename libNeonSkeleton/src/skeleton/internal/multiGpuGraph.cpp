@@ -9,8 +9,10 @@ void MultiXpuGraph::init(Neon::Backend&                           bk,
                          Options options)
 {
     getGraph() = Neon::set::container::Graph(bk);
+    // Fusion works on the user's sequence of Containers, before dependencies are extracted
+    auto fusedOperations = fuseContainers(bk, operations, options);
     parse(bk.devSet().setCardinality(),
-          std::forward<const std::vector<Neon::set::Container>&&>(operations));
+          std::forward<const std::vector<Neon::set::Container>&&>(fusedOperations));
     getGraph().removeRedundantDependencies();
 
     // Stencil dependencies with the beginNode are not detected by the data dependency analysis.
@@ -117,6 +119,94 @@ auto MultiXpuGraph::optimizations(const Neon::skeleton::Options& options) -> voi
     }
 }
 
+auto MultiXpuGraph::fuseContainers(const Neon::Backend&                     bk,
+                                   const std::vector<Neon::set::Container>& operations,
+                                   const Neon::skeleton::Options&           options)
+    -> std::vector<Neon::set::Container>
+{
+    if (options.fusion() == Neon::skeleton::Fusion::none ||
+        bk.runtime() != Neon::Runtime::openmp) {
+        return operations;
+    }
+    // Stencil Containers need halo updates in between them when there are multiple partitions
+    const bool fuseStencils = options.fusion() == Neon::skeleton::Fusion::wavefront &&
+                              bk.devSet().setCardinality() == 1;
+
+    // A map Container can be fused only if every token it recorded is a map access:
+    // each cell then reads and writes only its own data and tiles can be processed in any order.
+    // Stencil accesses are accepted only on structured tile spaces, where the wavefront
+    // can keep the cells read by a stencil at a bounded distance.
+    auto hasStencil = [](const Neon::set::Container& container) -> bool {
+        return container.getContainerInterface().getContainerPatternType() == Neon::set::ContainerPatternType::stencil;
+    };
+    auto isFusable = [fuseStencils, hasStencil](const Neon::set::Container& container) -> bool {
+        const auto& containerApi = container.getContainerInterface();
+        if (!containerApi.isTileable()) {
+            return false;
+        }
+        const bool acceptStencil = fuseStencils && containerApi.hasStructuredTileSpace();
+        if (hasStencil(container) && !acceptStencil) {
+            return false;
+        }
+        if (containerApi.getContainerPatternType() != Neon::set::ContainerPatternType::map &&
+            containerApi.getContainerPatternType() != Neon::set::ContainerPatternType::stencil) {
+            return false;
+        }
+        for (const auto& token : containerApi.getTokens()) {
+            const bool isMap = token.compute() == Neon::Pattern::MAP;
+            const bool isStencil = token.compute() == Neon::Pattern::STENCIL;
+            if (!isMap && !(isStencil && acceptStencil)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::vector<Neon::set::Container> fusedOperations;
+    std::vector<Neon::set::Container> group;
+    bool                              groupHasStencil = false;
+
+    auto closeGroup = [&]() {
+        if (group.size() == 1) {
+            fusedOperations.push_back(group.front());
+        }
+        if (group.size() > 1) {
+            std::string name = group.front().getName();
+            for (size_t i = 1; i < group.size(); i++) {
+                name += "+" + group[i].getName();
+            }
+            if (groupHasStencil) {
+                fusedOperations.push_back(Neon::set::Container::factoryWavefront(name,
+                                                                                 bk.devSet().setCardinality(),
+                                                                                 group));
+            } else {
+                fusedOperations.push_back(Neon::set::Container::factoryFusedMap(name,
+                                                                                bk.devSet().setCardinality(),
+                                                                                group));
+            }
+        }
+        group.clear();
+        groupHasStencil = false;
+    };
+
+    for (const auto& container : operations) {
+        if (!isFusable(container)) {
+            closeGroup();
+            fusedOperations.push_back(container);
+            continue;
+        }
+        if (!group.empty() &&
+            group.front().getContainerInterface().getTilingUid() != container.getContainerInterface().getTilingUid()) {
+            closeGroup();
+        }
+        group.push_back(container);
+        groupHasStencil = groupHasStencil || hasStencil(container);
+    }
+    closeGroup();
+
+    return fusedOperations;
+}
+
 auto MultiXpuGraph::optimizeStandardOCC(const Neon::skeleton::Options&) -> void
 {
     std::vector<Neon::set::container::GraphData::Uid> stencilNodeUidList;
@@ -387,6 +477,8 @@ auto MultiXpuGraph::
 {
     if (options.executor() == Neon::skeleton::Executor::ompAtNodeLevel) {
         this->getGraph().helpExecuteWithOmpAtNodeLevel(Neon::Backend::mainStreamIdx);
+    } else if (options.executor() == Neon::skeleton::Executor::ompTaskGraph) {
+        this->getGraph().helpExecuteWithOmpTasks(Neon::Backend::mainStreamIdx);
     } else {
         NEON_DEV_UNDER_CONSTRUCTION("");
     };
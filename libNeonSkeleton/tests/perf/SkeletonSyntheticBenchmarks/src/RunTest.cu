@@ -91,7 +91,9 @@ auto runGolden(Cli::UserData& userData,
 auto getSkeletonOption(Cli::UserData& userData)
     -> Neon::skeleton::Options
 {
-    Neon::skeleton::Options options(userData.occModel.getOption(), Neon::set::TransferMode::get);
+    Neon::skeleton::Options options(userData.occModel.getOption(),
+                                    Neon::set::TransferMode::get,
+                                    userData.executorModel.getOption());
     return options;
 }
 
@@ -1,4 +1,4 @@
-// -x 1 -y 1 -z 3 -deviceIds 0 -devType OMP -gridType eGrid -skeletonRuntime ompAtGraphLevel -occ standard -app map -type INT64 -iterations 1 -warmup 0 -prefix random
+// -x 1 -y 1 -z 3 -deviceIds 0 -devType OMP -gridType eGrid -skeletonRuntime ompAtNodeLevel -occ standard -app map -type INT64 -iterations 1 -warmup 0 -prefix random
 #include "Neon/Neon.h"
 #include "Neon/Report.h"
 
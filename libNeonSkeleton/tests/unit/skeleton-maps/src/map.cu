@@ -100,7 +100,8 @@ auto twoStageXPYPipe(Neon::domain::tool::testing::TestData<G, T, C>& data) -> vo
 }
 
 template <typename G, typename T, int C>
-auto threeLevelXPYTree(Neon::domain::tool::testing::TestData<G, T, C>& data) -> void
+auto threeLevelXPYTreeWithOptions(Neon::domain::tool::testing::TestData<G, T, C>& data,
+                                  Neon::skeleton::Options                         opt) -> void
 {
     data.resetValuesToLinear(1, 100);
     using namespace Neon::domain::tool::testing;
@@ -117,7 +118,6 @@ auto threeLevelXPYTree(Neon::domain::tool::testing::TestData<G, T, C>& data) ->
         auto& Z = data.getField(FieldNames::Z);
 
         Neon::skeleton::Skeleton          skl(bk);
-        Neon::skeleton::Options           opt;
         std::vector<Neon::set::Container> sVec;
 
         sVec.push_back(UserTools::xpy(X, X));
@@ -158,6 +158,21 @@ auto threeLevelXPYTree(Neon::domain::tool::testing::TestData<G, T, C>& data) ->
     ASSERT_TRUE(isOk);
 }
 
+template <typename G, typename T, int C>
+auto threeLevelXPYTree(Neon::domain::tool::testing::TestData<G, T, C>& data) -> void
+{
+    threeLevelXPYTreeWithOptions(data, Neon::skeleton::Options());
+}
+
+template <typename G, typename T, int C>
+auto threeLevelXPYTreeFused(Neon::domain::tool::testing::TestData<G, T, C>& data) -> void
+{
+    threeLevelXPYTreeWithOptions(data, Neon::skeleton::Options(Neon::skeleton::Occ::none,
+                                                               Neon::set::TransferMode::get,
+                                                               Neon::skeleton::Executor::ompAtNodeLevel,
+                                                               Neon::skeleton::Fusion::map));
+}
+
 
 TEST(OneStageXPYPipe, eGrid)
 {
@@ -250,4 +265,22 @@ TEST(threeLevelXPYTree, bGrid)
     using T = int64_t;
     // runAllTestConfiguration(AXPY_struct<eGrid_t, int64_t>, nGpus);
     runAllTestConfiguration(std::function(threeLevelXPYTree<Grid, T, C>), nGpus, 1);
+}
+
+TEST(threeLevelXPYTree, eGridFused)
+{
+    int           nGpus = 3;
+    constexpr int C = 0;
+    using Grid = Neon::eGrid;
+    using T = int64_t;
+    runAllTestConfiguration(std::function(threeLevelXPYTreeFused<Grid, T, C>), nGpus, 1);
+}
+
+TEST(threeLevelXPYTree, dGridFused)
+{
+    int           nGpus = 3;
+    constexpr int C = 0;
+    using Grid = Neon::dGrid;
+    using T = int64_t;
+    runAllTestConfiguration(std::function(threeLevelXPYTreeFused<Grid, T, C>), nGpus, 1);
 }
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <omp.h>
 #include "gtest/gtest.h"
 
 #include "Neon/Neon.h"
@@ -59,7 +60,7 @@ auto laplaceOnIntegers(const Field& filedA,
 
 
 template <typename G, typename T, int C>
-void singleStencil(TestData<G, T, C>& data)
+void singleStencilWithOptions(TestData<G, T, C>& data, const Neon::skeleton::Options& options)
 {
     using Type = typename TestData<G, T, C>::Type;
 
@@ -82,7 +83,7 @@ void singleStencil(TestData<G, T, C>& data)
         ops.push_back(laplaceOnIntegers(Y, X));
 
         Neon::skeleton::Skeleton skl(data.getBackend());
-        skl.sequence(ops, "sUt_dGridStencil");
+        skl.sequence(ops, "sUt_dGridStencil", options);
 
         for (int j = 0; j < nIterations; j++) {
             skl.run();
@@ -108,6 +109,32 @@ void singleStencil(TestData<G, T, C>& data)
     ASSERT_TRUE(isOk);
 }
 
+template <typename G, typename T, int C>
+void singleStencil(TestData<G, T, C>& data)
+{
+    singleStencilWithOptions(data, Neon::skeleton::Options());
+}
+
+template <typename G, typename T, int C>
+void singleStencilTaskGraph(TestData<G, T, C>& data)
+{
+    const int maxActiveLevels = omp_get_max_active_levels();
+    singleStencilWithOptions(data, Neon::skeleton::Options(Neon::skeleton::Occ::standard,
+                                                           Neon::set::TransferMode::get,
+                                                           Neon::skeleton::Executor::ompTaskGraph));
+    // The nested parallelism used by the task pool must not leak out of the graph execution
+    ASSERT_EQ(omp_get_max_active_levels(), maxActiveLevels);
+}
+
+template <typename G, typename T, int C>
+void singleStencilWavefront(TestData<G, T, C>& data)
+{
+    singleStencilWithOptions(data, Neon::skeleton::Options(Neon::skeleton::Occ::none,
+                                                           Neon::set::TransferMode::get,
+                                                           Neon::skeleton::Executor::ompAtNodeLevel,
+                                                           Neon::skeleton::Fusion::wavefront));
+}
+
 TEST(singleStencil, dGrid)
 {
     int nGpus = 1;
@@ -124,4 +151,22 @@ TEST(singleStencil, bGridSingleGpu)
     using Type = int32_t;
     constexpr int C = 0;
     runAllTestConfiguration<Grid, Type, 0>("bGrid", singleStencil<Grid, Type, C>, nGpus, 1);
-}
\ No newline at end of file
+}
+
+TEST(singleStencil, dGridTaskGraph)
+{
+    int nGpus = 2;
+    using Grid = Neon::dGrid;
+    using Type = int32_t;
+    constexpr int C = 0;
+    runAllTestConfiguration<Grid, Type, 0>("dGrid", singleStencilTaskGraph<Grid, Type, C>, nGpus, 1);
+}
+
+TEST(singleStencil, dGridWavefront)
+{
+    int nGpus = 2;
+    using Grid = Neon::dGrid;
+    using Type = int32_t;
+    constexpr int C = 0;
+    runAllTestConfiguration<Grid, Type, 0>("dGrid", singleStencilWavefront<Grid, Type, C>, nGpus, 1);
+}
@@ -31,6 +31,7 @@ struct SolverParams
     double                  toleranceDiv = 1e+5;             /// Relative tolerance for checking if residual is diverging
     bool                    needResiduals = false;           /// Whether to store each iteration's residual in SolverResultInfo
     bool                    numericalIssueIsFailure = true;  /// Whether to stop the solver in case of numerical issue (e.g. non-positive definiteness)
+    size_t                  checkEvery = 1;                  /// Number of iterations run back to back between two convergence checks
     Neon::skeleton::Options skeletonOptions;
 };
 
@@ -193,7 +194,7 @@ class IterativeLinearSolver_t
      */
     const Neon::Backend& h_getBackend(const Field& f) const
     {
-        return f.grid().backend();
+        return f.getBackend();
     }
 
     /**
@@ -204,7 +205,7 @@ class IterativeLinearSolver_t
      */
     auto h_getBackend(Field& f) const -> const Neon::Backend&
     {
-        return f.getGrid().getBackend();
+        return f.getBackend();
     }
 };
 
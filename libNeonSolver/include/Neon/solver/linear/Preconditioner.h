@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include "Neon/set/Containter.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * The Preconditioner class represents the application of an approximate inverse z = M^-1 r
+ * of the linear operator. Preconditioners used with PCG must be symmetric and positive-definite.
+ *
+ * @tparam Grid Type of the grid where this operation will be executed
+ * @tparam Real Real value type (double or float)
+ */
+template <typename Grid_, typename Real>
+class Preconditioner
+{
+   public:
+    using self_t = Preconditioner<Grid_, Real>;
+    using Grid = Grid_;
+    using Field = typename Grid::template Field<Real>;
+    using bdField = typename Grid::template Field<int8_t>;
+
+    /**
+     * Default constructor
+     */
+    Preconditioner() = default;
+
+    /**
+     * Virtual destructor to derived classes
+     */
+    virtual ~Preconditioner() = default;
+
+    /**
+     * One time initializations e.g., allocation of internal fields
+     * @param[in] x A field used as reference for the internal fields (cardinality, halo etc.)
+     */
+    virtual void init([[maybe_unused]] Field& x)
+    {
+    }
+
+    /**
+     * Initializations that depend on the boundary conditions. Called once at the beginning of each solve.
+     * @param[in] bd int8_t valued field marking Dirichlet boundary with 0 and 1 otherwise
+     */
+    virtual void setup([[maybe_unused]] const bdField& bd)
+    {
+    }
+
+    /**
+     * Sequence of containers computing z = M^-1 r
+     * @param[in] r Real valued input field
+     * @param[in] bd int8_t valued field marking Dirichlet boundary with 0 and 1 otherwise
+     * @param[inout] z Real valued field holding the output
+     */
+    virtual std::vector<Neon::set::Container> apply(const Field& r, const bdField& bd, Field& z) = 0;
+};
+
+}  // namespace solver
+}  // namespace Neon
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/GpuStreamSet.h"
+#include "Neon/solver/linear/IterativeLinearSolver.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * Biconjugate Gradient Stabilized solver for general (non-symmetric) problems of the form Ax = b.
+ *
+ * An iteration is a single skeleton with two matrix-vector products and three reduction phases:
+ * <rhat, v>, then <t, s> and <t, t> fused in one traversal, then <rhat, r> and <r, r> fused in one traversal
+ * (the fused traversals need the OpenMP runtime, the other runtimes run one dot container per product).
+ * The scalars alpha, omega and beta are computed by the update containers from the results of the reductions.
+ *
+ * Reference: H. A. van der Vorst, Bi-CGSTAB: A fast and smoothly converging variant of Bi-CG
+ * for the solution of nonsymmetric linear systems, SIAM J. Sci. Stat. Comput. 13 (1992)
+ *
+ * @tparam Grid_ta Grid datastructure
+ * @tparam Real_ta Real number type (typically double or float)
+ */
+template <typename Grid_ta, typename Real_ta>
+class BiCGStab_t : public IterativeLinearSolver_t<Grid_ta, Real_ta>
+{
+   public:
+    using self_t = BiCGStab_t<Grid_ta, Real_ta>;
+    using grid_t = Grid_ta;
+    using Field = typename grid_t::template Field<Real_ta>;
+    using BdField = typename grid_t::template Field<int8_t>;
+    using matVec_t = MatVec<Grid_ta, Real_ta>;
+
+   protected:
+    Field m_r, m_rhat, m_p, m_v, m_s, m_t; /**< Extra fields needed for the BiCGStab */
+
+   public:
+    BiCGStab_t()
+        : IterativeLinearSolver_t<Grid_ta, Real_ta>()
+    {
+    }
+
+    /**
+     * Return the name of the solver ("BiCGStab").
+     * @return Solver name
+     */
+    virtual std::string name() const override
+    {
+        return "BiCGStab";
+    }
+
+    /**
+     * Solve the linear system Ax = b with the BiCGStab method.
+     *
+     * The solver will return SolverStatus::NumericalIssue if the method breaks down i.e., <rhat, r> or <rhat, v>
+     * vanish or the stabilization step stagnates (omega = 0), and SolverParams::numericalIssueIsFailure flag is set to true.
+     *
+     * @param[in] A Matrix-vector multiply operation representing the linear operator
+     * @param[in,out] x Unknown to solve for
+     * @param[in] b RHS of the linear system
+     * @param[in] bd Dirichlet boundary conditions in the domain (1: on boundary, 0: interior)
+     * @param[in] params Parameters for the solve
+     * @param[in,out] result Resulting information from the solve
+     * @return Status of the solve
+     * \sa SolverParams, SolverResultInfo, SolverStatus
+     */
+    virtual SolverStatus
+    solve(NEON_IN std::shared_ptr<matVec_t> A /*!     Mat vec object                                                            */,
+          NEON_IO Field& x /*!                      Unknown to solve for                                                      */,
+          NEON_IN Field& b /*!                      b RHS of the linear system                                                */,
+          NEON_IN BdField&               bd /*!     Dirichlet boundary conditions in the domain (1: on boundary, 0: interior) */,
+          const SolverParams&            params /*! Parameters for the solve                                                  */,
+          SolverResultInfo&              result /*! Resulting information from the solve                                      */,
+          const Neon::skeleton::Options& opt = Neon::skeleton::Options(Neon::skeleton::Occ::standard, Neon::set::TransferMode::get)) override;
+
+    /*
+     * Reset the data structure used by the solver such that it can be
+     * reused again.
+     */
+    virtual void reset() override;
+
+   protected:
+    /**
+     * One time initializations for the BiCGStab solver
+     */
+    virtual void doInit(Field& x) override;
+
+    /**
+     * Compute the initial residual r_0 = b - Ax_0 and the shadow residual rhat = r_0
+     * @return The residual squared norm, which is also <rhat, r_0>
+     */
+    virtual Real_ta h_computeResidual(std::shared_ptr<matVec_t> A, Field& x, Field& b, BdField& bc);
+};
+
+extern template class BiCGStab_t<Neon::eGrid, double>;
+extern template class BiCGStab_t<Neon::eGrid, float>;
+extern template class BiCGStab_t<Neon::bGrid, double>;
+extern template class BiCGStab_t<Neon::bGrid, float>;
+extern template class BiCGStab_t<Neon::dGrid, double>;
+extern template class BiCGStab_t<Neon::dGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
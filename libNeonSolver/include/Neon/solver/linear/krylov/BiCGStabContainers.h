@@ -0,0 +1,82 @@
+#pragma once
+
+#include <vector>
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/set/DevSet.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * Two dot products ab := <a,b> and cd := <c,d>.
+ * On the OpenMP runtime they are computed in a single traversal of the grid,
+ * otherwise by one dot container each.
+ */
+template <typename Grid, typename Real>
+auto bicgstabDots(const std::string&                            name,
+                  typename Grid::template Field<Real, 0>&       a,
+                  typename Grid::template Field<Real, 0>&       b,
+                  typename Grid::template Field<Real, 0>&       c,
+                  typename Grid::template Field<Real, 0>&       d,
+                  Neon::template PatternScalar<Real>&           ab,
+                  Neon::template PatternScalar<Real>&           cd) -> std::vector<Neon::set::Container>;
+
+/**
+ * p := r + beta (p - omega v) with beta = (rho / rhoOld) (alpha / omega) = (rho / rv) (tt / ts)
+ * and omega = ts / tt, where rv, ts and tt are still the ones of the previous iteration.
+ * rv = 0 marks the first iteration, where p := r.
+ */
+template <typename Grid, typename Real>
+auto bicgstabUpdateP(typename Grid::template Field<Real, 0>&       p,
+                     const typename Grid::template Field<Real, 0>& r,
+                     const typename Grid::template Field<Real, 0>& v,
+                     const Neon::template PatternScalar<Real>&     rho,
+                     const Neon::template PatternScalar<Real>&     rv,
+                     const Neon::template PatternScalar<Real>&     ts,
+                     const Neon::template PatternScalar<Real>&     tt) -> Neon::set::Container;
+
+/**
+ * s := r - alpha v with alpha = rho / rv
+ */
+template <typename Grid, typename Real>
+auto bicgstabUpdateS(typename Grid::template Field<Real, 0>&       s,
+                     const typename Grid::template Field<Real, 0>& r,
+                     const typename Grid::template Field<Real, 0>& v,
+                     const Neon::template PatternScalar<Real>&     rho,
+                     const Neon::template PatternScalar<Real>&     rv) -> Neon::set::Container;
+
+/**
+ * x := x + alpha p + omega s, r := s - omega t with alpha = rho / rv and omega = ts / tt
+ */
+template <typename Grid, typename Real>
+auto bicgstabUpdateXandR(typename Grid::template Field<Real, 0>&       x,
+                         typename Grid::template Field<Real, 0>&       r,
+                         const typename Grid::template Field<Real, 0>& p,
+                         const typename Grid::template Field<Real, 0>& s,
+                         const typename Grid::template Field<Real, 0>& t,
+                         const Neon::template PatternScalar<Real>&     rho,
+                         const Neon::template PatternScalar<Real>&     rv,
+                         const Neon::template PatternScalar<Real>&     ts,
+                         const Neon::template PatternScalar<Real>&     tt) -> Neon::set::Container;
+
+
+#define BICGSTAB_EXTERN_TEMPLATE(GRID, DATA)                                                                                                                                                                                                                                                                                                                                                                                                  \
+    extern template auto bicgstabDots<GRID, DATA>(const std::string&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, Neon::template PatternScalar<DATA>&, Neon::template PatternScalar<DATA>&)->std::vector<Neon::set::Container>;                                                                                                    \
+    extern template auto bicgstabUpdateP<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;                                                                            \
+    extern template auto bicgstabUpdateS<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;                                                                                                                                                                  \
+    extern template auto bicgstabUpdateXandR<GRID, DATA>(GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;
+
+BICGSTAB_EXTERN_TEMPLATE(Neon::dGrid, double);
+BICGSTAB_EXTERN_TEMPLATE(Neon::bGrid, double);
+BICGSTAB_EXTERN_TEMPLATE(Neon::eGrid, double);
+BICGSTAB_EXTERN_TEMPLATE(Neon::dGrid, float);
+BICGSTAB_EXTERN_TEMPLATE(Neon::eGrid, float);
+BICGSTAB_EXTERN_TEMPLATE(Neon::bGrid, float);
+#undef BICGSTAB_EXTERN_TEMPLATE
+
+}  // namespace solver
+}  // namespace Neon
@@ -57,6 +57,10 @@ class CG_t : public IterativeLinearSolver_t<Grid_ta, Real_ta>
      * The solver will return SolverStatus::NumericalIssue if the matrix is not positive-definite and
      * SolverParams::numericalIssueIsFailure flag is set to true.
      *
+     * With SolverParams::checkEvery = k > 1, k iterations run back to back in one skeleton and
+     * their residuals are checked together afterwards. If one of them converged, the solver goes back
+     * to the beginning of the block and runs the iterations up to the converged one again.
+     *
      * @param[in] A Matrix-vector multiply operation representing the linear operator
      * @param[in,out] x Unknown to solve for
      * @param[in] b RHS of the linear system
@@ -95,10 +99,10 @@ class CG_t : public IterativeLinearSolver_t<Grid_ta, Real_ta>
     virtual Real_ta h_computeResidual(std::shared_ptr<matVec_t> A, Field& x, Field& b, BdField& bc);
 };
 
-extern template class CG_t<Neon::domain::eGrid, double>;
-extern template class CG_t<Neon::domain::eGrid, float>;
-extern template class CG_t<Neon::domain::bGrid, double>;
-extern template class CG_t<Neon::domain::bGrid, float>;
+extern template class CG_t<Neon::eGrid, double>;
+extern template class CG_t<Neon::eGrid, float>;
+extern template class CG_t<Neon::bGrid, double>;
+extern template class CG_t<Neon::bGrid, float>;
 extern template class CG_t<Neon::dGrid, double>;
 extern template class CG_t<Neon::dGrid, float>;
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Neon/domain/dGrid.h"
 #include "Neon/domain/eGrid.h"
 #include "Neon/domain/bGrid.h"
 #include "Neon/set/Containter.h"
@@ -31,35 +32,34 @@ auto updateXandR(typename Grid::template Field<Real, 0>&       x,
                  typename Grid::template Field<Real, 0>&       r,
                  const typename Grid::template Field<Real, 0>& p,
                  const typename Grid::template Field<Real, 0>& s,
-                 const Real&                                        delta_new,
-                 const Real&                                        pAp,
-                 Real&                                              delta_old) -> Neon::set::Container;
+                 const Neon::template PatternScalar<Real>&     delta_new,
+                 const Neon::template PatternScalar<Real>&     pAp) -> Neon::set::Container;
 
 template <typename Grid, typename Real>
 auto updateP(typename Grid::template Field<Real, 0>&       p,
              const typename Grid::template Field<Real, 0>& r,
-             const Real&                                        delta_new,
-             const Real&                                        delta_old) -> Neon::set::Container;
+             const Neon::template PatternScalar<Real>&     delta_new,
+             const Neon::template PatternScalar<Real>&     delta_old) -> Neon::set::Container;
 
 template <typename Grid, typename Real>
 auto printField(typename Grid::template Field<Real, 0>& p) -> Neon::set::Container;
 
 
 #define CG_EXTERN_TEMPLATE(GRID, DATA)                                                                                                                                                                                                                \
-    extern template auto updateXandR<GRID, DATA>(GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const DATA&, const DATA&, DATA&)->Neon::set::Container; \
+    extern template auto updateXandR<GRID, DATA>(GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container; \
     extern template auto set<GRID, DATA>(GRID::template Field<DATA, 0>&, const DATA)->Neon::set::Container;                                                                                                                                         \
     extern template auto copy<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&)->Neon::set::Container;                                                                                                            \
     extern template auto initR<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&)->Neon::set::Container;                         \
     extern template auto AXPY<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&)->Neon::set::Container;                                                                                                            \
-    extern template auto updateP<GRID, DATA>(typename GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const DATA&, const DATA&)->Neon::set::Container;                                                                      \
+    extern template auto updateP<GRID, DATA>(typename GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;                                                                      \
     extern template auto printField<GRID, DATA>(typename GRID::template Field<DATA, 0>&)->Neon::set::Container;
 
 CG_EXTERN_TEMPLATE(Neon::dGrid, double);
-CG_EXTERN_TEMPLATE(Neon::domain::bGrid, double);
-CG_EXTERN_TEMPLATE(Neon::domain::eGrid, double);
+CG_EXTERN_TEMPLATE(Neon::bGrid, double);
+CG_EXTERN_TEMPLATE(Neon::eGrid, double);
 CG_EXTERN_TEMPLATE(Neon::dGrid, float);
-CG_EXTERN_TEMPLATE(Neon::domain::eGrid, float);
-CG_EXTERN_TEMPLATE(Neon::domain::bGrid, float);
+CG_EXTERN_TEMPLATE(Neon::eGrid, float);
+CG_EXTERN_TEMPLATE(Neon::bGrid, float);
 #undef CG_EXTERN_TEMPLATE
 
 }  // namespace solver
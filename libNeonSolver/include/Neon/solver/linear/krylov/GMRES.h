@@ -0,0 +1,157 @@
+#pragma once
+
+#include <vector>
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/GpuStreamSet.h"
+#include "Neon/solver/linear/IterativeLinearSolver.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * Restarted Generalized Minimal Residual solver, GMRES(m), for general (non-symmetric) problems of the form Ax = b.
+ *
+ * Each Arnoldi step is a single skeleton: the matrix-vector product, the dot products of the new vector
+ * against the whole basis (classical Gram-Schmidt, fused by groups of fusedWidth in one traversal),
+ * the orthogonalization, the norm of the orthogonalized vector and the normalization.
+ * The dot products against the basis are independent, so a step has two reduction phases.
+ * The coefficients of the orthogonalization and of the normalization are read by the compute lambdas.
+ * The Hessenberg matrix, its Givens rotations and the residual estimate are handled on the host.
+ * The solution is updated at the end of each restart cycle.
+ *
+ * Classical Gram-Schmidt loses orthogonality faster than the modified variant; keep the restart length moderate.
+ * Memory grows with the restart length: m + 1 basis vectors plus three work fields.
+ *
+ * Reference: Y. Saad and M. H. Schultz, GMRES: A generalized minimal residual algorithm for solving
+ * nonsymmetric linear systems, SIAM J. Sci. Stat. Comput. 7 (1986)
+ *
+ * @tparam Grid_ta Grid datastructure
+ * @tparam Real_ta Real number type (typically double or float)
+ */
+template <typename Grid_ta, typename Real_ta>
+class GMRES_t : public IterativeLinearSolver_t<Grid_ta, Real_ta>
+{
+   public:
+    using self_t = GMRES_t<Grid_ta, Real_ta>;
+    using grid_t = Grid_ta;
+    using Field = typename grid_t::template Field<Real_ta>;
+    using BdField = typename grid_t::template Field<int8_t>;
+    using matVec_t = MatVec<Grid_ta, Real_ta>;
+
+    /**
+     * Number of dot products (or basis vectors in an update) fused in a single traversal of the grid
+     */
+    static constexpr int fusedWidth = 4;
+
+   protected:
+    int                                                    m_restart;     /**< Restart length m */
+    Field                                                  m_r, m_s, m_w; /**< Residual, matvec output and Arnoldi work vector */
+    std::vector<Field>                                     m_v;           /**< Krylov basis (m + 1 vectors) */
+    std::vector<std::vector<Neon::PatternScalar<Real_ta>>> m_h;           /**< Per Arnoldi step j: <w, v_0>, ..., <w, v_j> */
+    std::vector<Neon::PatternScalar<Real_ta>>              m_ww;          /**< Per Arnoldi step j: <w, w> of the orthogonalized vector */
+    Neon::PatternScalar<Real_ta>                           m_rr;          /**< <r, r> of the restart residual */
+    std::vector<Neon::PatternScalar<Real_ta>>              m_y;           /**< Coefficients of the update x += V y */
+    std::vector<Real_ta>                                   m_hNorm;       /**< Subdiagonal of the Hessenberg matrix */
+    Real_ta                                                m_beta = 0;    /**< Norm of the restart residual */
+
+   public:
+    /**
+     * Constructor for the restarted GMRES solver
+     * @param[in] restart Restart length m i.e., the dimension of the Krylov space built before the solution is updated
+     */
+    explicit GMRES_t(int restart = 30)
+        : IterativeLinearSolver_t<Grid_ta, Real_ta>(), m_restart(restart)
+    {
+        if (m_restart < 1) {
+            NeonException exc("GMRES_t");
+            exc << "The restart length must be positive, got " << m_restart;
+            NEON_THROW(exc);
+        }
+    }
+
+    /**
+     * Return the name of the solver ("GMRES").
+     * @return Solver name
+     */
+    virtual std::string name() const override
+    {
+        return "GMRES";
+    }
+
+    /**
+     * Return the restart length
+     * @return Restart length m
+     */
+    int restart() const
+    {
+        return m_restart;
+    }
+
+    /**
+     * Solve the linear system Ax = b with the restarted GMRES method.
+     *
+     * The residual checked for convergence is the estimate given by the Givens rotations of the Hessenberg matrix.
+     * Each Arnoldi step counts as one iteration.
+     * The solver will return SolverStatus::NumericalIssue if the Hessenberg matrix becomes singular and
+     * SolverParams::numericalIssueIsFailure flag is set to true.
+     *
+     * @param[in] A Matrix-vector multiply operation representing the linear operator
+     * @param[in,out] x Unknown to solve for
+     * @param[in] b RHS of the linear system
+     * @param[in] bd Dirichlet boundary conditions in the domain (1: on boundary, 0: interior)
+     * @param[in] params Parameters for the solve
+     * @param[in,out] result Resulting information from the solve
+     * @return Status of the solve
+     * \sa SolverParams, SolverResultInfo, SolverStatus
+     */
+    virtual SolverStatus
+    solve(NEON_IN std::shared_ptr<matVec_t> A /*!     Mat vec object                                                            */,
+          NEON_IO Field& x /*!                      Unknown to solve for                                                      */,
+          NEON_IN Field& b /*!                      b RHS of the linear system                                                */,
+          NEON_IN BdField&               bd /*!     Dirichlet boundary conditions in the domain (1: on boundary, 0: interior) */,
+          const SolverParams&            params /*! Parameters for the solve                                                  */,
+          SolverResultInfo&              result /*! Resulting information from the solve                                      */,
+          const Neon::skeleton::Options& opt = Neon::skeleton::Options(Neon::skeleton::Occ::standard, Neon::set::TransferMode::get)) override;
+
+    /*
+     * Reset the data structure used by the solver such that it can be
+     * reused again.
+     */
+    virtual void reset() override;
+
+   protected:
+    /**
+     * One time initializations for the GMRES solver
+     */
+    virtual void doInit(Field& x) override;
+
+    /**
+     * Containers computing out[k] := <w, v[k]>, fusedWidth dot products per traversal on the OpenMP runtime
+     * and one dot container per product on the other runtimes
+     */
+    auto h_dots(const std::string&                                name,
+                Field&                                            w,
+                const std::vector<Field*>&                        v,
+                const std::vector<Neon::PatternScalar<Real_ta>*>& out) -> std::vector<Neon::set::Container>;
+
+    /**
+     * Containers computing out := out + sign * sum_k c[k] v[k], fusedWidth vectors per traversal
+     */
+    auto h_accumulate(Field&                                                  out,
+                      const std::vector<const Field*>&                        v,
+                      const std::vector<const Neon::PatternScalar<Real_ta>*>& c,
+                      Real_ta                                                 sign) -> std::vector<Neon::set::Container>;
+};
+
+extern template class GMRES_t<Neon::eGrid, double>;
+extern template class GMRES_t<Neon::eGrid, float>;
+extern template class GMRES_t<Neon::bGrid, double>;
+extern template class GMRES_t<Neon::bGrid, float>;
+extern template class GMRES_t<Neon::dGrid, double>;
+extern template class GMRES_t<Neon::dGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
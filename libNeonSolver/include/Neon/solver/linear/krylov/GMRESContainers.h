@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/set/DevSet.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * N dot products against the same field computed in a single traversal of the grid: out[k] := <w, v[k]>
+ * The traversal is a sum container, which runs on the device for the OpenMP runtime only.
+ */
+template <typename Grid, typename Real, int N>
+auto gmresDots(const std::string&                                                  name,
+               const typename Grid::template Field<Real, 0>&                       w,
+               const std::array<const typename Grid::template Field<Real, 0>*, N>& v,
+               const std::array<Neon::template PatternScalar<Real>*, N>&           out) -> Neon::set::Container;
+
+/**
+ * out := out + sign * sum_k c[k] v[k]
+ * The coefficients are read by the compute lambda, i.e. when the container runs.
+ */
+template <typename Grid, typename Real, int N>
+auto gmresAccumulate(typename Grid::template Field<Real, 0>&                             out,
+                     const std::array<const typename Grid::template Field<Real, 0>*, N>& v,
+                     const std::array<const Neon::template PatternScalar<Real>*, N>&     c,
+                     Real                                                                sign) -> Neon::set::Container;
+
+/**
+ * out := in / sqrt(nn), where nn = <in, in>.
+ * A zero norm (breakdown) sets out to zero.
+ */
+template <typename Grid, typename Real>
+auto gmresNormalize(typename Grid::template Field<Real, 0>&       out,
+                    const typename Grid::template Field<Real, 0>& in,
+                    const Neon::template PatternScalar<Real>&     nn) -> Neon::set::Container;
+
+
+#define GMRES_EXTERN_TEMPLATE_N(GRID, DATA, N)                                                                                                                                                                         \
+    extern template auto gmresDots<GRID, DATA, N>(const std::string&, const GRID::template Field<DATA, 0>&, const std::array<const GRID::template Field<DATA, 0>*, N>&, const std::array<Neon::template PatternScalar<DATA>*, N>&)->Neon::set::Container; \
+    extern template auto gmresAccumulate<GRID, DATA, N>(GRID::template Field<DATA, 0>&, const std::array<const GRID::template Field<DATA, 0>*, N>&, const std::array<const Neon::template PatternScalar<DATA>*, N>&, DATA)->Neon::set::Container;
+
+#define GMRES_EXTERN_TEMPLATE(GRID, DATA)    \
+    GMRES_EXTERN_TEMPLATE_N(GRID, DATA, 1)   \
+    GMRES_EXTERN_TEMPLATE_N(GRID, DATA, 2)   \
+    GMRES_EXTERN_TEMPLATE_N(GRID, DATA, 3)   \
+    GMRES_EXTERN_TEMPLATE_N(GRID, DATA, 4)   \
+    extern template auto gmresNormalize<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;
+
+GMRES_EXTERN_TEMPLATE(Neon::dGrid, double);
+GMRES_EXTERN_TEMPLATE(Neon::bGrid, double);
+GMRES_EXTERN_TEMPLATE(Neon::eGrid, double);
+GMRES_EXTERN_TEMPLATE(Neon::dGrid, float);
+GMRES_EXTERN_TEMPLATE(Neon::eGrid, float);
+GMRES_EXTERN_TEMPLATE(Neon::bGrid, float);
+#undef GMRES_EXTERN_TEMPLATE
+#undef GMRES_EXTERN_TEMPLATE_N
+
+}  // namespace solver
+}  // namespace Neon
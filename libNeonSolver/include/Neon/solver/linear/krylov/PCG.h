@@ -0,0 +1,108 @@
+#pragma once
+
+#include <memory>
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/GpuStreamSet.h"
+#include "Neon/solver/linear/IterativeLinearSolver.h"
+#include "Neon/solver/linear/Preconditioner.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * Preconditioned Conjugate Gradient solver for symmetric, positive-definite problems of the form Ax = b.
+ * The preconditioner must be symmetric and positive-definite as well e.g., GeometricMultigrid.
+ * Reference: https://en.wikipedia.org/wiki/Conjugate_gradient_method#The_preconditioned_conjugate_gradient_method
+ * @tparam Grid_ta Grid datastructure
+ * @tparam Real_ta Real number type (typically double or float)
+ */
+template <typename Grid_ta, typename Real_ta>
+class PCG_t : public IterativeLinearSolver_t<Grid_ta, Real_ta>
+{
+   public:
+    using self_t = PCG_t<Grid_ta, Real_ta>;
+    using grid_t = Grid_ta;
+    using Field = typename grid_t::template Field<Real_ta>;
+    using BdField = typename grid_t::template Field<int8_t>;
+    using matVec_t = MatVec<Grid_ta, Real_ta>;
+    using preconditioner_t = Preconditioner<Grid_ta, Real_ta>;
+
+   protected:
+    std::shared_ptr<preconditioner_t> m_preconditioner;
+    Field                             m_p, m_s, m_r, m_z; /**< Extra fields needed for the PCG */
+
+   public:
+    /**
+     * Constructor for the preconditioned conjugate gradient solver
+     * @param[in] preconditioner Preconditioner M, applied as z = M^-1 r at each iteration
+     */
+    explicit PCG_t(std::shared_ptr<preconditioner_t> preconditioner)
+        : IterativeLinearSolver_t<Grid_ta, Real_ta>(), m_preconditioner(std::move(preconditioner))
+    {
+    }
+
+    /**
+     * Return the name of the solver ("PCG").
+     * @return Solver name
+     */
+    virtual std::string name() const override
+    {
+        return "PCG";
+    }
+
+    /**
+     * Solve the linear system Ax = b with the preconditioned Conjugate Gradient method.
+     *
+     * The solver will return SolverStatus::NumericalIssue if the matrix is not positive-definite and
+     * SolverParams::numericalIssueIsFailure flag is set to true.
+     *
+     * @param[in] A Matrix-vector multiply operation representing the linear operator
+     * @param[in,out] x Unknown to solve for
+     * @param[in] b RHS of the linear system
+     * @param[in] bd Dirichlet boundary conditions in the domain (1: on boundary, 0: interior)
+     * @param[in] params Parameters for the solve
+     * @param[in,out] result Resulting information from the solve
+     * @return Status of the solve
+     * \sa SolverParams, SolverResultInfo, SolverStatus
+     */
+    virtual SolverStatus
+    solve(NEON_IN std::shared_ptr<matVec_t> A /*!     Mat vec object                                                            */,
+          NEON_IO Field& x /*!                      Unknown to solve for                                                      */,
+          NEON_IN Field& b /*!                      b RHS of the linear system                                                */,
+          NEON_IN BdField&               bd /*!     Dirichlet boundary conditions in the domain (1: on boundary, 0: interior) */,
+          const SolverParams&            params /*! Parameters for the solve                                                  */,
+          SolverResultInfo&              result /*! Resulting information from the solve                                      */,
+          const Neon::skeleton::Options& opt = Neon::skeleton::Options(Neon::skeleton::Occ::standard, Neon::set::TransferMode::get)) override;
+
+    /*
+     * Reset the data structure used by the solver such that it can be
+     * reused again.
+     */
+    virtual void reset() override;
+
+   protected:
+    /**
+     * One time initializations for the PCG solver and its preconditioner
+     */
+    virtual void doInit(Field& x) override;
+
+    /**
+     * Compute the residual r_0 = b - Ax_0, z_0 = M^-1 r_0 and p_0 = z_0
+     * @param[out] rz The product <r_0, z_0>
+     * @return The residual squared norm
+     */
+    virtual Real_ta h_computeResidual(std::shared_ptr<matVec_t> A, Field& x, Field& b, BdField& bc, Real_ta& rz);
+};
+
+extern template class PCG_t<Neon::eGrid, double>;
+extern template class PCG_t<Neon::eGrid, float>;
+extern template class PCG_t<Neon::bGrid, double>;
+extern template class PCG_t<Neon::bGrid, float>;
+extern template class PCG_t<Neon::dGrid, double>;
+extern template class PCG_t<Neon::dGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
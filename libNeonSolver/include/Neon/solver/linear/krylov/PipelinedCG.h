@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/GpuStreamSet.h"
+#include "Neon/solver/linear/IterativeLinearSolver.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * Pipelined Conjugate Gradient solver for symmetric, positive-definite problems of the form Ax = b.
+ *
+ * The recurrences of CG are rewritten so that the two dot products of an iteration, (r, r) and (w, r),
+ * do not depend on the matrix-vector product of the same iteration, q = Aw.
+ * An iteration is a single skeleton where the reductions can run concurrently with the matvec,
+ * followed by a fused update of all the vectors.
+ * The price is three extra vectors and a small loss of attainable accuracy with respect to CG.
+ *
+ * The residual checked for convergence is the one the iteration started from,
+ * so the solver may do one more iteration than CG.
+ *
+ * Reference: P. Ghysels and W. Vanroose, Hiding global synchronization latency in the
+ * preconditioned Conjugate Gradient algorithm, Parallel Computing 40 (2014)
+ *
+ * @tparam Grid_ta Grid datastructure
+ * @tparam Real_ta Real number type (typically double or float)
+ */
+template <typename Grid_ta, typename Real_ta>
+class PipelinedCG_t : public IterativeLinearSolver_t<Grid_ta, Real_ta>
+{
+   public:
+    using self_t = PipelinedCG_t<Grid_ta, Real_ta>;
+    using grid_t = Grid_ta;
+    using Field = typename grid_t::template Field<Real_ta>;
+    using BdField = typename grid_t::template Field<int8_t>;
+    using matVec_t = MatVec<Grid_ta, Real_ta>;
+
+   protected:
+    Field m_r, m_w, m_q, m_z, m_s, m_p; /**< Extra fields needed for the pipelined CG */
+
+   public:
+    PipelinedCG_t()
+        : IterativeLinearSolver_t<Grid_ta, Real_ta>()
+    {
+    }
+
+    /**
+     * Return the name of the solver ("PipelinedCG").
+     * @return Solver name
+     */
+    virtual std::string name() const override
+    {
+        return "PipelinedCG";
+    }
+
+    /**
+     * Solve the linear system Ax = b with the pipelined Conjugate Gradient method.
+     *
+     * The solver will return SolverStatus::NumericalIssue if the matrix is not positive-definite and
+     * SolverParams::numericalIssueIsFailure flag is set to true.
+     *
+     * @param[in] A Matrix-vector multiply operation representing the linear operator
+     * @param[in,out] x Unknown to solve for
+     * @param[in] b RHS of the linear system
+     * @param[in] bd Dirichlet boundary conditions in the domain (1: on boundary, 0: interior)
+     * @param[in] params Parameters for the solve
+     * @param[in,out] result Resulting information from the solve
+     * @return Status of the solve
+     * \sa SolverParams, SolverResultInfo, SolverStatus
+     */
+    virtual SolverStatus
+    solve(NEON_IN std::shared_ptr<matVec_t> A /*!     Mat vec object                                                            */,
+          NEON_IO Field& x /*!                      Unknown to solve for                                                      */,
+          NEON_IN Field& b /*!                      b RHS of the linear system                                                */,
+          NEON_IN BdField&               bd /*!     Dirichlet boundary conditions in the domain (1: on boundary, 0: interior) */,
+          const SolverParams&            params /*! Parameters for the solve                                                  */,
+          SolverResultInfo&              result /*! Resulting information from the solve                                      */,
+          const Neon::skeleton::Options& opt = Neon::skeleton::Options(Neon::skeleton::Occ::standard, Neon::set::TransferMode::get)) override;
+
+    /*
+     * Reset the data structure used by the solver such that it can be
+     * reused again.
+     */
+    virtual void reset() override;
+
+   protected:
+    /**
+     * One time initializations for the pipelined CG solver
+     */
+    virtual void doInit(Field& x) override;
+
+    /**
+     * Compute the initial residual r_0 = b - Ax_0 and w_0 = Ar_0
+     * @return The residual squared norm
+     */
+    virtual Real_ta h_computeResidual(std::shared_ptr<matVec_t> A, Field& x, Field& b, BdField& bc);
+};
+
+extern template class PipelinedCG_t<Neon::eGrid, double>;
+extern template class PipelinedCG_t<Neon::eGrid, float>;
+extern template class PipelinedCG_t<Neon::bGrid, double>;
+extern template class PipelinedCG_t<Neon::bGrid, float>;
+extern template class PipelinedCG_t<Neon::dGrid, double>;
+extern template class PipelinedCG_t<Neon::dGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/set/DevSet.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * Step lengths of an iteration of the pipelined CG from gamma = (r, r), delta = (w, r),
+ * and gammaOld and alphaOld of the previous iteration (gammaOld = 0 on the first iteration):
+ * beta := gamma / gammaOld, alpha := gamma / (delta - beta * gamma / alphaOld).
+ * On the first iteration beta = 0 and alpha := gamma / delta.
+ */
+template <typename Real>
+NEON_CUDA_HOST_DEVICE inline auto pipelinedCGSteps(Real gamma, Real delta, Real gammaOld, Real alphaOld, Real& alpha, Real& beta) -> void
+{
+    if (gammaOld != Real(0)) {
+        beta = gamma / gammaOld;
+        alpha = gamma / (delta - beta * gamma / alphaOld);
+    } else {
+        beta = 0;
+        alpha = gamma / delta;
+    }
+}
+
+/**
+ * Fused update of the pipelined CG vectors:
+ * z := q + beta z, s := w + beta s, p := r + beta p,
+ * x := x + alpha p, r := r - alpha s, w := w - alpha z
+ *
+ * alpha and beta are computed by pipelinedCGSteps() in the compute lambda,
+ * from the scalars the dot products have just written and from the ones the solver sets in between iterations.
+ */
+template <typename Grid, typename Real>
+auto updatePipelinedCG(typename Grid::template Field<Real, 0>&       x,
+                       typename Grid::template Field<Real, 0>&       r,
+                       typename Grid::template Field<Real, 0>&       w,
+                       typename Grid::template Field<Real, 0>&       z,
+                       typename Grid::template Field<Real, 0>&       s,
+                       typename Grid::template Field<Real, 0>&       p,
+                       const typename Grid::template Field<Real, 0>& q,
+                       const Neon::template PatternScalar<Real>&     gamma,
+                       const Neon::template PatternScalar<Real>&     delta,
+                       const Neon::template PatternScalar<Real>&     gammaOld,
+                       const Neon::template PatternScalar<Real>&     alphaOld) -> Neon::set::Container;
+
+
+#define PIPELINED_CG_EXTERN_TEMPLATE(GRID, DATA)                                                                                                                                                                                                                                                   \
+    extern template auto updatePipelinedCG<GRID, DATA>(GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;
+
+PIPELINED_CG_EXTERN_TEMPLATE(Neon::dGrid, double);
+PIPELINED_CG_EXTERN_TEMPLATE(Neon::bGrid, double);
+PIPELINED_CG_EXTERN_TEMPLATE(Neon::eGrid, double);
+PIPELINED_CG_EXTERN_TEMPLATE(Neon::dGrid, float);
+PIPELINED_CG_EXTERN_TEMPLATE(Neon::eGrid, float);
+PIPELINED_CG_EXTERN_TEMPLATE(Neon::bGrid, float);
+#undef PIPELINED_CG_EXTERN_TEMPLATE
+
+}  // namespace solver
+}  // namespace Neon
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/domain/bGrid.h"
+#include "Neon/solver/linear/MatVec.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * AdvectionDiffusionMatVec represents the finite-difference operator -nu * Laplacian(u) + a . grad(u)
+ * with a constant velocity a. The advection term uses first-order upwind differences, so the operator is
+ * non-symmetric as soon as a != 0, which makes it a test case for BiCGStab and GMRES.
+ * Missing neighbors on the domain border are dropped, as in LaplacianMatVec.
+ * @tparam Grid Type of the grid where this operation will be executed
+ * @tparam Real Real value type (double or float)
+ */
+template <typename Grid_, typename Real>
+class AdvectionDiffusionMatVec : public MatVec<Grid_, Real>
+{
+    Real                m_h;        /**< Step size h in finite-difference stencil */
+    Real                m_nu;       /**< Diffusion coefficient */
+    std::array<Real, 3> m_velocity; /**< Advection velocity */
+
+   public:
+    using self_t = AdvectionDiffusionMatVec<Grid_, Real>;
+    using Grid = Grid_;
+    using Field = typename Grid::template Field<Real>;
+    using bdField = typename Grid::template Field<int8_t>;
+
+    AdvectionDiffusionMatVec(Real h, Real nu, std::array<Real, 3> velocity)
+        : MatVec<Grid, Real>(), m_h(h), m_nu(nu), m_velocity(velocity)
+    {
+    }
+
+    /**
+     * Get the finite-difference step-size
+     * @return Step size h
+     */
+    Real stepSize() const
+    {
+        return m_h;
+    }
+
+    /**
+     * Get the advection velocity
+     * @return Velocity a
+     */
+    std::array<Real, 3> velocity() const
+    {
+        return m_velocity;
+    }
+
+    /**
+     * Applies the advection-diffusion operator
+     * @param[in] input Real valued input field x
+     * @param[in] bd int8_t valued field marking Dirichlet boundary with 0 and 1 otherwise
+     * @param[inout] output Real valued field holding the output A * x
+     */
+    virtual Neon::set::Container matVec(const Field& input, const bdField& bd, Field& output) override;
+};
+
+// Extern template instantiations
+extern template class AdvectionDiffusionMatVec<Neon::eGrid, double>;
+extern template class AdvectionDiffusionMatVec<Neon::eGrid, float>;
+extern template class AdvectionDiffusionMatVec<Neon::dGrid, double>;
+extern template class AdvectionDiffusionMatVec<Neon::dGrid, float>;
+extern template class AdvectionDiffusionMatVec<Neon::bGrid, double>;
+extern template class AdvectionDiffusionMatVec<Neon::bGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
@@ -63,8 +63,8 @@ extern template class LaplacianMatVec<Neon::domain::details::eGrid::eGrid, doubl
 extern template class LaplacianMatVec<Neon::domain::details::eGrid::eGrid, float>;
 extern template class LaplacianMatVec<Neon::dGrid, double>;
 extern template class LaplacianMatVec<Neon::dGrid, float>;
-extern template class LaplacianMatVec<Neon::domain::bGrid, double>;
-extern template class LaplacianMatVec<Neon::domain::bGrid, float>;
+extern template class LaplacianMatVec<Neon::bGrid, double>;
+extern template class LaplacianMatVec<Neon::bGrid, float>;
 
 }  //namespace solver
 }  // namespace Neon
\ No newline at end of file
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <array>
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/domain/interface/Stencil.h"
+#include "Neon/solver/linear/MatVec.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * One point of a constant-coefficient stencil: offset from the center and integer weight
+ */
+struct StencilPoint
+{
+    int8_t x, y, z;
+    int8_t weight;
+};
+
+/**
+ * Second order 7-point discretization of -Laplacian:
+ * (6 u - sum_faces u) / h^2
+ * The points are stored in the order of Stencil::s7_Laplace_t() (-z, +z, -y, +y, -x, +x).
+ */
+struct Laplacian7Stencil
+{
+    static constexpr const char* name = "Laplacian7";
+    static constexpr int         radius = 1;
+    static constexpr int         denominator = 1;
+    static constexpr int         numPoints = 6;
+
+    static constexpr std::array<StencilPoint, numPoints> points{{{0, 0, -1, 1}, {0, 0, 1, 1},
+                                                                  {0, -1, 0, 1}, {0, 1, 0, 1},
+                                                                  {-1, 0, 0, 1}, {1, 0, 0, 1}}};
+};
+
+/**
+ * Second order 19-point discretization of -Laplacian (faces and edges):
+ * (24 u - 2 sum_faces u - sum_edges u) / (6 h^2)
+ */
+struct Laplacian19Stencil
+{
+    static constexpr const char* name = "Laplacian19";
+    static constexpr int         radius = 1;
+    static constexpr int         denominator = 6;
+    static constexpr int         numPoints = 18;
+
+    static constexpr std::array<StencilPoint, numPoints> points{{{0, 0, -1, 2}, {0, 0, 1, 2},
+                                                                  {0, -1, 0, 2}, {0, 1, 0, 2},
+                                                                  {-1, 0, 0, 2}, {1, 0, 0, 2},
+                                                                  {-1, -1, 0, 1}, {1, -1, 0, 1}, {-1, 1, 0, 1}, {1, 1, 0, 1},
+                                                                  {-1, 0, -1, 1}, {1, 0, -1, 1}, {-1, 0, 1, 1}, {1, 0, 1, 1},
+                                                                  {0, -1, -1, 1}, {0, 1, -1, 1}, {0, -1, 1, 1}, {0, 1, 1, 1}}};
+};
+
+/**
+ * Second order 27-point discretization of -Laplacian (faces, edges and corners):
+ * (128 u - 14 sum_faces u - 3 sum_edges u - sum_corners u) / (30 h^2)
+ */
+struct Laplacian27Stencil
+{
+    static constexpr const char* name = "Laplacian27";
+    static constexpr int         radius = 1;
+    static constexpr int         denominator = 30;
+    static constexpr int         numPoints = 26;
+
+    static constexpr std::array<StencilPoint, numPoints> points{{{0, 0, -1, 14}, {0, 0, 1, 14},
+                                                                  {0, -1, 0, 14}, {0, 1, 0, 14},
+                                                                  {-1, 0, 0, 14}, {1, 0, 0, 14},
+                                                                  {-1, -1, 0, 3}, {1, -1, 0, 3}, {-1, 1, 0, 3}, {1, 1, 0, 3},
+                                                                  {-1, 0, -1, 3}, {1, 0, -1, 3}, {-1, 0, 1, 3}, {1, 0, 1, 3},
+                                                                  {0, -1, -1, 3}, {0, 1, -1, 3}, {0, -1, 1, 3}, {0, 1, 1, 3},
+                                                                  {-1, -1, -1, 1}, {1, -1, -1, 1}, {-1, 1, -1, 1}, {1, 1, -1, 1},
+                                                                  {-1, -1, 1, 1}, {1, -1, 1, 1}, {-1, 1, 1, 1}, {1, 1, 1, 1}}};
+};
+
+struct StencilMatVecUtils
+{
+    /**
+     * Grid stencil matching a compile-time stencil, point by point.
+     * eGrid only reaches the neighbors of its grid stencil,
+     * so an eGrid used with StencilMatVec<..., S> must be created with stencil<S>().
+     */
+    template <typename StencilT>
+    static auto stencil() -> Neon::domain::Stencil
+    {
+        std::vector<Neon::index_3d> points;
+        points.reserve(StencilT::numPoints);
+        for (const auto& p : StencilT::points) {
+            points.push_back({p.x, p.y, p.z});
+        }
+        return Neon::domain::Stencil(points);
+    }
+};
+
+/**
+ * Matrix-free operator whose stencil offsets and weights are known at compile time.
+ *
+ * out := sum_k w_k (u - u_k) / (denominator h^2) on the cells that are not Dirichlet (bd != 0),
+ * out := u on Dirichlet cells. As in LaplacianMatVec, neighbors outside the domain are dropped.
+ *
+ * The sum over the stencil points is unrolled at compile time. On dGrid, cells at distance at least
+ * StencilT::radius from the domain border read their neighbors directly without any validity check;
+ * the remaining cells and the other grids go through the checked getNghData path.
+ *
+ * @tparam Grid Type of the grid where this operation will be executed
+ * @tparam Real Real value type (double or float)
+ * @tparam StencilT Laplacian7Stencil, Laplacian19Stencil or Laplacian27Stencil
+ */
+template <typename Grid_, typename Real, typename StencilT>
+class StencilMatVec : public MatVec<Grid_, Real>
+{
+    // Step size h in finite-difference stencil
+    Real m_h;
+
+   public:
+    using self_t = StencilMatVec<Grid_, Real, StencilT>;
+    using Grid = Grid_;
+    using Field = typename Grid::template Field<Real>;
+    using bdField = typename Grid::template Field<int8_t>;
+    using stencil_t = StencilT;
+
+    StencilMatVec(Real h)
+        : MatVec<Grid, Real>(), m_h(h)
+    {
+    }
+
+    /**
+     * Get the finite-difference step-size
+     * @return Step size h
+     */
+    Real stepSize() const
+    {
+        return m_h;
+    }
+
+    /**
+     * Applies the stencil operator
+     * @param[in] input Real valued input field x
+     * @param[in] bd int8_t valued field marking Dirichlet boundary with 0 and 1 otherwise
+     * @param[inout] output Real valued field holding the output A * x
+     */
+    virtual Neon::set::Container matVec(const Field& input, const bdField& bd, Field& output) override;
+};
+
+/**
+ * 7-point discretization of -div(k grad u) with a cell-centered coefficient field k.
+ * The coefficient of a face is the arithmetic mean of k on both sides:
+ * out := sum_faces (k + k_n) / 2 (u - u_n) / h^2
+ * The offsets are the compile-time ones of Laplacian7Stencil, with the same interior fast path on dGrid.
+ * @tparam Grid Type of the grid where this operation will be executed
+ * @tparam Real Real value type (double or float)
+ */
+template <typename Grid_, typename Real>
+class VariableCoefficientMatVec : public MatVec<Grid_, Real>
+{
+   public:
+    using self_t = VariableCoefficientMatVec<Grid_, Real>;
+    using Grid = Grid_;
+    using Field = typename Grid::template Field<Real>;
+    using bdField = typename Grid::template Field<int8_t>;
+
+   private:
+    Real  m_h;     /**< Step size h in finite-difference stencil */
+    Field m_kappa; /**< Coefficient field k, cardinality 1 */
+
+   public:
+    VariableCoefficientMatVec(Real h, const Field& kappa)
+        : MatVec<Grid, Real>(), m_h(h), m_kappa(kappa)
+    {
+    }
+
+    /**
+     * Get the finite-difference step-size
+     * @return Step size h
+     */
+    Real stepSize() const
+    {
+        return m_h;
+    }
+
+    /**
+     * Applies the variable-coefficient operator
+     * @param[in] input Real valued input field x
+     * @param[in] bd int8_t valued field marking Dirichlet boundary with 0 and 1 otherwise
+     * @param[inout] output Real valued field holding the output A * x
+     */
+    virtual Neon::set::Container matVec(const Field& input, const bdField& bd, Field& output) override;
+};
+
+// Extern template instantiations
+#define STENCIL_MATVEC_EXTERN_TEMPLATE(GRID, DATA)                                 \
+    extern template class StencilMatVec<GRID, DATA, Laplacian7Stencil>;  \
+    extern template class StencilMatVec<GRID, DATA, Laplacian19Stencil>; \
+    extern template class StencilMatVec<GRID, DATA, Laplacian27Stencil>; \
+    extern template class VariableCoefficientMatVec<GRID, DATA>;
+
+STENCIL_MATVEC_EXTERN_TEMPLATE(Neon::eGrid, double)
+STENCIL_MATVEC_EXTERN_TEMPLATE(Neon::eGrid, float)
+STENCIL_MATVEC_EXTERN_TEMPLATE(Neon::dGrid, double)
+STENCIL_MATVEC_EXTERN_TEMPLATE(Neon::dGrid, float)
+STENCIL_MATVEC_EXTERN_TEMPLATE(Neon::bGrid, double)
+STENCIL_MATVEC_EXTERN_TEMPLATE(Neon::bGrid, float)
+#undef STENCIL_MATVEC_EXTERN_TEMPLATE
+
+}  // namespace solver
+}  // namespace Neon
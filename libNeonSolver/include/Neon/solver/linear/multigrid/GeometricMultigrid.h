@@ -0,0 +1,110 @@
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "Neon/domain/dGrid.h"
+#include "Neon/solver/linear/Preconditioner.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * Parameters of the geometric multigrid V-cycle
+ */
+struct MultigridParams
+{
+    int    numLevels = 4;               /// Number of levels including the finest one
+    int    preSmooth = 2;               /// Damped Jacobi sweeps before the restriction on each level
+    int    postSmooth = 2;              /// Damped Jacobi sweeps after the prolongation on each level
+    int    coarseSweeps = 20;           /// Damped Jacobi sweeps of the coarse solve
+    double jacobiWeight = 2.0 / 3.0;  /// Damping factor of the Jacobi sweeps
+};
+
+struct GeometricMultigridUtils
+{
+    /**
+     * Dimension of the level coarser than a level of dimension dim: (dim - 1) / 2 + 1 along each axis
+     */
+    static auto coarsen(const Neon::index_3d& dim) -> Neon::index_3d;
+
+    /**
+     * Maximum number of levels such that the coarsest level still has a few cells along each axis,
+     * and at least 3 slices along z in each of the nPartitions partitions.
+     */
+    static auto maxLevels(const Neon::index_3d& dim, int nPartitions = 1) -> int;
+
+    /**
+     * Whether the partitions of a grid and of its coarser grid cover matching z ranges
+     * i.e., each coarse slice z is in the same partition as the fine slice 2z.
+     * The transfers between the two levels then read at most one halo slice of the other grid.
+     */
+    static auto isAligned(const Neon::dGrid& fine, const Neon::dGrid& coarse) -> bool;
+};
+
+/**
+ * Geometric multigrid V-cycle for the finite-difference Laplacian of LaplacianMatVec.
+ *
+ * Each coarse level has its own dGrid, created by init() with (n - 1) / 2 + 1 cells along each axis of a level of n cells,
+ * so that the work of a level is proportional to its size. The cell c of a level is the cell 2c of the finer one.
+ * The partitions of consecutive levels must cover matching z ranges, which is the case with 2^k + 1 cells along z.
+ *
+ * A cycle is made of damped Jacobi smoothing, full-weighting restriction, a coarse solve by damped Jacobi sweeps,
+ * and trilinear prolongation. The cycle starts from a zero guess and the restriction is the transpose of the prolongation,
+ * so it is a symmetric positive-definite operator that can be used as a preconditioner for PCG.
+ * It converges best when the Dirichlet boundaries lie on the coarse levels e.g., with 2^k + 1 cells along each axis.
+ *
+ * @tparam Grid_ta Grid datastructure (dGrid)
+ * @tparam Real_ta Real number type (typically double or float)
+ */
+template <typename Grid_ta, typename Real_ta>
+class GeometricMultigrid : public Preconditioner<Grid_ta, Real_ta>
+{
+    static_assert(std::is_same_v<Grid_ta, Neon::dGrid>, "The geometric multigrid runs on dGrid");
+
+   public:
+    using self_t = GeometricMultigrid<Grid_ta, Real_ta>;
+    using grid_t = Grid_ta;
+    using Field = typename grid_t::template Field<Real_ta>;
+    using BdField = typename grid_t::template Field<int8_t>;
+
+   protected:
+    MultigridParams      m_params;
+    Real_ta              m_h;      /**< Step size of the finest level */
+    std::vector<grid_t>  m_grids;  /**< Grids of the coarse levels (index 0 is level 1) */
+    std::vector<Field>   m_u, m_f; /**< Correction and right hand side of the coarse levels (index 0 is level 1) */
+    std::vector<BdField> m_bd;     /**< Dirichlet flags of the coarse levels (index 0 is level 1) */
+    std::vector<BdField> m_mask;   /**< Dirichlet neighbours of each level */
+    std::vector<Field>   m_res;    /**< Smoother update and residual of each level */
+
+   public:
+    /**
+     * Constructor
+     * @param[in] h Step size of the finite-difference Laplacian on the finest level
+     * @param[in] params Parameters of the V-cycle
+     */
+    GeometricMultigrid(Real_ta h, const MultigridParams& params = MultigridParams());
+
+    auto params() const -> const MultigridParams&;
+
+    virtual void init(Field& x) override;
+
+    virtual void setup(const BdField& bd) override;
+
+    /**
+     * One V-cycle from a zero initial guess: z := V(r)
+     */
+    virtual std::vector<Neon::set::Container> apply(const Field& r, const BdField& bd, Field& z) override;
+
+   protected:
+    /**
+     * Damped Jacobi sweeps on a level
+     */
+    auto h_smooth(Field& u, const Field& f, const BdField& bd, int level, int sweeps, std::vector<Neon::set::Container>& ops) -> void;
+};
+
+extern template class GeometricMultigrid<Neon::dGrid, double>;
+extern template class GeometricMultigrid<Neon::dGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
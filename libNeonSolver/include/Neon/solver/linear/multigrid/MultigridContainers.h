@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Neon/domain/dGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/set/DevSet.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * Containers of the geometric multigrid.
+ *
+ * Each level has its own grid: the cell c of level l + 1 is the cell 2c of level l, so a level of dimension n
+ * has a coarser level of dimension (n - 1) / 2 + 1 along each axis. The containers of a level run on its grid
+ * and reach their neighbours at distance 1. The transfer containers run on one level and load the field of
+ * the other level with a stencil pattern; the partitions of the two grids must cover matching z ranges
+ * (see GeometricMultigridUtils::isAligned()).
+ *
+ * The mask of a level stores, for each of the 6 directions, whether a Dirichlet cell of the finest level lies
+ * between a cell and its neighbour. Such a neighbour is treated as a Dirichlet boundary (zero correction) by the level operator.
+ */
+
+/**
+ * Mask of the finest level from the Dirichlet flags of the 6 direct neighbours
+ */
+template <typename Grid>
+auto mgInitMask(const typename Grid::template Field<int8_t, 0>& bd,
+                typename Grid::template Field<int8_t, 0>&       mask) -> Neon::set::Container;
+
+/**
+ * Dirichlet flags and mask of a level from the ones of the next finer level. It runs on the coarse grid.
+ */
+template <typename Grid>
+auto mgCoarsen(const typename Grid::template Field<int8_t, 0>& bdFine,
+               const typename Grid::template Field<int8_t, 0>& maskFine,
+               typename Grid::template Field<int8_t, 0>&       bdCoarse,
+               typename Grid::template Field<int8_t, 0>&       maskCoarse) -> Neon::set::Container;
+
+/**
+ * res := f - A_l u, where A_l is the Laplacian with step size h * 2^level.
+ * When omega > 0, res := omega * D_l^-1 (f - A_l u) i.e., the damped Jacobi correction.
+ * res is zero on Dirichlet cells.
+ */
+template <typename Grid, typename Real>
+auto mgResidual(const typename Grid::template Field<Real, 0>&   u,
+                const typename Grid::template Field<Real, 0>&   f,
+                const typename Grid::template Field<int8_t, 0>& bd,
+                const typename Grid::template Field<int8_t, 0>& mask,
+                typename Grid::template Field<Real, 0>&         res,
+                int                                             level,
+                Real                                            h,
+                Real                                            omega) -> Neon::set::Container;
+
+/**
+ * u := u + e, Dirichlet cells are left untouched
+ */
+template <typename Grid, typename Real>
+auto mgAdd(typename Grid::template Field<Real, 0>&         u,
+           const typename Grid::template Field<Real, 0>&   e,
+           const typename Grid::template Field<int8_t, 0>& bd) -> Neon::set::Container;
+
+/**
+ * Full-weighting restriction of the fine residual into the coarse right-hand side. It runs on the coarse grid.
+ * The restriction is the transpose of the prolongation divided by 8, which keeps the V-cycle symmetric.
+ */
+template <typename Grid, typename Real>
+auto mgRestrict(const typename Grid::template Field<Real, 0>&   resFine,
+                const typename Grid::template Field<int8_t, 0>& bdCoarse,
+                typename Grid::template Field<Real, 0>&         fCoarse) -> Neon::set::Container;
+
+/**
+ * Trilinear prolongation of the coarse correction, added to the fine unknown. It runs on the fine grid.
+ * Next to the domain faces, where only one coarse neighbour exists, its value is used as is.
+ */
+template <typename Grid, typename Real>
+auto mgProlongate(const typename Grid::template Field<Real, 0>&   uCoarse,
+                  const typename Grid::template Field<int8_t, 0>& bdFine,
+                  typename Grid::template Field<Real, 0>&         uFine) -> Neon::set::Container;
+
+
+#define MG_EXTERN_TEMPLATE(GRID, DATA)                                                                                                                                                                                                                                                 \
+    extern template auto mgResidual<GRID, DATA>(const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&, const GRID::template Field<int8_t, 0>&, GRID::template Field<DATA, 0>&, int, DATA, DATA)->Neon::set::Container; \
+    extern template auto mgAdd<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&)->Neon::set::Container;                                                                                                     \
+    extern template auto mgRestrict<GRID, DATA>(const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&, GRID::template Field<DATA, 0>&)->Neon::set::Container;                                                                                                \
+    extern template auto mgProlongate<GRID, DATA>(const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&, GRID::template Field<DATA, 0>&)->Neon::set::Container;
+
+MG_EXTERN_TEMPLATE(Neon::dGrid, double);
+MG_EXTERN_TEMPLATE(Neon::dGrid, float);
+#undef MG_EXTERN_TEMPLATE
+
+extern template auto mgInitMask<Neon::dGrid>(const Neon::dGrid::template Field<int8_t, 0>&, Neon::dGrid::template Field<int8_t, 0>&) -> Neon::set::Container;
+extern template auto mgCoarsen<Neon::dGrid>(const Neon::dGrid::template Field<int8_t, 0>&, const Neon::dGrid::template Field<int8_t, 0>&, Neon::dGrid::template Field<int8_t, 0>&, Neon::dGrid::template Field<int8_t, 0>&) -> Neon::set::Container;
+
+}  // namespace solver
+}  // namespace Neon
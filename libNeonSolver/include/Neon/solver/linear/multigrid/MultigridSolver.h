@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Neon/domain/dGrid.h"
+#include "Neon/solver/linear/IterativeLinearSolver.h"
+#include "Neon/solver/linear/multigrid/GeometricMultigrid.h"
+
+namespace Neon {
+namespace solver {
+
+/**
+ * Standalone geometric multigrid solver: each iteration applies one V-cycle to the residual and adds the result to x.
+ * See GeometricMultigrid for the grid requirements.
+ * @tparam Grid_ta Grid datastructure (dGrid)
+ * @tparam Real_ta Real number type (typically double or float)
+ */
+template <typename Grid_ta, typename Real_ta>
+class MultigridSolver_t : public IterativeLinearSolver_t<Grid_ta, Real_ta>
+{
+   public:
+    using self_t = MultigridSolver_t<Grid_ta, Real_ta>;
+    using grid_t = Grid_ta;
+    using Field = typename grid_t::template Field<Real_ta>;
+    using BdField = typename grid_t::template Field<int8_t>;
+    using matVec_t = MatVec<Grid_ta, Real_ta>;
+
+   protected:
+    GeometricMultigrid<Grid_ta, Real_ta> m_multigrid;
+    Field                                m_r, m_s, m_z; /**< Residual, matvec output and V-cycle correction */
+
+   public:
+    /**
+     * Constructor
+     * @param[in] h Step size of the finite-difference Laplacian on the finest level
+     * @param[in] params Parameters of the V-cycle
+     */
+    MultigridSolver_t(Real_ta h, const MultigridParams& params = MultigridParams())
+        : IterativeLinearSolver_t<Grid_ta, Real_ta>(), m_multigrid(h, params)
+    {
+    }
+
+    /**
+     * Return the name of the solver ("MG").
+     * @return Solver name
+     */
+    virtual std::string name() const override
+    {
+        return "MG";
+    }
+
+    /**
+     * Solve the linear system Ax = b with multigrid V-cycles.
+     * A must be the operator the V-cycle is built for i.e., LaplacianMatVec with the same step size.
+     *
+     * @param[in] A Matrix-vector multiply operation representing the linear operator
+     * @param[in,out] x Unknown to solve for
+     * @param[in] b RHS of the linear system
+     * @param[in] bd Dirichlet boundary conditions in the domain (1: on boundary, 0: interior)
+     * @param[in] params Parameters for the solve
+     * @param[in,out] result Resulting information from the solve
+     * @return Status of the solve
+     * \sa SolverParams, SolverResultInfo, SolverStatus
+     */
+    virtual SolverStatus
+    solve(NEON_IN std::shared_ptr<matVec_t> A /*!     Mat vec object                                                            */,
+          NEON_IO Field& x /*!                      Unknown to solve for                                                      */,
+          NEON_IN Field& b /*!                      b RHS of the linear system                                                */,
+          NEON_IN BdField&               bd /*!     Dirichlet boundary conditions in the domain (1: on boundary, 0: interior) */,
+          const SolverParams&            params /*! Parameters for the solve                                                  */,
+          SolverResultInfo&              result /*! Resulting information from the solve                                      */,
+          const Neon::skeleton::Options& opt = Neon::skeleton::Options(Neon::skeleton::Occ::standard, Neon::set::TransferMode::get)) override;
+
+   protected:
+    /**
+     * One time initializations for the solver and its V-cycle
+     */
+    virtual void doInit(Field& x) override;
+};
+
+extern template class MultigridSolver_t<Neon::dGrid, double>;
+extern template class MultigridSolver_t<Neon::dGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
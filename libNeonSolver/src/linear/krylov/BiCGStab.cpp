@@ -0,0 +1,213 @@
+#include "Neon/solver/linear/krylov/BiCGStab.h"
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/domain/interface/common.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "Neon/solver/linear/krylov/BiCGStabContainers.h"
+#include "Neon/solver/linear/krylov/CGContainers.h"
+
+namespace Neon {
+namespace solver {
+
+template <typename Grid_ta, typename Real_ta>
+void BiCGStab_t<Grid_ta, Real_ta>::doInit(Field& x)
+{
+    // Get the cardinality of x for creating internal fields
+    const int cardinality = x.getCardinality();
+
+    m_r = x.getGrid().template newField<Real_ta>("r", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_rhat = x.getGrid().template newField<Real_ta>("rhat", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_p = x.getGrid().template newField<Real_ta>("p", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_v = x.getGrid().template newField<Real_ta>("v", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_s = x.getGrid().template newField<Real_ta>("s", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_t = x.getGrid().template newField<Real_ta>("t", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+}
+
+template <typename Grid_ta, typename Real_ta>
+Real_ta BiCGStab_t<Grid_ta, Real_ta>::h_computeResidual(std::shared_ptr<matVec_t> A, Field& x, Field& b, BdField& bd)
+{
+    // r := (bnd == 1) ? b : x
+    // s := Ax
+    // r := r - Ax = r - s
+    // rhat := r
+    // rr = <r,r>
+
+    auto& bk = this->h_getBackend(m_r);
+
+    Neon::skeleton::Skeleton skeleton(bk);
+    auto                     rr_init = m_r.getGrid().template newPatternScalar<Real_ta>();
+
+    skeleton.sequence({initR<Grid_ta, Real_ta>(m_r, x, b, bd),
+                       A->matVec(x, bd, m_s),
+                       AXPY<Grid_ta, Real_ta>(m_r, m_s),
+                       copy<Grid_ta, Real_ta>(m_rhat, m_r),
+                       m_r.getGrid().dot("init_rTr", m_r, m_r, rr_init)},
+                      "BiCGStab::computeInitResidual");
+    skeleton.run();
+    bk.sync();
+
+    return rr_init();
+}
+
+template <typename Grid_ta, typename Real_ta>
+SolverStatus BiCGStab_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>      A,
+                                                 Field&                         x,
+                                                 Field&                         b,
+                                                 BdField&                       bd,
+                                                 const SolverParams&            params,
+                                                 SolverResultInfo&              result,
+                                                 const Neon::skeleton::Options& opt)
+{
+    // Make sure one time initializations have been done by the user by calling init()
+    if (!this->isInit()) {
+        NeonException exc("BiCGStab_t::solve");
+        exc << "Attempting to call solve() before calling init()";
+        NEON_THROW(exc);
+    }
+    Neon::Timer_ms timerSolution;
+    Neon::Timer_ms timerTotal;
+
+    // Preparations before the solve loop
+    result.solverName = this->name();
+    timerTotal.start();
+
+    auto& bk = this->h_getBackend(x);
+
+    // Compute initial residual
+    bk.sync(Neon::Backend::mainStreamIdx);
+    const Real_ta rr_init = h_computeResidual(A, x, b, bd);
+    result.residualStart = std::sqrt(rr_init);
+
+    // Store all residuals if requested
+    if (params.needResiduals) {
+        result.residuals.reserve(params.maxIterations);
+        result.residuals.push_back(result.residualStart);
+    }
+
+
+    // Solve loop
+    size_t       iter = 0;
+    SolverStatus status = SolverStatus::Error;
+
+    Neon::skeleton::Skeleton bicgstabIter(bk);
+
+    auto rho = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto rr = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto rv = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto ts = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto tt = m_r.getGrid().template newPatternScalar<Real_ta>();
+
+    // beta := (rho/rhoOld)*(alpha/omega) (computed inside bicgstabUpdateP container from rho and the previous rv, ts, tt)
+    // p := r + beta*(p - omega*v) (bicgstabUpdateP container)
+    // v := Ap (matVec container)
+    // rv := <rhat,v> (dot container)
+    // alpha := rho/rv (computed inside bicgstabUpdateS container)
+    // s := r - alpha*v (bicgstabUpdateS container)
+    // t := As (matVec container)
+    // ts := <t,s>, tt := <t,t> (fused dot container)
+    // omega := ts/tt (computed inside bicgstabUpdateXandR container)
+    // x := x + alpha*p + omega*s (bicgstabUpdateXandR container)
+    // r := s - omega*t (bicgstabUpdateXandR container)
+    // rho := <rhat,r>, rr := <r,r> (fused dot container)
+    std::vector<Neon::set::Container> ops{bicgstabUpdateP<Grid_ta, Real_ta>(m_p, m_r, m_v, rho, rv, ts, tt),
+                                          A->matVec(m_p, bd, m_v),
+                                          m_r.getGrid().dot("rhatTv", m_rhat, m_v, rv),
+                                          bicgstabUpdateS<Grid_ta, Real_ta>(m_s, m_r, m_v, rho, rv),
+                                          A->matVec(m_s, bd, m_t)};
+    for (auto& op : bicgstabDots<Grid_ta, Real_ta>("tTs, tTt", m_t, m_s, m_t, m_t, ts, tt)) {
+        ops.push_back(op);
+    }
+    ops.push_back(bicgstabUpdateXandR<Grid_ta, Real_ta>(x, m_r, m_p, m_s, m_t, rho, rv, ts, tt));
+    for (auto& op : bicgstabDots<Grid_ta, Real_ta>("rhatTr, rTr", m_rhat, m_r, m_r, m_r, rho, rr)) {
+        ops.push_back(op);
+    }
+    bicgstabIter.sequence(ops, result.solverName, opt);
+
+    // rhat = r_0, hence rho_0 = <r_0,r_0>
+    // rv = 0 marks the first iteration for bicgstabUpdateP
+    rho() = rr_init;
+    rr() = rr_init;
+    rv() = 0;
+    ts() = 0;
+    tt() = 0;
+
+    // Save the multi-GPU graph
+    bicgstabIter.ioToDot(result.solverName +
+                             "_" + Neon::skeleton::OccUtils::toString(opt.occ()) +
+                             "_" + Neon::set::TransferModeUtils::toString(opt.transferMode()),
+                         "");
+
+    bk.syncAll();
+    timerSolution.start();
+
+
+    for (iter = 0; iter < params.maxIterations; ++iter) {
+        // Stop if converged/diverged/reached maximum iteration
+        status = this->converged(std::sqrt(rr()), result.residualStart, iter, params);
+        if (status == SolverStatus::Converged || status == SolverStatus::Error || status == SolverStatus::IterationLimit) {
+            break;
+        }
+
+        bicgstabIter.run();
+
+        result.residualEnd = std::sqrt(rr());
+
+        // Store residual norms if requested
+        if (params.needResiduals) {
+            result.residuals.push_back(result.residualEnd);
+        }
+
+        if (params.numericalIssueIsFailure && (rv() == Real_ta(0) || ts() == Real_ta(0) || tt() == Real_ta(0) || rho() == Real_ta(0))) {
+            // Breakdown: the shadow residual became orthogonal to r or v, or the stabilization step stagnated.
+            // A converged residual takes precedence as omega = 0 is also reached when s = 0.
+            status = this->converged(result.residualEnd, result.residualStart, iter, params);
+            if (status != SolverStatus::Converged) {
+                status = SolverStatus::NumericalIssue;
+            }
+            ++iter;
+            break;
+        }
+    }
+
+
+    // Post-processing after the solve loop
+    timerSolution.stop();
+    bk.sync();
+    result.numIterations = iter;
+    timerTotal.stop();
+    result.solveTime = timerSolution.time();
+    result.totalTime = timerTotal.time();
+    return status;
+}
+
+
+template <typename Grid_ta, typename Real_ta>
+void BiCGStab_t<Grid_ta, Real_ta>::reset()
+{
+    auto& bk = this->h_getBackend(m_r);
+
+    Neon::skeleton::Skeleton skeleton(bk);
+
+    skeleton.sequence({set<Grid_ta, Real_ta>(m_r, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_rhat, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_p, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_v, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_s, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_t, Real_ta(0.0))},
+                      "BiCGStab::Reset");
+    skeleton.run();
+    bk.sync();
+}
+
+
+template class BiCGStab_t<Neon::eGrid, double>;
+template class BiCGStab_t<Neon::eGrid, float>;
+template class BiCGStab_t<Neon::dGrid, double>;
+template class BiCGStab_t<Neon::dGrid, float>;
+template class BiCGStab_t<Neon::bGrid, double>;
+template class BiCGStab_t<Neon::bGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
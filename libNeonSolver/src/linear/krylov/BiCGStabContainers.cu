@@ -0,0 +1,170 @@
+#include <array>
+#include <tuple>
+
+#include "Neon/core/types/DataView.h"
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/container/Loader.h"
+#include "Neon/solver/linear/krylov/BiCGStabContainers.h"
+
+namespace Neon::solver {
+
+template <typename Grid, typename Real>
+auto bicgstabDots(const std::string&                            name,
+                  typename Grid::template Field<Real, 0>&       a,
+                  typename Grid::template Field<Real, 0>&       b,
+                  typename Grid::template Field<Real, 0>&       c,
+                  typename Grid::template Field<Real, 0>&       d,
+                  Neon::template PatternScalar<Real>&           ab,
+                  Neon::template PatternScalar<Real>&           cd) -> std::vector<Neon::set::Container>
+{
+    const auto& grid = a.getGrid();
+
+    if (grid.getBackend().runtime() != Neon::Runtime::openmp) {
+        // Sum containers run on the device only for CPU devices,
+        // the other runtimes go through the reductions of the grid
+        return {grid.dot(name + " (1)", a, b, ab),
+                grid.dot(name + " (2)", c, d, cd)};
+    }
+
+    auto container = grid.newSumContainer(name, std::tie(ab, cd), [&a, &b, &c, &d](Neon::set::Loader& loader) {
+        const auto& p_a = loader.load(a);
+        const auto& p_b = loader.load(b);
+        const auto& p_c = loader.load(c);
+        const auto& p_d = loader.load(d);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) -> std::array<Real, 2> {
+            std::array<Real, 2> partial{};
+            for (int i = 0; i < p_a.cardinality(); ++i) {
+                partial[0] += p_a(e, i) * p_b(e, i);
+                partial[1] += p_c(e, i) * p_d(e, i);
+            }
+            return partial;
+        };
+    });
+    return {container};
+}
+
+template <typename Grid, typename Real>
+auto bicgstabUpdateP(typename Grid::template Field<Real, 0>&       p,
+                     const typename Grid::template Field<Real, 0>& r,
+                     const typename Grid::template Field<Real, 0>& v,
+                     const Neon::template PatternScalar<Real>&     rho,
+                     const Neon::template PatternScalar<Real>&     rv,
+                     const Neon::template PatternScalar<Real>&     ts,
+                     const Neon::template PatternScalar<Real>&     tt) -> Neon::set::Container
+{
+    auto container = p.getGrid().newContainer("Update P", [&p, &r, &v, &rho, &rv, &ts, &tt](Neon::set::Loader& loader) {
+        auto&       p_p = loader.load(p);
+        const auto& p_r = loader.load(r);
+        const auto& p_v = loader.load(v);
+        const auto& p_rho = loader.load(rho);
+        const auto& p_rv = loader.load(rv);
+        const auto& p_ts = loader.load(ts);
+        const auto& p_tt = loader.load(tt);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
+            // beta := (rho / rhoOld) * (alpha / omega) = (rho / rv) * (tt / ts)
+            // rv is exactly zero only before the first iteration, where p := r.
+            // Unlike CG, rho is not compared against epsilon as it scales with the square of the residual
+            // and is legitimately tiny close to convergence.
+            Real beta = 0;
+            Real omega = 0;
+            if (p_rv() != Real(0) && p_ts() != Real(0)) {
+                beta = (p_rho() / p_rv()) * (p_tt() / p_ts());
+                omega = p_ts() / p_tt();
+            }
+
+            for (int i = 0; i < p_p.cardinality(); ++i) {
+                // p := r + beta (p - omega v)
+                p_p(e, i) = p_r(e, i) + beta * (p_p(e, i) - omega * p_v(e, i));
+            }
+        };
+    });
+    return container;
+}
+
+template <typename Grid, typename Real>
+auto bicgstabUpdateS(typename Grid::template Field<Real, 0>&       s,
+                     const typename Grid::template Field<Real, 0>& r,
+                     const typename Grid::template Field<Real, 0>& v,
+                     const Neon::template PatternScalar<Real>&     rho,
+                     const Neon::template PatternScalar<Real>&     rv) -> Neon::set::Container
+{
+    auto container = s.getGrid().newContainer("Update S", [&s, &r, &v, &rho, &rv](Neon::set::Loader& loader) {
+        auto&       p_s = loader.load(s);
+        const auto& p_r = loader.load(r);
+        const auto& p_v = loader.load(v);
+        const auto& p_rho = loader.load(rho);
+        const auto& p_rv = loader.load(rv);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
+            // alpha := rho / <rhat, v>
+            // A zero denominator is a breakdown of the method, reported by the solver after the iteration
+            const Real alpha = p_rv() != Real(0) ? p_rho() / p_rv() : Real(0);
+
+            for (int i = 0; i < p_s.cardinality(); ++i) {
+                // s := r - alpha v
+                p_s(e, i) = p_r(e, i) - alpha * p_v(e, i);
+            }
+        };
+    });
+    return container;
+}
+
+template <typename Grid, typename Real>
+auto bicgstabUpdateXandR(typename Grid::template Field<Real, 0>&       x,
+                         typename Grid::template Field<Real, 0>&       r,
+                         const typename Grid::template Field<Real, 0>& p,
+                         const typename Grid::template Field<Real, 0>& s,
+                         const typename Grid::template Field<Real, 0>& t,
+                         const Neon::template PatternScalar<Real>&     rho,
+                         const Neon::template PatternScalar<Real>&     rv,
+                         const Neon::template PatternScalar<Real>&     ts,
+                         const Neon::template PatternScalar<Real>&     tt) -> Neon::set::Container
+{
+    auto container = x.getGrid().newContainer("Update X, \\n update R", [&x, &r, &p, &s, &t, &rho, &rv, &ts, &tt](Neon::set::Loader& loader) {
+        auto&       p_x = loader.load(x);
+        auto&       p_r = loader.load(r);
+        const auto& p_p = loader.load(p);
+        const auto& p_s = loader.load(s);
+        const auto& p_t = loader.load(t);
+        const auto& p_rho = loader.load(rho);
+        const auto& p_rv = loader.load(rv);
+        const auto& p_ts = loader.load(ts);
+        const auto& p_tt = loader.load(tt);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
+            const Real alpha = p_rv() != Real(0) ? p_rho() / p_rv() : Real(0);
+            // omega := <t,s> / <t,t>
+            // t = 0 only when s = 0 i.e., the half step already solved the system
+            const Real omega = p_tt() > Real(0) ? p_ts() / p_tt() : Real(0);
+
+            for (int i = 0; i < p_x.cardinality(); ++i) {
+                // x := x + alpha p + omega s
+                p_x(e, i) += alpha * p_p(e, i) + omega * p_s(e, i);
+                // r := s - omega t
+                p_r(e, i) = p_s(e, i) - omega * p_t(e, i);
+            }
+        };
+    });
+    return container;
+}
+
+
+#define BICGSTAB_TEMPLATE(GRID, DATA)                                                                                                                                                                                                                                                                                                                                                                                                  \
+    template auto bicgstabDots<GRID, DATA>(const std::string&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, Neon::template PatternScalar<DATA>&, Neon::template PatternScalar<DATA>&)->std::vector<Neon::set::Container>;                                                                                                    \
+    template auto bicgstabUpdateP<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;                                                                            \
+    template auto bicgstabUpdateS<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;                                                                                                                                                                  \
+    template auto bicgstabUpdateXandR<GRID, DATA>(GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;
+
+BICGSTAB_TEMPLATE(Neon::dGrid, double);
+BICGSTAB_TEMPLATE(Neon::bGrid, double);
+BICGSTAB_TEMPLATE(Neon::eGrid, double);
+BICGSTAB_TEMPLATE(Neon::dGrid, float);
+BICGSTAB_TEMPLATE(Neon::bGrid, float);
+BICGSTAB_TEMPLATE(Neon::eGrid, float);
+#undef BICGSTAB_TEMPLATE
+
+}  // namespace Neon::solver
@@ -1,4 +1,8 @@
 #include "Neon/solver/linear/krylov/CG.h"
+
+#include <algorithm>
+#include <vector>
+
 #include "Neon/core/tools/metaprogramming/debugHelp.h"
 
 #include "Neon/domain/dGrid.h"
@@ -15,11 +19,11 @@ template <typename Grid_ta, typename Real_ta>
 void CG_t<Grid_ta, Real_ta>::doInit(Field& x)
 {
     // Get the cardinality of x for creating internal fields
-    const int cardinality = x.getPartition(Neon::DeviceType::CPU, 0, Neon::DataView::STANDARD).cardinality();
+    const int cardinality = x.getCardinality();
 
-    m_p = x.getGrid().template newField<Real_ta>("p", cardinality, Real_ta(0.), Neon::DataUse::COMPUTE);
-    m_s = x.getGrid().template newField<Real_ta>("s", cardinality, Real_ta(0.), Neon::DataUse::COMPUTE);
-    m_r = x.getGrid().template newField<Real_ta>("r", cardinality, Real_ta(0.), Neon::DataUse::COMPUTE);
+    m_p = x.getGrid().template newField<Real_ta>("p", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_s = x.getGrid().template newField<Real_ta>("s", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_r = x.getGrid().template newField<Real_ta>("r", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
 }
 
 template <typename Grid_ta, typename Real_ta>
@@ -94,28 +98,71 @@ SolverStatus CG_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>        A,
 
     Neon::skeleton::Skeleton cgIter(bk);
 
-    auto delta_new = m_r.getGrid().template newPatternScalar<Real_ta>();
-    auto delta_old = m_r.getGrid().template newPatternScalar<Real_ta>();
+    // Squared residual norms of the iterations: iteration j reads its delta_old from deltaHistory[j]
+    // and its delta_new from deltaHistory[j + 1], and writes the next delta_new into deltaHistory[j + 2].
+    // The single iteration skeleton runs iteration 0, the block skeleton iterations 0 to k - 1,
+    // and the solver shifts the last two entries to the first two after each run.
+    const size_t                              checkEvery = std::max(params.checkEvery, size_t(1));
+    std::vector<Neon::PatternScalar<Real_ta>> deltaHistory;
+    deltaHistory.reserve(checkEvery + 2);
+    for (size_t j = 0; j < checkEvery + 2; ++j) {
+        deltaHistory.push_back(m_r.getGrid().template newPatternScalar<Real_ta>());
+    }
     auto pAp = m_r.getGrid().template newPatternScalar<Real_ta>();
 
-    delta_new() = delta_init;
-
-    // beta := delta_new/delta_old (computed on the fly inside updateP container)
-    // p := r + beta*s (updateP container)
-    // s := Ap (matVec container)
-    // pAp := <p,s> (dot container)
-    // alpha := delta_new/pAp (computed on the fly inside updateXandR container)
-    // x := x + alpha*p (updateXandR container)
-    // r := r - alpha*S (updateXandR container)
-    // delta_old := delta_new (done inside updateXandR container)
-    // delta_new := <r,r> (dot container)
-    cgIter.sequence({updateP<Grid_ta, Real_ta>(m_p, m_r, delta_new(), delta_old()),
-                     A->matVec(m_p, bd, m_s),
-                     m_p.getGrid().dot("pAp", m_p, m_s, pAp),
-                     updateXandR<Grid_ta, Real_ta>(x, m_r, m_p, m_s, delta_new(), pAp(), delta_old()),
-                     m_r.getGrid().dot("rTr", m_r, m_r, delta_new)},
-                    result.solverName, opt);
-    delta_old() = 0;
+    auto cgIteration = [&](size_t j) -> std::vector<Neon::set::Container> {
+        // beta := delta_new/delta_old (computed on the fly inside updateP container)
+        // p := r + beta*p (updateP container)
+        // s := Ap (matVec container)
+        // pAp := <p,s> (dot container)
+        // alpha := delta_new/pAp (computed on the fly inside updateXandR container)
+        // x := x + alpha*p (updateXandR container)
+        // r := r - alpha*s (updateXandR container)
+        // delta_new := <r,r> (dot container)
+        return {updateP<Grid_ta, Real_ta>(m_p, m_r, deltaHistory[j + 1], deltaHistory[j]),
+                A->matVec(m_p, bd, m_s),
+                m_p.getGrid().dot("pAp", m_p, m_s, pAp),
+                updateXandR<Grid_ta, Real_ta>(x, m_r, m_p, m_s, deltaHistory[j + 1], pAp),
+                m_r.getGrid().dot("rTr", m_r, m_r, deltaHistory[j + 2])};
+    };
+    auto shiftHistory = [&](size_t nIterations) {
+        deltaHistory[0]() = deltaHistory[nIterations]();
+        deltaHistory[1]() = deltaHistory[nIterations + 1]();
+    };
+
+    cgIter.sequence(cgIteration(0), result.solverName, opt);
+
+    // When checking every k iterations, k iterations are unrolled in a second skeleton.
+    // If one of them converges, x, r and p are restored to their values at the beginning of the block
+    // and the iterations up to the converged one are run again one by one.
+    Neon::skeleton::Skeleton cgBlock(bk);
+    Neon::skeleton::Skeleton cgSave(bk);
+    Neon::skeleton::Skeleton cgRestore(bk);
+    Field                    xSaved, rSaved, pSaved;
+    if (checkEvery > 1) {
+        std::vector<Neon::set::Container> blockSequence;
+        for (size_t j = 0; j < checkEvery; ++j) {
+            for (auto& container : cgIteration(j)) {
+                blockSequence.push_back(container);
+            }
+        }
+        cgBlock.sequence(blockSequence, result.solverName + "_x" + std::to_string(checkEvery), opt);
+
+        const int cardinality = x.getCardinality();
+        xSaved = x.getGrid().template newField<Real_ta>("xSaved", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+        rSaved = x.getGrid().template newField<Real_ta>("rSaved", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+        pSaved = x.getGrid().template newField<Real_ta>("pSaved", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+        cgSave.sequence({copy<Grid_ta, Real_ta>(xSaved, x),
+                         copy<Grid_ta, Real_ta>(rSaved, m_r),
+                         copy<Grid_ta, Real_ta>(pSaved, m_p)},
+                        "CG::SaveBlock");
+        cgRestore.sequence({copy<Grid_ta, Real_ta>(x, xSaved),
+                            copy<Grid_ta, Real_ta>(m_r, rSaved),
+                            copy<Grid_ta, Real_ta>(m_p, pSaved)},
+                           "CG::RestoreBlock");
+    }
+    deltaHistory[0]() = 0;
+    deltaHistory[1]() = delta_init;
 
     // Save the multi-GPU graph
     cgIter.ioToDot(result.solverName +
@@ -126,22 +173,75 @@ SolverStatus CG_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>        A,
     bk.syncAll();
     timerSolution.start();
 
-
-    for (iter = 0; iter < params.maxIterations; ++iter) {
-        // Stop if converged/diverged/reached maximum iteration
-        status = this->converged(delta_new(), delta_init_sq, iter, params);
-        if (status == SolverStatus::Converged || status == SolverStatus::Error || status == SolverStatus::IterationLimit) {
-            break;
-        }
-
+    // Single iteration: used when checking every iteration, for the last iterations before maxIterations
+    // and to run again the iterations of a block up to the one that converged
+    auto runIteration = [&]() {
         cgIter.run();
+        shiftHistory(1);
+        ++iter;
 
-        result.residualEnd = std::sqrt(delta_new());
+        result.residualEnd = std::sqrt(deltaHistory[1]());
 
         // Store residual norms if requested
         if (params.needResiduals) {
             result.residuals.push_back(result.residualEnd);
         }
+    };
+
+    while (iter < params.maxIterations) {
+        // Stop if converged/diverged/reached maximum iteration
+        status = this->converged(std::sqrt(deltaHistory[1]()), delta_init_sq, iter, params);
+        if (status == SolverStatus::Converged || status == SolverStatus::Error || status == SolverStatus::IterationLimit) {
+            break;
+        }
+
+        if (checkEvery > 1 && iter + checkEvery < params.maxIterations) {
+            // k iterations without looking at the residual in between
+            const Real_ta deltaOldSaved = deltaHistory[0]();
+            const Real_ta deltaNewSaved = deltaHistory[1]();
+            cgSave.run();
+            cgBlock.run();
+
+            // Check the residuals of the k iterations at once.
+            // The last one is checked at the top of the loop.
+            size_t       nIterations = checkEvery;
+            SolverStatus blockStatus = SolverStatus::Iterating;
+            for (size_t j = 0; j + 1 < checkEvery && blockStatus == SolverStatus::Iterating; ++j) {
+                blockStatus = this->converged(std::sqrt(deltaHistory[j + 2]()), delta_init_sq, iter + j + 1, params);
+                if (blockStatus != SolverStatus::Iterating) {
+                    nIterations = j + 1;
+                }
+            }
+
+            if (blockStatus == SolverStatus::Converged) {
+                // Roll back to the beginning of the block and stop at the converged iteration
+                cgRestore.run();
+                deltaHistory[0]() = deltaOldSaved;
+                deltaHistory[1]() = deltaNewSaved;
+                for (size_t j = 0; j < nIterations; ++j) {
+                    runIteration();
+                }
+                status = blockStatus;
+                break;
+            }
+
+            if (params.needResiduals) {
+                for (size_t j = 0; j < nIterations; ++j) {
+                    result.residuals.push_back(std::sqrt(deltaHistory[j + 2]()));
+                }
+            }
+            result.residualEnd = std::sqrt(deltaHistory[nIterations + 1]());
+            iter += nIterations;
+            shiftHistory(checkEvery);
+
+            if (blockStatus == SolverStatus::Error) {
+                status = blockStatus;
+                break;
+            }
+            continue;
+        }
+
+        runIteration();
     }
 
 
@@ -172,12 +272,12 @@ void CG_t<Grid_ta, Real_ta>::reset()
 }
 
 
-template class CG_t<Neon::domain::eGrid, double>;
-template class CG_t<Neon::domain::eGrid, float>;
+template class CG_t<Neon::eGrid, double>;
+template class CG_t<Neon::eGrid, float>;
 template class CG_t<Neon::dGrid, double>;
 template class CG_t<Neon::dGrid, float>;
-template class CG_t<Neon::domain::bGrid, double>;
-template class CG_t<Neon::domain::bGrid, float>;
+template class CG_t<Neon::bGrid, double>;
+template class CG_t<Neon::bGrid, float>;
 
 }  // namespace solver
 }  // namespace Neon
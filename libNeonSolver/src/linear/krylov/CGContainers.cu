@@ -11,9 +11,9 @@ template <typename Grid, typename Real>
 auto set(typename Grid::template Field<Real>& input,
          const Real                                val) -> Neon::set::Container
 {
-    auto container = input.getGrid().getContainer("set", [&, val](Neon::set::Loader& loader) {
+    auto container = input.getGrid().newContainer("set", [&, val](Neon::set::Loader& loader) {
         auto& inp = loader.load(input);
-        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Cell& e) mutable {
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
             for (int i = 0; i < inp.cardinality(); ++i) {
                 inp(e, i) = val;
             }
@@ -27,10 +27,10 @@ template <typename Grid, typename Real>
 auto copy(typename Grid::template Field<Real>&       target,
           const typename Grid::template Field<Real>& source) -> Neon::set::Container
 {
-    auto container = target.getGrid().getContainer("copy", [&](Neon::set::Loader& loader) {
+    auto container = target.getGrid().newContainer("copy", [&](Neon::set::Loader& loader) {
         auto&       tar = loader.load(target);
         const auto& src = loader.load(source);
-        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Cell& e) mutable {
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
             for (int i = 0; i < tar.cardinality(); ++i) {
                 tar(e, i) = src(e, i);
             }
@@ -48,13 +48,13 @@ auto initR(typename Grid::template Field<Real>&       r,
 {
     // r := (bnd == 1) ? b : x
 
-    auto container = r.getGrid().getContainer("initR", [&](Neon::set::Loader& loader) {
+    auto container = r.getGrid().newContainer("initR", [&](Neon::set::Loader& loader) {
         auto&       in_r = loader.load(r);
         const auto& in_x = loader.load(x);
         const auto& in_b = loader.load(b);
         const auto& in_bd = loader.load(bd);
 
-        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Cell& e) mutable {
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
             for (int i = 0; i < in_r.cardinality(); ++i) {
                 if (in_bd(e, i) == 1) {
                     in_r(e, i) = in_b(e, i);
@@ -73,11 +73,11 @@ auto AXPY(typename Grid::template Field<Real>&       r,
           const typename Grid::template Field<Real>& s) -> Neon::set::Container
 {
     // r := r - Ax = r - s
-    auto container = r.getGrid().getContainer("axpy", [&](Neon::set::Loader& loader) {
+    auto container = r.getGrid().newContainer("axpy", [&](Neon::set::Loader& loader) {
         auto&       in_r = loader.load(r);
         const auto& in_s = loader.load(s);
 
-        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Cell& e) mutable {
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
             for (int i = 0; i < in_r.cardinality(); ++i) {
                 in_r(e, i) -= in_s(e, i);
             }
@@ -92,21 +92,21 @@ auto updateXandR(typename Grid::template Field<Real, 0>&       x,
                  typename Grid::template Field<Real, 0>&       r,
                  const typename Grid::template Field<Real, 0>& p,
                  const typename Grid::template Field<Real, 0>& s,
-                 const Real&                                        delta_new,
-                 const Real&                                        pAp,
-                 Real&                                              delta_old) -> Neon::set::Container
+                 const Neon::template PatternScalar<Real>&     delta_new,
+                 const Neon::template PatternScalar<Real>&     pAp) -> Neon::set::Container
 {
-    auto container = x.getGrid().getContainer("Update X, \\n update R", [&x, &r, &p, &s, &delta_new, &pAp, &delta_old](Neon::set::Loader& loader) {
+    auto container = x.getGrid().newContainer("Update X, \\n update R", [&x, &r, &p, &s, &delta_new, &pAp](Neon::set::Loader& loader) {
         auto&       p_x = loader.load(x);
         auto&       p_r = loader.load(r);
         const auto& p_p = loader.load(p);
         const auto& p_s = loader.load(s);
+        const auto& p_delta_new = loader.load(delta_new);
+        const auto& p_pAp = loader.load(pAp);
 
-        // alpha := rr / p.Ap;
-        const Real alpha = delta_new / pAp;
-        delta_old = delta_new;
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
+            // alpha := rr / p.Ap;
+            const Real alpha = p_delta_new() / p_pAp();
 
-        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Cell& e) mutable {
             for (int i = 0; i < p_x.cardinality(); ++i) {
                 // x := x + alpha p
                 p_x(e, i) += alpha * p_p(e, i);
@@ -122,23 +122,20 @@ auto updateXandR(typename Grid::template Field<Real, 0>&       x,
 template <typename Grid, typename Real>
 auto updateP(typename Grid::template Field<Real, 0>&       p,
              const typename Grid::template Field<Real, 0>& r,
-             const Real&                                        delta_new,
-             const Real&                                        delta_old) -> Neon::set::Container
+             const Neon::template PatternScalar<Real>&     delta_new,
+             const Neon::template PatternScalar<Real>&     delta_old) -> Neon::set::Container
 {
-    auto container = p.getGrid().getContainer("Update P", [&p, &r, &delta_new, &delta_old](Neon::set::Loader& loader) {
+    auto container = p.getGrid().newContainer("Update P", [&p, &r, &delta_new, &delta_old](Neon::set::Loader& loader) {
         auto&       p_p = loader.load(p);
         const auto& p_r = loader.load(r);
+        const auto& p_delta_new = loader.load(delta_new);
+        const auto& p_delta_old = loader.load(delta_old);
 
-        // beta := delta_new / delta_old;
-        //unless if we are at first iteration, then delta_old =0 and beta = 0
-        Real beta;
-        if (std::abs(delta_old) > std::numeric_limits<Real>::epsilon()) {
-            beta = delta_new / delta_old;
-        } else {
-            beta = 0;
-        }
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
+            // beta := delta_new / delta_old;
+            // unless if we are at first iteration, then delta_old = 0 and beta = 0
+            const Real beta = (p_delta_old() != Real(0)) ? p_delta_new() / p_delta_old() : Real(0);
 
-        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Cell& e) mutable {
             // p := r + beta p
             for (int i = 0; i < p_p.cardinality(); ++i) {
                 p_p(e, i) = p_r(e, i) + beta * p_p(e, i);
@@ -152,9 +149,9 @@ auto updateP(typename Grid::template Field<Real, 0>&       p,
 template <typename Grid, typename Real>
 auto printField(typename Grid::template Field<Real, 0>& p) -> Neon::set::Container
 {
-    auto container = p.getGrid().getContainer("printField", [&p](Neon::set::Loader& loader) {
+    auto container = p.getGrid().newContainer("printField", [&p](Neon::set::Loader& loader) {
         auto& p_p = loader.load(p);
-        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Cell& e) mutable {
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
             for (int i = 0; i < p_p.cardinality(); ++i) {
                 //printf("p_rr %ld %d %f \n", e, i, p_p.eRef(e, i));
             }
@@ -165,20 +162,20 @@ auto printField(typename Grid::template Field<Real, 0>& p) -> Neon::set::Contain
 
 
 #define CG_EXTERN_TEMPLATE(GRID, DATA)                                                                                                                                                                                                                \
-    template auto updateXandR<GRID, DATA>(GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const DATA&, const DATA&, DATA&)->Neon::set::Container; \
+    template auto updateXandR<GRID, DATA>(GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container; \
     template auto set<GRID, DATA>(GRID::template Field<DATA, 0>&, const DATA)->Neon::set::Container;                                                                                                                                                \
     template auto copy<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&)->Neon::set::Container;                                                                                                                   \
     template auto initR<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&)->Neon::set::Container;                                \
     template auto AXPY<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&)->Neon::set::Container;                                                                                                                   \
-    template auto updateP<GRID, DATA>(typename GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const DATA&, const DATA&)->Neon::set::Container;                                                                             \
+    template auto updateP<GRID, DATA>(typename GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;                                                                             \
     template auto printField<GRID, DATA>(typename GRID::template Field<DATA, 0>&)->Neon::set::Container;
 
 CG_EXTERN_TEMPLATE(Neon::dGrid, double);
-CG_EXTERN_TEMPLATE(Neon::domain::bGrid, double);
-CG_EXTERN_TEMPLATE(Neon::domain::eGrid, double);
+CG_EXTERN_TEMPLATE(Neon::bGrid, double);
+CG_EXTERN_TEMPLATE(Neon::eGrid, double);
 CG_EXTERN_TEMPLATE(Neon::dGrid, float);
-CG_EXTERN_TEMPLATE(Neon::domain::bGrid, float);
-CG_EXTERN_TEMPLATE(Neon::domain::eGrid, float);
+CG_EXTERN_TEMPLATE(Neon::bGrid, float);
+CG_EXTERN_TEMPLATE(Neon::eGrid, float);
 #undef CG_EXTERN_TEMPLATE
 
 
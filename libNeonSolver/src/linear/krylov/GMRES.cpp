@@ -0,0 +1,371 @@
+#include "Neon/solver/linear/krylov/GMRES.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/domain/interface/common.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "Neon/solver/linear/krylov/CGContainers.h"
+#include "Neon/solver/linear/krylov/GMRESContainers.h"
+
+namespace Neon {
+namespace solver {
+
+namespace {
+
+template <int N, typename T>
+auto toArray(const std::vector<T>& v, size_t first) -> std::array<T, N>
+{
+    std::array<T, N> a;
+    for (int k = 0; k < N; ++k) {
+        a[k] = v[first + k];
+    }
+    return a;
+}
+
+}  // namespace
+
+template <typename Grid_ta, typename Real_ta>
+void GMRES_t<Grid_ta, Real_ta>::doInit(Field& x)
+{
+    // Get the cardinality of x for creating internal fields
+    const int cardinality = x.getCardinality();
+    auto&     grid = x.getGrid();
+
+    m_r = grid.template newField<Real_ta>("r", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_s = grid.template newField<Real_ta>("s", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_w = grid.template newField<Real_ta>("w", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+
+    m_v.clear();
+    for (int j = 0; j <= m_restart; ++j) {
+        m_v.push_back(grid.template newField<Real_ta>("v" + std::to_string(j), cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE));
+    }
+
+    // The containers keep references to the scalars: they must not move once the skeletons are built
+    m_h.assign(m_restart, {});
+    for (int j = 0; j < m_restart; ++j) {
+        for (int i = 0; i < j + 1; ++i) {
+            m_h[j].push_back(grid.template newPatternScalar<Real_ta>());
+        }
+    }
+    m_ww.clear();
+    m_y.clear();
+    for (int j = 0; j < m_restart; ++j) {
+        m_ww.push_back(grid.template newPatternScalar<Real_ta>());
+        m_y.push_back(grid.template newPatternScalar<Real_ta>());
+    }
+    m_rr = grid.template newPatternScalar<Real_ta>();
+    m_hNorm.assign(m_restart, Real_ta(0));
+}
+
+template <typename Grid_ta, typename Real_ta>
+auto GMRES_t<Grid_ta, Real_ta>::h_dots(const std::string&                                name,
+                                       Field&                                            w,
+                                       const std::vector<Field*>&                        v,
+                                       const std::vector<Neon::PatternScalar<Real_ta>*>& out) -> std::vector<Neon::set::Container>
+{
+    std::vector<Neon::set::Container> ops;
+    if (w.getGrid().getBackend().runtime() != Neon::Runtime::openmp) {
+        // Sum containers run on the device only for CPU devices,
+        // the other runtimes go through the reductions of the grid
+        for (size_t k = 0; k < v.size(); ++k) {
+            ops.push_back(w.getGrid().dot(name + "_" + std::to_string(k), w, *v[k], *out[k]));
+        }
+        return ops;
+    }
+
+    const std::vector<const Field*> operands(v.begin(), v.end());
+    for (size_t first = 0; first < v.size(); first += fusedWidth) {
+        const std::string chunkName = name + "_" + std::to_string(first / fusedWidth);
+        switch (std::min<size_t>(fusedWidth, v.size() - first)) {
+            case 1:
+                ops.push_back(gmresDots<Grid_ta, Real_ta, 1>(chunkName, w, toArray<1>(operands, first), toArray<1>(out, first)));
+                break;
+            case 2:
+                ops.push_back(gmresDots<Grid_ta, Real_ta, 2>(chunkName, w, toArray<2>(operands, first), toArray<2>(out, first)));
+                break;
+            case 3:
+                ops.push_back(gmresDots<Grid_ta, Real_ta, 3>(chunkName, w, toArray<3>(operands, first), toArray<3>(out, first)));
+                break;
+            default:
+                ops.push_back(gmresDots<Grid_ta, Real_ta, 4>(chunkName, w, toArray<4>(operands, first), toArray<4>(out, first)));
+                break;
+        }
+    }
+    return ops;
+}
+
+template <typename Grid_ta, typename Real_ta>
+auto GMRES_t<Grid_ta, Real_ta>::h_accumulate(Field&                                                  out,
+                                             const std::vector<const Field*>&                        v,
+                                             const std::vector<const Neon::PatternScalar<Real_ta>*>& c,
+                                             Real_ta                                                 sign) -> std::vector<Neon::set::Container>
+{
+    std::vector<Neon::set::Container> ops;
+    for (size_t first = 0; first < v.size(); first += fusedWidth) {
+        switch (std::min<size_t>(fusedWidth, v.size() - first)) {
+            case 1:
+                ops.push_back(gmresAccumulate<Grid_ta, Real_ta, 1>(out, toArray<1>(v, first), toArray<1>(c, first), sign));
+                break;
+            case 2:
+                ops.push_back(gmresAccumulate<Grid_ta, Real_ta, 2>(out, toArray<2>(v, first), toArray<2>(c, first), sign));
+                break;
+            case 3:
+                ops.push_back(gmresAccumulate<Grid_ta, Real_ta, 3>(out, toArray<3>(v, first), toArray<3>(c, first), sign));
+                break;
+            default:
+                ops.push_back(gmresAccumulate<Grid_ta, Real_ta, 4>(out, toArray<4>(v, first), toArray<4>(c, first), sign));
+                break;
+        }
+    }
+    return ops;
+}
+
+template <typename Grid_ta, typename Real_ta>
+SolverStatus GMRES_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>      A,
+                                              Field&                         x,
+                                              Field&                         b,
+                                              BdField&                       bd,
+                                              const SolverParams&            params,
+                                              SolverResultInfo&              result,
+                                              const Neon::skeleton::Options& opt)
+{
+    // Make sure one time initializations have been done by the user by calling init()
+    if (!this->isInit()) {
+        NeonException exc("GMRES_t::solve");
+        exc << "Attempting to call solve() before calling init()";
+        NEON_THROW(exc);
+    }
+    Neon::Timer_ms timerSolution;
+    Neon::Timer_ms timerTotal;
+
+    // Preparations before the solve loop
+    result.solverName = this->name();
+    timerTotal.start();
+
+    auto&     bk = this->h_getBackend(x);
+    const int m = m_restart;
+
+    // r := (bnd == 1) ? b : x
+    // s := Ax
+    // r := r - s
+    // rr := <r,r>
+    // v_0 := r / sqrt(rr) (gmresNormalize container)
+    Neon::skeleton::Skeleton restartSkl(bk);
+    restartSkl.sequence({initR<Grid_ta, Real_ta>(m_r, x, b, bd),
+                         A->matVec(x, bd, m_s),
+                         AXPY<Grid_ta, Real_ta>(m_r, m_s),
+                         m_r.getGrid().dot("rTr", m_r, m_r, m_rr),
+                         gmresNormalize<Grid_ta, Real_ta>(m_v[0], m_r, m_rr)},
+                        "GMRES::restart");
+
+    // Arnoldi step j:
+    // w := A v_j (matVec container)
+    // h_ij := <w, v_i> for i <= j (fused dot containers, independent of each other)
+    // w := w - sum_i h_ij v_i (accumulate containers)
+    // ww := <w,w> (dot container)
+    // h_{j+1,j} := sqrt(ww), v_{j+1} := w / h_{j+1,j} (gmresNormalize container)
+    std::vector<Neon::skeleton::Skeleton> arnoldi(m);
+    for (int j = 0; j < m; ++j) {
+        std::vector<Field*>                              basis;
+        std::vector<const Neon::PatternScalar<Real_ta>*> coeff;
+        std::vector<Neon::PatternScalar<Real_ta>*>       scalars;
+        for (int i = 0; i <= j; ++i) {
+            basis.push_back(&m_v[i]);
+            coeff.push_back(&m_h[j][i]);
+            scalars.push_back(&m_h[j][i]);
+        }
+
+        std::vector<Neon::set::Container> ops{A->matVec(m_v[j], bd, m_w)};
+        for (auto& op : h_dots("GMRES_dots", m_w, basis, scalars)) {
+            ops.push_back(op);
+        }
+        for (auto& op : h_accumulate(m_w, std::vector<const Field*>(basis.begin(), basis.end()), coeff, Real_ta(-1))) {
+            ops.push_back(op);
+        }
+        ops.push_back(m_w.getGrid().dot("wTw", m_w, m_w, m_ww[j]));
+        ops.push_back(gmresNormalize<Grid_ta, Real_ta>(m_v[j + 1], m_w, m_ww[j]));
+
+        arnoldi[j].setBackend(bk);
+        arnoldi[j].sequence(ops, result.solverName + "_arnoldi" + std::to_string(j), opt);
+    }
+
+    // x := x + V y, with y zero-padded past the size of the current Krylov space
+    Neon::skeleton::Skeleton updateX(bk);
+    {
+        std::vector<const Field*>                        basis;
+        std::vector<const Neon::PatternScalar<Real_ta>*> coeff;
+        for (int i = 0; i < m; ++i) {
+            basis.push_back(&m_v[i]);
+            coeff.push_back(&m_y[i]);
+        }
+        updateX.sequence(h_accumulate(x, basis, coeff, Real_ta(1)), "GMRES::updateX", opt);
+    }
+
+    // Save the multi-GPU graph of the largest Arnoldi step
+    arnoldi[m - 1].ioToDot(result.solverName +
+                               "_" + Neon::skeleton::OccUtils::toString(opt.occ()) +
+                               "_" + Neon::set::TransferModeUtils::toString(opt.transferMode()),
+                           "");
+
+    // Hessenberg matrix (column j holds h_0j, ..., h_{j+1,j}), Givens rotations and rotated rhs beta e_1
+    std::vector<std::vector<Real_ta>> H(m, std::vector<Real_ta>(m + 1, Real_ta(0)));
+    std::vector<Real_ta>              cs(m, Real_ta(0));
+    std::vector<Real_ta>              sn(m, Real_ta(0));
+    std::vector<Real_ta>              g(m + 1, Real_ta(0));
+
+    // Solve the triangular system H y = g for the first k columns and update x
+    auto h_updateX = [&](int k) {
+        for (auto& y : m_y) {
+            y() = Real_ta(0);
+        }
+        for (int i = k - 1; i >= 0; --i) {
+            Real_ta sum = g[i];
+            for (int l = i + 1; l < k; ++l) {
+                sum -= H[l][i] * m_y[l]();
+            }
+            m_y[i]() = sum / H[i][i];
+        }
+        updateX.run();
+    };
+
+    // Compute initial residual
+    bk.sync(Neon::Backend::mainStreamIdx);
+    restartSkl.run();
+    bk.sync();
+    m_beta = std::sqrt(m_rr());
+    result.residualStart = m_beta;
+    result.residualEnd = m_beta;
+    g[0] = m_beta;
+
+    // Store all residuals if requested
+    if (params.needResiduals) {
+        result.residuals.reserve(params.maxIterations);
+        result.residuals.push_back(result.residualStart);
+    }
+
+    bk.syncAll();
+    timerSolution.start();
+
+
+    // Solve loop
+    size_t       iter = 0;
+    SolverStatus status = SolverStatus::Error;
+    int          j = 0;  // Size of the current Krylov space
+    bool         breakdown = false;
+
+    for (iter = 0; iter < params.maxIterations; ++iter) {
+        // Stop if converged/diverged/reached maximum iteration
+        status = this->converged(result.residualEnd, result.residualStart, iter, params);
+        if (status == SolverStatus::Converged || status == SolverStatus::Error || status == SolverStatus::IterationLimit) {
+            break;
+        }
+
+        // Restart once the Krylov space is full or invariant
+        if (j == m || breakdown) {
+            h_updateX(j);
+            restartSkl.run();
+            bk.sync();
+            m_beta = std::sqrt(m_rr());
+            std::fill(g.begin(), g.end(), Real_ta(0));
+            g[0] = m_beta;
+            j = 0;
+            breakdown = false;
+        }
+
+        arnoldi[j].run();
+        bk.sync();
+        m_hNorm[j] = std::sqrt(std::max(m_ww[j](), Real_ta(0)));
+
+        // New Hessenberg column, rotated by the previous Givens rotations
+        auto& h = H[j];
+        for (int i = 0; i <= j; ++i) {
+            h[i] = m_h[j][i]();
+        }
+        h[j + 1] = m_hNorm[j];
+        for (int i = 0; i < j; ++i) {
+            const Real_ta t = cs[i] * h[i] + sn[i] * h[i + 1];
+            h[i + 1] = -sn[i] * h[i] + cs[i] * h[i + 1];
+            h[i] = t;
+        }
+
+        // Givens rotation zeroing the subdiagonal entry
+        const Real_ta d = std::hypot(h[j], h[j + 1]);
+        if (!(d > Real_ta(0))) {
+            // Singular Hessenberg matrix: the new direction does not reduce the residual
+            if (params.numericalIssueIsFailure) {
+                status = SolverStatus::NumericalIssue;
+                ++iter;
+                break;
+            }
+            breakdown = true;
+            continue;
+        }
+        cs[j] = h[j] / d;
+        sn[j] = h[j + 1] / d;
+        h[j] = d;
+        h[j + 1] = Real_ta(0);
+        g[j + 1] = -sn[j] * g[j];
+        g[j] = cs[j] * g[j];
+
+        // A zero subdiagonal entry means the Krylov space is invariant and the residual estimate is exact
+        breakdown = !(m_hNorm[j] > Real_ta(0));
+        ++j;
+
+        result.residualEnd = std::abs(g[j]);
+
+        // Store residual norms if requested
+        if (params.needResiduals) {
+            result.residuals.push_back(result.residualEnd);
+        }
+    }
+
+    // Fold the last Krylov space into the solution
+    if (j > 0) {
+        h_updateX(j);
+    }
+
+
+    // Post-processing after the solve loop
+    timerSolution.stop();
+    bk.sync();
+    result.numIterations = iter;
+    timerTotal.stop();
+    result.solveTime = timerSolution.time();
+    result.totalTime = timerTotal.time();
+    return status;
+}
+
+
+template <typename Grid_ta, typename Real_ta>
+void GMRES_t<Grid_ta, Real_ta>::reset()
+{
+    auto& bk = this->h_getBackend(m_r);
+
+    std::vector<Neon::set::Container> ops{set<Grid_ta, Real_ta>(m_r, Real_ta(0.0)),
+                                          set<Grid_ta, Real_ta>(m_s, Real_ta(0.0)),
+                                          set<Grid_ta, Real_ta>(m_w, Real_ta(0.0))};
+    for (auto& v : m_v) {
+        ops.push_back(set<Grid_ta, Real_ta>(v, Real_ta(0.0)));
+    }
+
+    Neon::skeleton::Skeleton skeleton(bk);
+    skeleton.sequence(ops, "GMRES::Reset");
+    skeleton.run();
+    bk.sync();
+}
+
+
+template class GMRES_t<Neon::eGrid, double>;
+template class GMRES_t<Neon::eGrid, float>;
+template class GMRES_t<Neon::dGrid, double>;
+template class GMRES_t<Neon::dGrid, float>;
+template class GMRES_t<Neon::bGrid, double>;
+template class GMRES_t<Neon::bGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
@@ -0,0 +1,132 @@
+#include <array>
+#include <cmath>
+#include <tuple>
+#include <utility>
+
+#include "Neon/core/types/DataView.h"
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/container/Loader.h"
+#include "Neon/solver/linear/krylov/GMRESContainers.h"
+
+namespace Neon::solver {
+
+namespace {
+
+template <typename Grid, typename Real, int N, size_t... I>
+auto gmresLoad(Neon::set::Loader&                                                  loader,
+               const std::array<const typename Grid::template Field<Real, 0>*, N>& v,
+               std::index_sequence<I...>)
+    -> std::array<typename Grid::template Field<Real, 0>::Partition, N>
+{
+    return {loader.load(*v[I])...};
+}
+
+template <typename Real, int N, size_t... I>
+auto gmresLoadScalars(Neon::set::Loader&                                              loader,
+                      const std::array<const Neon::template PatternScalar<Real>*, N>& c,
+                      std::index_sequence<I...>)
+    -> std::array<Neon::PatternScalarPartition<Real>, N>
+{
+    return {loader.load(*c[I])...};
+}
+
+template <typename Real, int N, size_t... I>
+auto gmresTie(const std::array<Neon::template PatternScalar<Real>*, N>& out, std::index_sequence<I...>)
+{
+    return std::tie(*out[I]...);
+}
+
+}  // namespace
+
+template <typename Grid, typename Real, int N>
+auto gmresDots(const std::string&                                                  name,
+               const typename Grid::template Field<Real, 0>&                       w,
+               const std::array<const typename Grid::template Field<Real, 0>*, N>& v,
+               const std::array<Neon::template PatternScalar<Real>*, N>&           out) -> Neon::set::Container
+{
+    auto container = w.getGrid().newSumContainer(name, gmresTie<Real, N>(out, std::make_index_sequence<N>()), [&w, v](Neon::set::Loader& loader) {
+        const auto& p_w = loader.load(w);
+        const auto  p_v = gmresLoad<Grid, Real, N>(loader, v, std::make_index_sequence<N>());
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) -> std::array<Real, N> {
+            std::array<Real, N> partial{};
+            for (int i = 0; i < p_w.cardinality(); ++i) {
+                const Real wi = p_w(e, i);
+                for (int k = 0; k < N; ++k) {
+                    partial[k] += wi * p_v[k](e, i);
+                }
+            }
+            return partial;
+        };
+    });
+    return container;
+}
+
+template <typename Grid, typename Real, int N>
+auto gmresAccumulate(typename Grid::template Field<Real, 0>&                             out,
+                     const std::array<const typename Grid::template Field<Real, 0>*, N>& v,
+                     const std::array<const Neon::template PatternScalar<Real>*, N>&     c,
+                     Real                                                                sign) -> Neon::set::Container
+{
+    auto container = out.getGrid().newContainer("GMRES accumulate", [&out, v, c, sign](Neon::set::Loader& loader) {
+        auto&      p_out = loader.load(out);
+        const auto p_v = gmresLoad<Grid, Real, N>(loader, v, std::make_index_sequence<N>());
+        const auto p_c = gmresLoadScalars<Real, N>(loader, c, std::make_index_sequence<N>());
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
+            for (int i = 0; i < p_out.cardinality(); ++i) {
+                Real sum = 0;
+                for (int k = 0; k < N; ++k) {
+                    sum += p_c[k]() * p_v[k](e, i);
+                }
+                p_out(e, i) += sign * sum;
+            }
+        };
+    });
+    return container;
+}
+
+template <typename Grid, typename Real>
+auto gmresNormalize(typename Grid::template Field<Real, 0>&       out,
+                    const typename Grid::template Field<Real, 0>& in,
+                    const Neon::template PatternScalar<Real>&     nn) -> Neon::set::Container
+{
+    auto container = out.getGrid().newContainer("GMRES normalize", [&out, &in, &nn](Neon::set::Loader& loader) {
+        auto&       p_out = loader.load(out);
+        const auto& p_in = loader.load(in);
+        const auto& p_nn = loader.load(nn);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
+            const Real invNorm = p_nn() > Real(0) ? Real(1) / std::sqrt(p_nn()) : Real(0);
+            for (int i = 0; i < p_out.cardinality(); ++i) {
+                p_out(e, i) = invNorm * p_in(e, i);
+            }
+        };
+    });
+    return container;
+}
+
+
+#define GMRES_TEMPLATE_N(GRID, DATA, N)                                                                                                                                                                                      \
+    template auto gmresDots<GRID, DATA, N>(const std::string&, const GRID::template Field<DATA, 0>&, const std::array<const GRID::template Field<DATA, 0>*, N>&, const std::array<Neon::template PatternScalar<DATA>*, N>&)->Neon::set::Container; \
+    template auto gmresAccumulate<GRID, DATA, N>(GRID::template Field<DATA, 0>&, const std::array<const GRID::template Field<DATA, 0>*, N>&, const std::array<const Neon::template PatternScalar<DATA>*, N>&, DATA)->Neon::set::Container;
+
+#define GMRES_TEMPLATE(GRID, DATA)    \
+    GMRES_TEMPLATE_N(GRID, DATA, 1)   \
+    GMRES_TEMPLATE_N(GRID, DATA, 2)   \
+    GMRES_TEMPLATE_N(GRID, DATA, 3)   \
+    GMRES_TEMPLATE_N(GRID, DATA, 4)   \
+    template auto gmresNormalize<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;
+
+GMRES_TEMPLATE(Neon::dGrid, double);
+GMRES_TEMPLATE(Neon::bGrid, double);
+GMRES_TEMPLATE(Neon::eGrid, double);
+GMRES_TEMPLATE(Neon::dGrid, float);
+GMRES_TEMPLATE(Neon::bGrid, float);
+GMRES_TEMPLATE(Neon::eGrid, float);
+#undef GMRES_TEMPLATE
+#undef GMRES_TEMPLATE_N
+
+}  // namespace Neon::solver
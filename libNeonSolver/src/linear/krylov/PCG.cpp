@@ -0,0 +1,210 @@
+#include "Neon/solver/linear/krylov/PCG.h"
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/domain/interface/common.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "Neon/solver/linear/krylov/CGContainers.h"
+
+namespace Neon {
+namespace solver {
+
+template <typename Grid_ta, typename Real_ta>
+void PCG_t<Grid_ta, Real_ta>::doInit(Field& x)
+{
+    // Get the cardinality of x for creating internal fields
+    const int cardinality = x.getCardinality();
+
+    m_p = x.getGrid().template newField<Real_ta>("p", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_s = x.getGrid().template newField<Real_ta>("s", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_r = x.getGrid().template newField<Real_ta>("r", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_z = x.getGrid().template newField<Real_ta>("z", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+
+    m_preconditioner->init(x);
+}
+
+template <typename Grid_ta, typename Real_ta>
+Real_ta PCG_t<Grid_ta, Real_ta>::h_computeResidual(std::shared_ptr<matVec_t> A, Field& x, Field& b, BdField& bd, Real_ta& rz)
+{
+    // r := (bnd == 1) ? b : x
+    // s := Ax
+    // r := r - Ax = r - s
+    // rr = <r,r>
+    // z := M^-1 r
+    // rz = <r,z>
+
+    auto& bk = this->h_getBackend(m_r);
+
+    Neon::skeleton::Skeleton skeleton(bk);
+    auto                     rr_init = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto                     rz_init = m_r.getGrid().template newPatternScalar<Real_ta>();
+
+    std::vector<Neon::set::Container> ops{initR<Grid_ta, Real_ta>(m_r, x, b, bd),
+                                          A->matVec(x, bd, m_s),
+                                          AXPY<Grid_ta, Real_ta>(m_r, m_s),
+                                          m_r.getGrid().dot("init_rTr", m_r, m_r, rr_init)};
+    for (auto& op : m_preconditioner->apply(m_r, bd, m_z)) {
+        ops.push_back(op);
+    }
+    ops.push_back(m_r.getGrid().dot("init_rTz", m_r, m_z, rz_init));
+
+    skeleton.sequence(ops, "PCG::computeInitResidual");
+    skeleton.run();
+    bk.sync();
+
+    rz = rz_init();
+    return rr_init();
+}
+
+template <typename Grid_ta, typename Real_ta>
+SolverStatus PCG_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>      A,
+                                            Field&                         x,
+                                            Field&                         b,
+                                            BdField&                       bd,
+                                            const SolverParams&            params,
+                                            SolverResultInfo&              result,
+                                            const Neon::skeleton::Options& opt)
+{
+    // Make sure one time initializations have been done by the user by calling init()
+    if (!this->isInit()) {
+        NeonException exc("PCG_t::solve");
+        exc << "Attempting to call solve() before calling init()";
+        NEON_THROW(exc);
+    }
+    Neon::Timer_ms timerSolution;
+    Neon::Timer_ms timerTotal;
+
+    // Preparations before the solve loop
+    result.solverName = this->name();
+    timerTotal.start();
+
+    auto& bk = this->h_getBackend(x);
+
+    m_preconditioner->setup(bd);
+
+    // Compute initial residual
+    bk.sync(Neon::Backend::mainStreamIdx);
+    Real_ta       rz_init = 0;
+    const Real_ta rr_init = h_computeResidual(A, x, b, bd, rz_init);
+    result.residualStart = std::sqrt(rr_init);
+
+    // Store all residuals if requested
+    if (params.needResiduals) {
+        result.residuals.reserve(params.maxIterations);
+        result.residuals.push_back(result.residualStart);
+    }
+
+
+    // Solve loop
+    size_t       iter = 0;
+    SolverStatus status = SolverStatus::Error;
+
+    Neon::skeleton::Skeleton pcgIter(bk);
+
+    auto delta_new = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto delta_old = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto delta_next = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto pAp = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto rr = m_r.getGrid().template newPatternScalar<Real_ta>();
+
+    // beta := delta_new/delta_old (computed on the fly inside updateP container)
+    // p := z + beta*p (updateP container)
+    // s := Ap (matVec container)
+    // pAp := <p,s> (dot container)
+    // alpha := delta_new/pAp (computed on the fly inside updateXandR container)
+    // x := x + alpha*p (updateXandR container)
+    // r := r - alpha*s (updateXandR container)
+    // z := M^-1 r (preconditioner containers)
+    // delta_next := <r,z> (dot container)
+    // rr := <r,r> (dot container)
+    // delta_old := delta_new, delta_new := delta_next (done by the solver in between iterations)
+    std::vector<Neon::set::Container> ops{updateP<Grid_ta, Real_ta>(m_p, m_z, delta_new, delta_old),
+                                          A->matVec(m_p, bd, m_s),
+                                          m_p.getGrid().dot("pAp", m_p, m_s, pAp),
+                                          updateXandR<Grid_ta, Real_ta>(x, m_r, m_p, m_s, delta_new, pAp)};
+    for (auto& op : m_preconditioner->apply(m_r, bd, m_z)) {
+        ops.push_back(op);
+    }
+    ops.push_back(m_r.getGrid().dot("rTz", m_r, m_z, delta_next));
+    ops.push_back(m_r.getGrid().dot("rTr", m_r, m_r, rr));
+    pcgIter.sequence(ops, result.solverName, opt);
+
+    delta_new() = rz_init;
+    delta_old() = 0;
+    rr() = rr_init;
+
+    // Save the multi-GPU graph
+    pcgIter.ioToDot(result.solverName +
+                        "_" + Neon::skeleton::OccUtils::toString(opt.occ()) +
+                        "_" + Neon::set::TransferModeUtils::toString(opt.transferMode()),
+                    "");
+
+    bk.syncAll();
+    timerSolution.start();
+
+
+    for (iter = 0; iter < params.maxIterations; ++iter) {
+        // Stop if converged/diverged/reached maximum iteration
+        status = this->converged(std::sqrt(rr()), result.residualStart, iter, params);
+        if (status == SolverStatus::Converged || status == SolverStatus::Error || status == SolverStatus::IterationLimit) {
+            break;
+        }
+
+        pcgIter.run();
+
+        if (params.numericalIssueIsFailure && !(pAp() > 0)) {
+            // (p, Ap) <= 0: the matrix is not positive-definite
+            status = SolverStatus::NumericalIssue;
+            ++iter;
+            break;
+        }
+
+        delta_old() = delta_new();
+        delta_new() = delta_next();
+        result.residualEnd = std::sqrt(rr());
+
+        // Store residual norms if requested
+        if (params.needResiduals) {
+            result.residuals.push_back(result.residualEnd);
+        }
+    }
+
+
+    // Post-processing after the solve loop
+    timerSolution.stop();
+    bk.sync();
+    result.numIterations = iter;
+    timerTotal.stop();
+    result.solveTime = timerSolution.time();
+    result.totalTime = timerTotal.time();
+    return status;
+}
+
+
+template <typename Grid_ta, typename Real_ta>
+void PCG_t<Grid_ta, Real_ta>::reset()
+{
+    auto& bk = this->h_getBackend(m_r);
+
+    Neon::skeleton::Skeleton skeleton(bk);
+
+    skeleton.sequence({set<Grid_ta, Real_ta>(m_r, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_p, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_s, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_z, Real_ta(0.0))},
+                      "PCG::Reset");
+    skeleton.run();
+    bk.sync();
+}
+
+
+template class PCG_t<Neon::eGrid, double>;
+template class PCG_t<Neon::eGrid, float>;
+template class PCG_t<Neon::dGrid, double>;
+template class PCG_t<Neon::dGrid, float>;
+template class PCG_t<Neon::bGrid, double>;
+template class PCG_t<Neon::bGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
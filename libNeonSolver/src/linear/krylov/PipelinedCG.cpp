@@ -0,0 +1,197 @@
+#include "Neon/solver/linear/krylov/PipelinedCG.h"
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/domain/interface/common.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "Neon/solver/linear/krylov/CGContainers.h"
+#include "Neon/solver/linear/krylov/PipelinedCGContainers.h"
+
+namespace Neon {
+namespace solver {
+
+template <typename Grid_ta, typename Real_ta>
+void PipelinedCG_t<Grid_ta, Real_ta>::doInit(Field& x)
+{
+    // Get the cardinality of x for creating internal fields
+    const int cardinality = x.getCardinality();
+
+    m_r = x.getGrid().template newField<Real_ta>("r", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_w = x.getGrid().template newField<Real_ta>("w", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_q = x.getGrid().template newField<Real_ta>("q", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_z = x.getGrid().template newField<Real_ta>("z", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_s = x.getGrid().template newField<Real_ta>("s", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_p = x.getGrid().template newField<Real_ta>("p", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+}
+
+template <typename Grid_ta, typename Real_ta>
+Real_ta PipelinedCG_t<Grid_ta, Real_ta>::h_computeResidual(std::shared_ptr<matVec_t> A, Field& x, Field& b, BdField& bd)
+{
+    // r := (bnd == 1) ? b : x
+    // q := Ax
+    // r := r - Ax = r - q
+    // w := Ar
+    // rr = <r,r>
+
+    auto& bk = this->h_getBackend(m_r);
+
+    Neon::skeleton::Skeleton skeleton(bk);
+    auto                     delta_init = m_r.getGrid().template newPatternScalar<Real_ta>();
+
+    skeleton.sequence({initR<Grid_ta, Real_ta>(m_r, x, b, bd),
+                       A->matVec(x, bd, m_q),
+                       AXPY<Grid_ta, Real_ta>(m_r, m_q),
+                       A->matVec(m_r, bd, m_w),
+                       m_r.getGrid().dot("init_rTr", m_r, m_r, delta_init)},
+                      "PipelinedCG::computeInitResidual");
+    skeleton.run();
+    bk.sync();
+
+    return delta_init();
+}
+
+template <typename Grid_ta, typename Real_ta>
+SolverStatus PipelinedCG_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>      A,
+                                                    Field&                         x,
+                                                    Field&                         b,
+                                                    BdField&                       bd,
+                                                    const SolverParams&            params,
+                                                    SolverResultInfo&              result,
+                                                    const Neon::skeleton::Options& opt)
+{
+    // Make sure one time initializations have been done by the user by calling init()
+    if (!this->isInit()) {
+        NeonException exc("PipelinedCG_t::solve");
+        exc << "Attempting to call solve() before calling init()";
+        NEON_THROW(exc);
+    }
+    Neon::Timer_ms timerSolution;
+    Neon::Timer_ms timerTotal;
+
+    // Preparations before the solve loop
+    result.solverName = this->name();
+    timerTotal.start();
+
+    auto& bk = this->h_getBackend(x);
+
+    // Compute initial residual
+    bk.sync(Neon::Backend::mainStreamIdx);
+    const Real_ta delta_init = h_computeResidual(A, x, b, bd);
+    result.residualStart = std::sqrt(delta_init);
+
+    // Store all residuals if requested
+    if (params.needResiduals) {
+        result.residuals.reserve(params.maxIterations);
+    }
+
+
+    // Solve loop
+    size_t       iter = 0;
+    SolverStatus status = SolverStatus::Error;
+
+    Neon::skeleton::Skeleton pipelinedIter(bk);
+
+    auto gamma = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto delta = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto gammaOld = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto alphaOld = m_r.getGrid().template newPatternScalar<Real_ta>();
+
+    Real_ta alpha = 0;
+    Real_ta beta = 0;
+
+    // gamma := <r,r> (dot container)
+    // delta := <w,r> (dot container)
+    // q := Aw (matVec container), it does not depend on the two dot products
+    // beta := gamma/gammaOld (computed on the fly inside the update container)
+    // alpha := gamma/(delta - beta*gamma/alphaOld) (computed on the fly inside the update container)
+    // z := q + beta*z, s := w + beta*s, p := r + beta*p (update container)
+    // x := x + alpha*p, r := r - alpha*s, w := w - alpha*z (update container)
+    pipelinedIter.sequence({m_r.getGrid().dot("rTr", m_r, m_r, gamma),
+                            m_r.getGrid().dot("wTr", m_w, m_r, delta),
+                            A->matVec(m_w, bd, m_q),
+                            updatePipelinedCG<Grid_ta, Real_ta>(x, m_r, m_w, m_z, m_s, m_p, m_q,
+                                                                gamma, delta, gammaOld, alphaOld)},
+                           result.solverName, opt);
+    gammaOld() = 0;
+    alphaOld() = 0;
+
+    // Save the multi-GPU graph
+    pipelinedIter.ioToDot(result.solverName +
+                              "_" + Neon::skeleton::OccUtils::toString(opt.occ()) +
+                              "_" + Neon::set::TransferModeUtils::toString(opt.transferMode()),
+                          "");
+
+    bk.syncAll();
+    timerSolution.start();
+
+
+    while (iter < params.maxIterations) {
+        pipelinedIter.run();
+        ++iter;
+
+        // gamma is the residual the iteration started from
+        result.residualEnd = std::sqrt(gamma());
+
+        // Store residual norms if requested
+        if (params.needResiduals) {
+            result.residuals.push_back(result.residualEnd);
+        }
+
+        // Same step lengths as the ones of the update container
+        pipelinedCGSteps(gamma(), delta(), gammaOld(), alphaOld(), alpha, beta);
+
+        // Stop if converged/diverged/reached maximum iteration
+        status = this->converged(result.residualEnd, result.residualStart, iter - 1, params);
+        if (status == SolverStatus::Iterating && params.numericalIssueIsFailure && !(alpha > 0)) {
+            // (p, Ap) <= 0: the matrix is not positive-definite
+            status = SolverStatus::NumericalIssue;
+        }
+        if (status != SolverStatus::Iterating) {
+            break;
+        }
+
+        gammaOld() = gamma();
+        alphaOld() = alpha;
+    }
+
+
+    // Post-processing after the solve loop
+    timerSolution.stop();
+    bk.sync();
+    result.numIterations = iter;
+    timerTotal.stop();
+    result.solveTime = timerSolution.time();
+    result.totalTime = timerTotal.time();
+    return status;
+}
+
+
+template <typename Grid_ta, typename Real_ta>
+void PipelinedCG_t<Grid_ta, Real_ta>::reset()
+{
+    auto& bk = this->h_getBackend(m_r);
+
+    Neon::skeleton::Skeleton skeleton(bk);
+
+    skeleton.sequence({set<Grid_ta, Real_ta>(m_r, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_w, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_q, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_z, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_s, Real_ta(0.0)),
+                       set<Grid_ta, Real_ta>(m_p, Real_ta(0.0))},
+                      "PipelinedCG::Reset");
+    skeleton.run();
+    bk.sync();
+}
+
+
+template class PipelinedCG_t<Neon::eGrid, double>;
+template class PipelinedCG_t<Neon::eGrid, float>;
+template class PipelinedCG_t<Neon::dGrid, double>;
+template class PipelinedCG_t<Neon::dGrid, float>;
+template class PipelinedCG_t<Neon::bGrid, double>;
+template class PipelinedCG_t<Neon::bGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
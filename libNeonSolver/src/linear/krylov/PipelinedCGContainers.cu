@@ -0,0 +1,77 @@
+#include "Neon/core/types/DataView.h"
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/container/Loader.h"
+#include "Neon/solver/linear/krylov/PipelinedCGContainers.h"
+
+namespace Neon::solver {
+
+template <typename Grid, typename Real>
+auto updatePipelinedCG(typename Grid::template Field<Real, 0>&       x,
+                       typename Grid::template Field<Real, 0>&       r,
+                       typename Grid::template Field<Real, 0>&       w,
+                       typename Grid::template Field<Real, 0>&       z,
+                       typename Grid::template Field<Real, 0>&       s,
+                       typename Grid::template Field<Real, 0>&       p,
+                       const typename Grid::template Field<Real, 0>& q,
+                       const Neon::template PatternScalar<Real>&     gamma,
+                       const Neon::template PatternScalar<Real>&     delta,
+                       const Neon::template PatternScalar<Real>&     gammaOld,
+                       const Neon::template PatternScalar<Real>&     alphaOld) -> Neon::set::Container
+{
+    auto container = x.getGrid().newContainer("Update X, R, W, \\n Z, S, P", [&x, &r, &w, &z, &s, &p, &q, &gamma, &delta, &gammaOld, &alphaOld](Neon::set::Loader& loader) {
+        auto&       p_x = loader.load(x);
+        auto&       p_r = loader.load(r);
+        auto&       p_w = loader.load(w);
+        auto&       p_z = loader.load(z);
+        auto&       p_s = loader.load(s);
+        auto&       p_p = loader.load(p);
+        const auto& p_q = loader.load(q);
+        const auto& p_gamma = loader.load(gamma);
+        const auto& p_delta = loader.load(delta);
+        const auto& p_gammaOld = loader.load(gammaOld);
+        const auto& p_alphaOld = loader.load(alphaOld);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& e) mutable {
+            Real a;
+            Real b;
+            pipelinedCGSteps(p_gamma(), p_delta(), p_gammaOld(), p_alphaOld(), a, b);
+
+            for (int i = 0; i < p_x.cardinality(); ++i) {
+                // z := q + beta z
+                const Real zNew = p_q(e, i) + b * p_z(e, i);
+                // s := w + beta s
+                const Real sNew = p_w(e, i) + b * p_s(e, i);
+                // p := r + beta p
+                const Real pNew = p_r(e, i) + b * p_p(e, i);
+
+                p_z(e, i) = zNew;
+                p_s(e, i) = sNew;
+                p_p(e, i) = pNew;
+
+                // x := x + alpha p
+                p_x(e, i) += a * pNew;
+                // r := r - alpha s
+                p_r(e, i) -= a * sNew;
+                // w := w - alpha z
+                p_w(e, i) -= a * zNew;
+            }
+        };
+    });
+    return container;
+}
+
+
+#define PIPELINED_CG_TEMPLATE(GRID, DATA)                                                                                                                                                                                                                                                   \
+    template auto updatePipelinedCG<GRID, DATA>(GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&, const Neon::template PatternScalar<DATA>&)->Neon::set::Container;
+
+PIPELINED_CG_TEMPLATE(Neon::dGrid, double);
+PIPELINED_CG_TEMPLATE(Neon::bGrid, double);
+PIPELINED_CG_TEMPLATE(Neon::eGrid, double);
+PIPELINED_CG_TEMPLATE(Neon::dGrid, float);
+PIPELINED_CG_TEMPLATE(Neon::bGrid, float);
+PIPELINED_CG_TEMPLATE(Neon::eGrid, float);
+#undef PIPELINED_CG_TEMPLATE
+
+}  // namespace Neon::solver
@@ -0,0 +1,85 @@
+#include "Neon/core/core.h"
+#include "Neon/domain/interface/LaunchConfig.h"
+#include "Neon/solver/linear/matvecs/AdvectionDiffusionMatVec.h"
+
+namespace Neon {
+namespace solver {
+
+template <typename Grid, typename Real>
+inline Neon::set::Container AdvectionDiffusionMatVec<Grid, Real>::matVec(const Field&   input,
+                                                                         const bdField& boundary,
+                                                                         Field&         output)
+{
+    const Real                stepSize = m_h;
+    const Real                nu = m_nu;
+    const std::array<Real, 3> vel = m_velocity;
+
+    auto cont = input.getGrid().newContainer("AdvectionDiffusion", [&, stepSize, nu, vel](Neon::set::Loader& L) {
+        auto& inp = L.load(input, Neon::Pattern::STENCIL);
+        auto& bnd = L.load(boundary);
+        auto& out = L.load(output);
+
+        // Precompute nu/h^2 and a/h
+        const Real diff = nu / (stepSize * stepSize);
+        const Real ax = vel[0] / stepSize;
+        const Real ay = vel[1] / stepSize;
+        const Real az = vel[2] / stepSize;
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& cell) mutable {
+            const int cardinality = inp.cardinality();
+
+            // Neighbor along an axis (0: x, 1: y, 2: z) in the direction sign
+            auto neighbor = [&](int axis, int sign, int c) {
+                const Neon::int8_3d ngh(static_cast<int8_t>(axis == 0 ? sign : 0),
+                                        static_cast<int8_t>(axis == 1 ? sign : 0),
+                                        static_cast<int8_t>(axis == 2 ? sign : 0));
+                return inp.getNghData(cell, ngh, c);
+            };
+
+            // Iterate through each element's cardinality
+            for (int c = 0; c < cardinality; ++c) {
+                const Real center = inp(cell, c);
+                if (bnd(cell, c) == 0) {
+                    out(cell, c) = center;
+                } else {
+                    Real sum(0.0);
+                    int  numNeighb = 0;
+                    Real advection(0.0);
+
+                    const Real a[3] = {ax, ay, az};
+                    for (int axis = 0; axis < 3; ++axis) {
+                        auto minus = neighbor(axis, -1, c);
+                        auto plus = neighbor(axis, 1, c);
+                        if (minus.isValid()) {
+                            ++numNeighb;
+                            sum += minus.getData();
+                        }
+                        if (plus.isValid()) {
+                            ++numNeighb;
+                            sum += plus.getData();
+                        }
+                        // Upwind difference: backward for a > 0, forward for a < 0
+                        if (a[axis] > 0 && minus.isValid()) {
+                            advection += a[axis] * (center - minus.getData());
+                        } else if (a[axis] < 0 && plus.isValid()) {
+                            advection += a[axis] * (plus.getData() - center);
+                        }
+                    }
+                    out(cell, c) = (-sum + static_cast<Real>(numNeighb) * center) * diff + advection;
+                }
+            }
+        };
+    });
+    return cont;
+}
+
+// Template instantiations
+template class AdvectionDiffusionMatVec<Neon::eGrid, double>;
+template class AdvectionDiffusionMatVec<Neon::eGrid, float>;
+template class AdvectionDiffusionMatVec<Neon::dGrid, double>;
+template class AdvectionDiffusionMatVec<Neon::dGrid, float>;
+template class AdvectionDiffusionMatVec<Neon::bGrid, double>;
+template class AdvectionDiffusionMatVec<Neon::bGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
@@ -12,15 +12,15 @@ inline Neon::set::Container LaplacianMatVec<Grid, Real>::matVec(const Field&   i
 {
     Real stepSize = m_h;
 
-    auto cont = input.getGrid().getContainer("Laplacian", [&, stepSize](Neon::set::Loader& L) {
-        auto& inp = L.load(input, Neon::Compute::STENCIL);
+    auto cont = input.getGrid().newContainer("Laplacian", [&, stepSize](Neon::set::Loader& L) {
+        auto& inp = L.load(input, Neon::Pattern::STENCIL);
         auto& bnd = L.load(boundary);
         auto& out = L.load(output);
 
         // Precompute 1/h^2
         const Real invh2 = Real(1.0) / (stepSize * stepSize);
 
-        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Cell& cell) mutable {
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& cell) mutable {
             const int cardinality = inp.cardinality();
 
             // Iterate through each element's cardinality
@@ -31,63 +31,62 @@ inline Neon::set::Container LaplacianMatVec<Grid, Real>::matVec(const Field&   i
                 } else {
                     Real       sum(0.0);
                     int           numNeighb = 0;
-                    const Real defaultVal{0};
 
                     auto checkNeighbor = [&sum, &numNeighb](Neon::domain::NghData<Real>& neighbor) {
-                        if (neighbor.isValid) {
+                        if (neighbor.isValid()) {
                             ++numNeighb;
-                            sum += neighbor.value;
+                            sum += neighbor.getData();
                         }
                     };
                     // Laplacian stencil operates on 6 neighbors (assuming 3D)
                     if constexpr (std::is_same<Grid, Neon::domain::details::eGrid::eGrid>::value) {
                         for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
-                            auto neighbor = inp.nghVal(cell, nghIdx, c, defaultVal);
+                            auto neighbor = inp.getNghData(cell, nghIdx, c);
                             checkNeighbor(neighbor);
                         }
                     } else {
-                        typename Grid::template Field<Real, 0>::Partition::nghIdx_t ngh(0, 0, 0);
+                        typename Grid::template Field<Real, 0>::Partition::NghIdx ngh(0, 0, 0);
 
                         //+x
                         ngh.x = 1;
                         ngh.y = 0;
                         ngh.z = 0;
-                        auto neighbor = inp.nghVal(cell, ngh, c, defaultVal);
+                        auto neighbor = inp.getNghData(cell, ngh, c);
                         checkNeighbor(neighbor);
 
                         //-x
                         ngh.x = -1;
                         ngh.y = 0;
                         ngh.z = 0;
-                        neighbor = inp.nghVal(cell, ngh, c, defaultVal);
+                        neighbor = inp.getNghData(cell, ngh, c);
                         checkNeighbor(neighbor);
 
                         //+y
                         ngh.x = 0;
                         ngh.y = 1;
                         ngh.z = 0;
-                        neighbor = inp.nghVal(cell, ngh, c, defaultVal);
+                        neighbor = inp.getNghData(cell, ngh, c);
                         checkNeighbor(neighbor);
 
                         //-y
                         ngh.x = 0;
                         ngh.y = -1;
                         ngh.z = 0;
-                        neighbor = inp.nghVal(cell, ngh, c, defaultVal);
+                        neighbor = inp.getNghData(cell, ngh, c);
                         checkNeighbor(neighbor);
 
                         //+z
                         ngh.x = 0;
                         ngh.y = 0;
                         ngh.z = 1;
-                        neighbor = inp.nghVal(cell, ngh, c, defaultVal);
+                        neighbor = inp.getNghData(cell, ngh, c);
                         checkNeighbor(neighbor);
 
                         //-z
                         ngh.x = 0;
                         ngh.y = 0;
                         ngh.z = -1;
-                        neighbor = inp.nghVal(cell, ngh, c, defaultVal);
+                        neighbor = inp.getNghData(cell, ngh, c);
                         checkNeighbor(neighbor);
                     }
                     out(cell, c) = (-sum + static_cast<Real>(numNeighb) * center) * invh2;
@@ -99,12 +98,12 @@ inline Neon::set::Container LaplacianMatVec<Grid, Real>::matVec(const Field&   i
 }
 
 // Template instantiations
-template class LaplacianMatVec<Neon::domain::eGrid, double>;
-template class LaplacianMatVec<Neon::domain::eGrid, float>;
+template class LaplacianMatVec<Neon::eGrid, double>;
+template class LaplacianMatVec<Neon::eGrid, float>;
 template class LaplacianMatVec<Neon::dGrid, double>;
 template class LaplacianMatVec<Neon::dGrid, float>;
-template class LaplacianMatVec<Neon::domain::bGrid, double>;
-template class LaplacianMatVec<Neon::domain::bGrid, float>;
+template class LaplacianMatVec<Neon::bGrid, double>;
+template class LaplacianMatVec<Neon::bGrid, float>;
 
 }  // namespace solver
 }  // namespace Neon
\ No newline at end of file
@@ -0,0 +1,213 @@
+#include <utility>
+
+#include "Neon/core/core.h"
+#include "Neon/domain/interface/LaunchConfig.h"
+#include "Neon/solver/linear/matvecs/StencilMatVec.h"
+
+namespace Neon {
+namespace solver {
+
+namespace {
+
+/**
+ * Whether all the neighbors within the stencil radius of a cell are inside the domain
+ */
+template <int radius>
+NEON_CUDA_HOST_DEVICE inline auto isInterior(const Neon::index_3d& g, const Neon::index_3d& dim) -> bool
+{
+    return g.x >= radius && g.y >= radius && g.z >= radius &&
+           g.x < dim.x - radius && g.y < dim.y - radius && g.z < dim.z - radius;
+}
+
+/**
+ * Direct read of the I-th dGrid neighbor of the stencil, the caller guarantees that it is inside the domain.
+ * The point is copied into a constexpr local so that the static stencil table is never referenced by device code.
+ */
+template <typename StencilT, size_t I, typename Partition, typename Idx>
+NEON_CUDA_HOST_DEVICE inline auto uncheckedNgh(const Partition& f, const Idx& cell, int card)
+{
+    constexpr StencilPoint p = StencilT::points[I];
+    const Idx              ngh(cell.get().x + p.x, cell.get().y + p.y, cell.get().z + p.z);
+    return f(ngh, card);
+}
+
+/**
+ * Checked read of the I-th neighbor of the stencil
+ */
+template <typename StencilT, size_t I, typename Partition, typename Idx>
+NEON_CUDA_HOST_DEVICE inline auto checkedNgh(const Partition& f, const Idx& cell, int card)
+{
+    constexpr StencilPoint p = StencilT::points[I];
+    return f.template getNghData<p.x, p.y, p.z>(cell, card);
+}
+
+/**
+ * Weight of the I-th point of the stencil
+ */
+template <typename StencilT, size_t I, typename Real>
+NEON_CUDA_HOST_DEVICE constexpr auto weight() -> Real
+{
+    constexpr StencilPoint p = StencilT::points[I];
+    return Real(p.weight);
+}
+
+/**
+ * sum_k w_k (u - u_k) over the stencil points, all of them inside the domain
+ */
+template <typename StencilT, typename Real, typename Partition, typename Idx, size_t... I>
+NEON_CUDA_HOST_DEVICE inline auto interiorSum(const Partition& inp, const Idx& cell, int card, Real center, std::index_sequence<I...>) -> Real
+{
+    return (Real(0) + ... + (weight<StencilT, I, Real>() * (center - uncheckedNgh<StencilT, I>(inp, cell, card))));
+}
+
+/**
+ * sum_k w_k (u - u_k) over the stencil points inside the domain
+ */
+template <typename StencilT, typename Real, typename Partition, typename Idx, size_t... I>
+NEON_CUDA_HOST_DEVICE inline auto checkedSum(const Partition& inp, const Idx& cell, int card, Real center, std::index_sequence<I...>) -> Real
+{
+    auto term = [&](auto ngh, Real w) -> Real {
+        return ngh.isValid() ? w * (center - ngh.getData()) : Real(0);
+    };
+    return (Real(0) + ... + term(checkedNgh<StencilT, I>(inp, cell, card), weight<StencilT, I, Real>()));
+}
+
+/**
+ * sum_faces (k + k_n) / 2 (u - u_n) over the faces, all of them inside the domain
+ */
+template <typename Real, typename Partition, typename Idx, size_t... I>
+NEON_CUDA_HOST_DEVICE inline auto interiorFluxSum(const Partition& inp, const Partition& kappa, const Idx& cell, int card, Real center, Real k, std::index_sequence<I...>) -> Real
+{
+    using S = Laplacian7Stencil;
+    return (Real(0) + ... + (Real(0.5) * (k + uncheckedNgh<S, I>(kappa, cell, 0)) * (center - uncheckedNgh<S, I>(inp, cell, card))));
+}
+
+/**
+ * sum_faces (k + k_n) / 2 (u - u_n) over the faces inside the domain
+ */
+template <typename Real, typename Partition, typename Idx, size_t... I>
+NEON_CUDA_HOST_DEVICE inline auto checkedFluxSum(const Partition& inp, const Partition& kappa, const Idx& cell, int card, Real center, Real k, std::index_sequence<I...>) -> Real
+{
+    using S = Laplacian7Stencil;
+    auto term = [&](auto ngh, auto kNgh) -> Real {
+        return ngh.isValid() ? Real(0.5) * (k + kNgh.getData()) * (center - ngh.getData()) : Real(0);
+    };
+    return (Real(0) + ... + term(checkedNgh<S, I>(inp, cell, card), checkedNgh<S, I>(kappa, cell, 0)));
+}
+
+}  // namespace
+
+template <typename Grid, typename Real, typename StencilT>
+Neon::set::Container StencilMatVec<Grid, Real, StencilT>::matVec(const Field&   input,
+                                                                  const bdField& boundary,
+                                                                  Field&         output)
+{
+    Real stepSize = m_h;
+
+    auto cont = input.getGrid().newContainer(StencilT::name, [&, stepSize](Neon::set::Loader& L) {
+        auto& inp = L.load(input, Neon::Pattern::STENCIL);
+        auto& bnd = L.load(boundary);
+        auto& out = L.load(output);
+
+        // Precompute 1/(denominator h^2)
+        const Real           scale = Real(1.0) / (Real(StencilT::denominator) * stepSize * stepSize);
+        const Neon::index_3d dim = input.getGrid().getDimension();
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& cell) mutable {
+            using Indices = std::make_index_sequence<StencilT::numPoints>;
+            const int cardinality = inp.cardinality();
+
+            // Only dGrid can address a neighbor without going through the validity checks
+            bool interior = false;
+            if constexpr (std::is_same<Grid, Neon::dGrid>::value) {
+                interior = isInterior<StencilT::radius>(inp.getGlobalIndex(cell), dim);
+            }
+
+            // Iterate through each element's cardinality
+            for (int c = 0; c < cardinality; ++c) {
+                const Real center = inp(cell, c);
+                if (bnd(cell, c) == 0) {
+                    out(cell, c) = center;
+                    continue;
+                }
+                Real sum;
+                if constexpr (std::is_same<Grid, Neon::dGrid>::value) {
+                    sum = interior ? interiorSum<StencilT>(inp, cell, c, center, Indices())
+                                   : checkedSum<StencilT>(inp, cell, c, center, Indices());
+                } else {
+                    sum = checkedSum<StencilT>(inp, cell, c, center, Indices());
+                }
+                out(cell, c) = sum * scale;
+            }
+        };
+    });
+    return cont;
+}
+
+template <typename Grid, typename Real>
+Neon::set::Container VariableCoefficientMatVec<Grid, Real>::matVec(const Field&   input,
+                                                                   const bdField& boundary,
+                                                                   Field&         output)
+{
+    Real stepSize = m_h;
+    // Only const fields can be loaded with a stencil pattern
+    const Field& kappa = m_kappa;
+
+    auto cont = input.getGrid().newContainer("VariableCoefficient", [&, stepSize](Neon::set::Loader& L) {
+        auto& inp = L.load(input, Neon::Pattern::STENCIL);
+        auto& kap = L.load(kappa, Neon::Pattern::STENCIL);
+        auto& bnd = L.load(boundary);
+        auto& out = L.load(output);
+
+        // Precompute 1/h^2
+        const Real           invh2 = Real(1.0) / (stepSize * stepSize);
+        const Neon::index_3d dim = input.getGrid().getDimension();
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& cell) mutable {
+            using Indices = std::make_index_sequence<Laplacian7Stencil::numPoints>;
+            const int  cardinality = inp.cardinality();
+            const Real k = kap(cell, 0);
+
+            bool interior = false;
+            if constexpr (std::is_same<Grid, Neon::dGrid>::value) {
+                interior = isInterior<Laplacian7Stencil::radius>(inp.getGlobalIndex(cell), dim);
+            }
+
+            // Iterate through each element's cardinality
+            for (int c = 0; c < cardinality; ++c) {
+                const Real center = inp(cell, c);
+                if (bnd(cell, c) == 0) {
+                    out(cell, c) = center;
+                    continue;
+                }
+                Real sum;
+                if constexpr (std::is_same<Grid, Neon::dGrid>::value) {
+                    sum = interior ? interiorFluxSum(inp, kap, cell, c, center, k, Indices())
+                                   : checkedFluxSum(inp, kap, cell, c, center, k, Indices());
+                } else {
+                    sum = checkedFluxSum(inp, kap, cell, c, center, k, Indices());
+                }
+                out(cell, c) = sum * invh2;
+            }
+        };
+    });
+    return cont;
+}
+
+// Template instantiations
+#define STENCIL_MATVEC_TEMPLATE(GRID, DATA)                    \
+    template class StencilMatVec<GRID, DATA, Laplacian7Stencil>;  \
+    template class StencilMatVec<GRID, DATA, Laplacian19Stencil>; \
+    template class StencilMatVec<GRID, DATA, Laplacian27Stencil>; \
+    template class VariableCoefficientMatVec<GRID, DATA>;
+
+STENCIL_MATVEC_TEMPLATE(Neon::eGrid, double)
+STENCIL_MATVEC_TEMPLATE(Neon::eGrid, float)
+STENCIL_MATVEC_TEMPLATE(Neon::dGrid, double)
+STENCIL_MATVEC_TEMPLATE(Neon::dGrid, float)
+STENCIL_MATVEC_TEMPLATE(Neon::bGrid, double)
+STENCIL_MATVEC_TEMPLATE(Neon::bGrid, float)
+#undef STENCIL_MATVEC_TEMPLATE
+
+}  // namespace solver
+}  // namespace Neon
@@ -0,0 +1,183 @@
+#include "Neon/solver/linear/multigrid/GeometricMultigrid.h"
+
+#include <algorithm>
+
+#include "Neon/domain/dGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "Neon/solver/linear/krylov/CGContainers.h"
+#include "Neon/solver/linear/multigrid/MultigridContainers.h"
+
+namespace Neon {
+namespace solver {
+
+auto GeometricMultigridUtils::coarsen(const Neon::index_3d& dim) -> Neon::index_3d
+{
+    return Neon::index_3d((dim.x - 1) / 2 + 1,
+                          (dim.y - 1) / 2 + 1,
+                          (dim.z - 1) / 2 + 1);
+}
+
+auto GeometricMultigridUtils::maxLevels(const Neon::index_3d& dim, int nPartitions) -> int
+{
+    int            levels = 1;
+    Neon::index_3d coarse = coarsen(dim);
+    // Keep at least 4 spacings of the coarsest level along each axis
+    while (std::min(coarse.x, std::min(coarse.y, coarse.z)) >= 5 && coarse.z >= 3 * nPartitions) {
+        ++levels;
+        coarse = coarsen(coarse);
+    }
+    return levels;
+}
+
+auto GeometricMultigridUtils::isAligned(const Neon::dGrid& fine, const Neon::dGrid& coarse) -> bool
+{
+    // Each coarse slice must be in the same partition as the fine slice it lies on
+    for (int z = 0; z < coarse.getDimension().z; ++z) {
+        if (coarse.getSetIdx({0, 0, z}) != fine.getSetIdx({0, 0, 2 * z})) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Grid_ta, typename Real_ta>
+GeometricMultigrid<Grid_ta, Real_ta>::GeometricMultigrid(Real_ta h, const MultigridParams& params)
+    : Preconditioner<Grid_ta, Real_ta>(), m_params(params), m_h(h)
+{
+    if (m_params.numLevels < 1) {
+        NeonException exc("GeometricMultigrid");
+        exc << "The number of levels must be at least 1, got " << m_params.numLevels;
+        NEON_THROW(exc);
+    }
+}
+
+template <typename Grid_ta, typename Real_ta>
+auto GeometricMultigrid<Grid_ta, Real_ta>::params() const -> const MultigridParams&
+{
+    return m_params;
+}
+
+template <typename Grid_ta, typename Real_ta>
+void GeometricMultigrid<Grid_ta, Real_ta>::init(Field& x)
+{
+    // Get the cardinality of x for creating internal fields
+    const int   cardinality = x.getCardinality();
+    const auto& grid = x.getGrid();
+    const auto& bk = grid.getBackend();
+
+    if (m_params.numLevels > GeometricMultigridUtils::maxLevels(grid.getDimension(), bk.devSet().setCardinality())) {
+        NeonException exc("GeometricMultigrid");
+        exc << "The grid " << grid.getDimension() << " on " << bk.devSet().setCardinality()
+            << " partitions is too small for " << m_params.numLevels << " levels";
+        NEON_THROW(exc);
+    }
+
+    m_grids.clear();
+    m_u.clear();
+    m_f.clear();
+    m_bd.clear();
+    m_mask.clear();
+    m_res.clear();
+    // Fields keep a pointer to their grid: the grids must not move once their fields are created
+    m_grids.reserve(m_params.numLevels - 1);
+    Neon::index_3d dim = grid.getDimension();
+    for (int l = 1; l < m_params.numLevels; ++l) {
+        dim = GeometricMultigridUtils::coarsen(dim);
+        m_grids.emplace_back(bk, dim, [](const Neon::index_3d&) { return true; }, Neon::domain::Stencil::s7_Laplace_t());
+
+        const grid_t& fine = (l == 1) ? grid : m_grids[l - 2];
+        if (!GeometricMultigridUtils::isAligned(fine, m_grids.back())) {
+            NeonException exc("GeometricMultigrid");
+            exc << "The partitions of level " << l << " do not match the ones of level " << l - 1
+                << ", use 2^k + 1 cells along z on a power of two number of partitions";
+            NEON_THROW(exc);
+        }
+
+        auto& coarse = m_grids.back();
+        m_u.push_back(coarse.template newField<Real_ta>("mg_u" + std::to_string(l), cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE));
+        m_f.push_back(coarse.template newField<Real_ta>("mg_f" + std::to_string(l), cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE));
+        m_bd.push_back(coarse.template newField<int8_t>("mg_bd" + std::to_string(l), cardinality, int8_t(0), Neon::DataUse::HOST_DEVICE));
+    }
+    for (int l = 0; l < m_params.numLevels; ++l) {
+        const grid_t& level = (l == 0) ? grid : m_grids[l - 1];
+        m_mask.push_back(level.template newField<int8_t>("mg_mask" + std::to_string(l), cardinality, int8_t(0), Neon::DataUse::HOST_DEVICE));
+        m_res.push_back(level.template newField<Real_ta>("mg_res" + std::to_string(l), cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE));
+    }
+}
+
+template <typename Grid_ta, typename Real_ta>
+void GeometricMultigrid<Grid_ta, Real_ta>::setup(const BdField& bd)
+{
+    auto& bk = bd.getBackend();
+
+    std::vector<Neon::set::Container> ops;
+    ops.push_back(mgInitMask<Grid_ta>(bd, m_mask[0]));
+    for (int l = 1; l < m_params.numLevels; ++l) {
+        const BdField& bdFine = (l == 1) ? bd : m_bd[l - 2];
+        ops.push_back(mgCoarsen<Grid_ta>(bdFine, m_mask[l - 1], m_bd[l - 1], m_mask[l]));
+    }
+
+    Neon::skeleton::Skeleton skeleton(bk);
+    skeleton.sequence(ops, "GeometricMultigrid::setup");
+    skeleton.run();
+    bk.sync();
+}
+
+template <typename Grid_ta, typename Real_ta>
+auto GeometricMultigrid<Grid_ta, Real_ta>::h_smooth(Field&                             u,
+                                                    const Field&                       f,
+                                                    const BdField&                     bd,
+                                                    int                                level,
+                                                    int                                sweeps,
+                                                    std::vector<Neon::set::Container>& ops) -> void
+{
+    const Real_ta omega = static_cast<Real_ta>(m_params.jacobiWeight);
+    for (int k = 0; k < sweeps; ++k) {
+        // res := omega D^-1 (f - A u)
+        // u := u + res
+        ops.push_back(mgResidual<Grid_ta, Real_ta>(u, f, bd, m_mask[level], m_res[level], level, m_h, omega));
+        ops.push_back(mgAdd<Grid_ta, Real_ta>(u, m_res[level], bd));
+    }
+}
+
+template <typename Grid_ta, typename Real_ta>
+std::vector<Neon::set::Container> GeometricMultigrid<Grid_ta, Real_ta>::apply(const Field& r, const BdField& bd, Field& z)
+{
+    const int numLevels = m_params.numLevels;
+
+    // Level 0 works directly on the input and output fields
+    auto u = [&](int l) -> Field& { return l == 0 ? z : m_u[l - 1]; };
+    auto f = [&](int l) -> const Field& { return l == 0 ? r : m_f[l - 1]; };
+    auto b = [&](int l) -> const BdField& { return l == 0 ? bd : m_bd[l - 1]; };
+
+    std::vector<Neon::set::Container> ops;
+
+    // Zero initial guess on all levels
+    for (int l = 0; l < numLevels; ++l) {
+        ops.push_back(set<Grid_ta, Real_ta>(u(l), Real_ta(0.0)));
+    }
+
+    // Down-stroke: smooth, compute the residual and restrict it as the right hand side of the next level
+    for (int l = 0; l < numLevels - 1; ++l) {
+        h_smooth(u(l), f(l), b(l), l, m_params.preSmooth, ops);
+        ops.push_back(mgResidual<Grid_ta, Real_ta>(u(l), f(l), b(l), m_mask[l], m_res[l], l, m_h, Real_ta(0.0)));
+        ops.push_back(mgRestrict<Grid_ta, Real_ta>(m_res[l], b(l + 1), m_f[l]));
+    }
+
+    // Coarse solve
+    h_smooth(u(numLevels - 1), f(numLevels - 1), b(numLevels - 1), numLevels - 1, m_params.coarseSweeps, ops);
+
+    // Up-stroke: prolongate the correction of the coarser level and smooth
+    for (int l = numLevels - 2; l >= 0; --l) {
+        ops.push_back(mgProlongate<Grid_ta, Real_ta>(u(l + 1), b(l), u(l)));
+        h_smooth(u(l), f(l), b(l), l, m_params.postSmooth, ops);
+    }
+
+    return ops;
+}
+
+template class GeometricMultigrid<Neon::dGrid, double>;
+template class GeometricMultigrid<Neon::dGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
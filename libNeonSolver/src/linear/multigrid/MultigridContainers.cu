@@ -0,0 +1,330 @@
+#include "Neon/core/types/DataView.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/set/container/Loader.h"
+#include "Neon/solver/linear/IterativeLinearSolver.h"
+#include "Neon/solver/linear/multigrid/MultigridContainers.h"
+
+namespace Neon::solver {
+
+namespace {
+
+/**
+ * Bit of the mask associated to a direction
+ */
+NEON_CUDA_HOST_DEVICE inline auto mgBit(int axis, int sign) -> int8_t
+{
+    return static_cast<int8_t>(1 << (2 * axis + (sign > 0 ? 0 : 1)));
+}
+
+/**
+ * Offset of the direct neighbour along an axis (0: x, 1: y, 2: z), in the positive (sign > 0) or negative direction
+ */
+NEON_CUDA_HOST_DEVICE inline auto mgOffset(int axis, int sign) -> Neon::index_3d
+{
+    return Neon::index_3d(axis == 0 ? sign : 0,
+                          axis == 1 ? sign : 0,
+                          axis == 2 ? sign : 0);
+}
+
+/**
+ * Whether a global index lies in a grid of the given dimension
+ */
+NEON_CUDA_HOST_DEVICE inline auto mgInside(const Neon::index_3d& g, const Neon::index_3d& dim) -> bool
+{
+    return g.x >= 0 && g.y >= 0 && g.z >= 0 &&
+           g.x < dim.x && g.y < dim.y && g.z < dim.z;
+}
+
+/**
+ * Value of the direct neighbour along an axis
+ */
+template <typename Partition, typename Idx>
+NEON_CUDA_HOST_DEVICE inline auto mgNgh(const Partition& f, const Idx& cell, int axis, int sign, int card)
+{
+    const Neon::index_3d       offset = mgOffset(axis, sign);
+    typename Partition::NghIdx ngh(static_cast<int8_t>(offset.x),
+                                   static_cast<int8_t>(offset.y),
+                                   static_cast<int8_t>(offset.z));
+    return f.getNghData(cell, ngh, card);
+}
+
+/**
+ * Index in a partition of the cell with the given global index.
+ * It is used to read the field of another level, the cell may be in the halo of the partition.
+ */
+template <typename Partition>
+NEON_CUDA_HOST_DEVICE inline auto mgLocal(const Partition& f, const Neon::index_3d& g) -> typename Partition::Idx
+{
+    return typename Partition::Idx(g - f.origin() + f.halo());
+}
+
+}  // namespace
+
+template <typename Grid>
+auto mgInitMask(const typename Grid::template Field<int8_t, 0>& bd,
+                typename Grid::template Field<int8_t, 0>&       mask) -> Neon::set::Container
+{
+    auto container = mask.getGrid().newContainer("MG_InitMask", [&](Neon::set::Loader& loader) {
+        const auto& in_bd = loader.load(bd, Neon::Pattern::STENCIL);
+        auto&       out_mask = loader.load(mask);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<int8_t>::Idx& cell) mutable {
+            for (int c = 0; c < out_mask.cardinality(); ++c) {
+                int8_t bits = 0;
+                for (int axis = 0; axis < 3; ++axis) {
+                    for (int sign = -1; sign <= 1; sign += 2) {
+                        auto ngh = mgNgh(in_bd, cell, axis, sign, c);
+                        if (ngh.isValid() && ngh.getData() == BoundaryCondition::Fixed) {
+                            bits |= mgBit(axis, sign);
+                        }
+                    }
+                }
+                out_mask(cell, c) = bits;
+            }
+        };
+    });
+    return container;
+}
+
+template <typename Grid>
+auto mgCoarsen(const typename Grid::template Field<int8_t, 0>& bdFine,
+               const typename Grid::template Field<int8_t, 0>& maskFine,
+               typename Grid::template Field<int8_t, 0>&       bdCoarse,
+               typename Grid::template Field<int8_t, 0>&       maskCoarse) -> Neon::set::Container
+{
+    auto container = bdCoarse.getGrid().newContainer("MG_Coarsen", [&](Neon::set::Loader& loader) {
+        const auto& in_bd = loader.load(bdFine, Neon::Pattern::STENCIL);
+        const auto& in_mask = loader.load(maskFine, Neon::Pattern::STENCIL);
+        auto&       out_bd = loader.load(bdCoarse);
+        auto&       out_mask = loader.load(maskCoarse);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<int8_t>::Idx& cell) mutable {
+            const Neon::index_3d fine = out_bd.getGlobalIndex(cell) * 2;
+            const Neon::index_3d fineDim = in_bd.getDomainSize();
+            const auto           fineCell = mgLocal(in_bd, fine);
+
+            for (int c = 0; c < out_mask.cardinality(); ++c) {
+                const int8_t fineBits = in_mask(fineCell, c);
+                int8_t       bits = 0;
+                for (int axis = 0; axis < 3; ++axis) {
+                    for (int sign = -1; sign <= 1; sign += 2) {
+                        // The path to the coarse neighbour is made of two paths of the finer level,
+                        // the one from the cell and the one from the cell half way
+                        bool                 blocked = (fineBits & mgBit(axis, sign)) != 0;
+                        const Neon::index_3d half = fine + mgOffset(axis, sign);
+                        if (mgInside(half, fineDim)) {
+                            const auto halfCell = mgLocal(in_bd, half);
+                            blocked = blocked ||
+                                      in_bd(halfCell, c) == BoundaryCondition::Fixed ||
+                                      (in_mask(halfCell, c) & mgBit(axis, sign)) != 0;
+                        }
+                        if (blocked) {
+                            bits |= mgBit(axis, sign);
+                        }
+                    }
+                }
+                out_bd(cell, c) = in_bd(fineCell, c);
+                out_mask(cell, c) = bits;
+            }
+        };
+    });
+    return container;
+}
+
+template <typename Grid, typename Real>
+auto mgResidual(const typename Grid::template Field<Real, 0>&   u,
+                const typename Grid::template Field<Real, 0>&   f,
+                const typename Grid::template Field<int8_t, 0>& bd,
+                const typename Grid::template Field<int8_t, 0>& mask,
+                typename Grid::template Field<Real, 0>&         res,
+                int                                             level,
+                Real                                            h,
+                Real                                            omega) -> Neon::set::Container
+{
+    auto container = res.getGrid().newContainer("MG_Residual", [&, level, h, omega](Neon::set::Loader& loader) {
+        const auto& in_u = loader.load(u, Neon::Pattern::STENCIL);
+        const auto& in_f = loader.load(f);
+        const auto& in_bd = loader.load(bd);
+        const auto& in_mask = loader.load(mask);
+        auto&       out_res = loader.load(res);
+
+        const Real hl = h * static_cast<Real>(1 << level);
+        const Real invh2 = Real(1.0) / (hl * hl);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& cell) mutable {
+            for (int c = 0; c < out_res.cardinality(); ++c) {
+                if (in_bd(cell, c) == BoundaryCondition::Fixed) {
+                    out_res(cell, c) = 0;
+                    continue;
+                }
+                const int8_t bits = in_mask(cell, c);
+                Real         sum(0.0);
+                int          numNeighb = 0;
+                for (int axis = 0; axis < 3; ++axis) {
+                    for (int sign = -1; sign <= 1; sign += 2) {
+                        if ((bits & mgBit(axis, sign)) != 0) {
+                            // Dirichlet neighbour: the correction there is zero
+                            ++numNeighb;
+                            continue;
+                        }
+                        auto ngh = mgNgh(in_u, cell, axis, sign, c);
+                        if (ngh.isValid()) {
+                            ++numNeighb;
+                            sum += ngh.getData();
+                        }
+                    }
+                }
+                const Real diag = static_cast<Real>(numNeighb) * invh2;
+                const Real r = in_f(cell, c) - (static_cast<Real>(numNeighb) * in_u(cell, c) - sum) * invh2;
+                if (omega > 0) {
+                    out_res(cell, c) = numNeighb > 0 ? omega * r / diag : Real(0);
+                } else {
+                    out_res(cell, c) = r;
+                }
+            }
+        };
+    });
+    return container;
+}
+
+template <typename Grid, typename Real>
+auto mgAdd(typename Grid::template Field<Real, 0>&         u,
+           const typename Grid::template Field<Real, 0>&   e,
+           const typename Grid::template Field<int8_t, 0>& bd) -> Neon::set::Container
+{
+    auto container = u.getGrid().newContainer("MG_Add", [&](Neon::set::Loader& loader) {
+        auto&       out_u = loader.load(u);
+        const auto& in_e = loader.load(e);
+        const auto& in_bd = loader.load(bd);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& cell) mutable {
+            for (int c = 0; c < out_u.cardinality(); ++c) {
+                if (in_bd(cell, c) != BoundaryCondition::Fixed) {
+                    out_u(cell, c) += in_e(cell, c);
+                }
+            }
+        };
+    });
+    return container;
+}
+
+template <typename Grid, typename Real>
+auto mgRestrict(const typename Grid::template Field<Real, 0>&   resFine,
+                const typename Grid::template Field<int8_t, 0>& bdCoarse,
+                typename Grid::template Field<Real, 0>&         fCoarse) -> Neon::set::Container
+{
+    auto container = fCoarse.getGrid().newContainer("MG_Restrict", [&](Neon::set::Loader& loader) {
+        const auto& in_r = loader.load(resFine, Neon::Pattern::STENCIL);
+        const auto& in_bd = loader.load(bdCoarse);
+        auto&       out_f = loader.load(fCoarse);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& cell) mutable {
+            const Neon::index_3d fine = out_f.getGlobalIndex(cell) * 2;
+            const Neon::index_3d fineDim = in_r.getDomainSize();
+
+            // Weights of the fine cells 2c - 1, 2c and 2c + 1 along each axis.
+            // Transpose of the prolongation: a fine cell with a single coarse neighbour gives it all its value
+            Real w[3][3];
+            for (int axis = 0; axis < 3; ++axis) {
+                w[axis][1] = Real(1.0);
+                for (int sign = -1; sign <= 1; sign += 2) {
+                    const bool hasFine = mgInside(fine + mgOffset(axis, sign), fineDim);
+                    const bool hasFar = mgInside(fine + mgOffset(axis, sign) * 2, fineDim);
+                    w[axis][1 + sign] = !hasFine ? Real(0) : (hasFar ? Real(0.5) : Real(1.0));
+                }
+            }
+
+            for (int c = 0; c < out_f.cardinality(); ++c) {
+                if (in_bd(cell, c) == BoundaryCondition::Fixed) {
+                    out_f(cell, c) = 0;
+                    continue;
+                }
+                Real val(0.0);
+                for (int dz = -1; dz <= 1; ++dz) {
+                    for (int dy = -1; dy <= 1; ++dy) {
+                        for (int dx = -1; dx <= 1; ++dx) {
+                            const Real weight = w[0][1 + dx] * w[1][1 + dy] * w[2][1 + dz];
+                            if (weight != Real(0)) {
+                                val += weight * in_r(mgLocal(in_r, fine + Neon::index_3d(dx, dy, dz)), c);
+                            }
+                        }
+                    }
+                }
+                out_f(cell, c) = val / Real(8.0);
+            }
+        };
+    });
+    return container;
+}
+
+template <typename Grid, typename Real>
+auto mgProlongate(const typename Grid::template Field<Real, 0>&   uCoarse,
+                  const typename Grid::template Field<int8_t, 0>& bdFine,
+                  typename Grid::template Field<Real, 0>&         uFine) -> Neon::set::Container
+{
+    auto container = uFine.getGrid().newContainer("MG_Prolongate", [&](Neon::set::Loader& loader) {
+        const auto& in_e = loader.load(uCoarse, Neon::Pattern::STENCIL);
+        const auto& in_bd = loader.load(bdFine);
+        auto&       out_u = loader.load(uFine);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::template Field<Real>::Idx& cell) mutable {
+            const Neon::index_3d g = out_u.getGlobalIndex(cell);
+            const Neon::index_3d coarseDim = in_e.getDomainSize();
+
+            // Coarse cells floor(g / 2) and ceil(g / 2) along each axis, and their weights
+            const int gs[3] = {g.x, g.y, g.z};
+            const int cs[3] = {coarseDim.x, coarseDim.y, coarseDim.z};
+            int       lo[3];
+            Real      w[3][2];
+            for (int axis = 0; axis < 3; ++axis) {
+                lo[axis] = gs[axis] / 2;
+                if (gs[axis] % 2 == 0) {
+                    w[axis][0] = Real(1.0);
+                    w[axis][1] = Real(0);
+                } else if (lo[axis] + 1 < cs[axis]) {
+                    w[axis][0] = Real(0.5);
+                    w[axis][1] = Real(0.5);
+                } else {
+                    w[axis][0] = Real(1.0);
+                    w[axis][1] = Real(0);
+                }
+            }
+
+            for (int c = 0; c < out_u.cardinality(); ++c) {
+                if (in_bd(cell, c) == BoundaryCondition::Fixed) {
+                    continue;
+                }
+                Real val(0.0);
+                for (int iz = 0; iz < 2; ++iz) {
+                    for (int iy = 0; iy < 2; ++iy) {
+                        for (int ix = 0; ix < 2; ++ix) {
+                            const Real weight = w[0][ix] * w[1][iy] * w[2][iz];
+                            if (weight != Real(0)) {
+                                const Neon::index_3d coarse(lo[0] + ix, lo[1] + iy, lo[2] + iz);
+                                val += weight * in_e(mgLocal(in_e, coarse), c);
+                            }
+                        }
+                    }
+                }
+                out_u(cell, c) += val;
+            }
+        };
+    });
+    return container;
+}
+
+
+#define MG_TEMPLATE(GRID, DATA)                                                                                                                                                                                                                                                 \
+    template auto mgResidual<GRID, DATA>(const GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&, const GRID::template Field<int8_t, 0>&, GRID::template Field<DATA, 0>&, int, DATA, DATA)->Neon::set::Container; \
+    template auto mgAdd<GRID, DATA>(GRID::template Field<DATA, 0>&, const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&)->Neon::set::Container;                                                                                                     \
+    template auto mgRestrict<GRID, DATA>(const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&, GRID::template Field<DATA, 0>&)->Neon::set::Container;                                                                                                \
+    template auto mgProlongate<GRID, DATA>(const GRID::template Field<DATA, 0>&, const GRID::template Field<int8_t, 0>&, GRID::template Field<DATA, 0>&)->Neon::set::Container;
+
+MG_TEMPLATE(Neon::dGrid, double);
+MG_TEMPLATE(Neon::dGrid, float);
+#undef MG_TEMPLATE
+
+template auto mgInitMask<Neon::dGrid>(const Neon::dGrid::template Field<int8_t, 0>&, Neon::dGrid::template Field<int8_t, 0>&) -> Neon::set::Container;
+template auto mgCoarsen<Neon::dGrid>(const Neon::dGrid::template Field<int8_t, 0>&, const Neon::dGrid::template Field<int8_t, 0>&, Neon::dGrid::template Field<int8_t, 0>&, Neon::dGrid::template Field<int8_t, 0>&) -> Neon::set::Container;
+
+}  // namespace Neon::solver
@@ -0,0 +1,134 @@
+#include "Neon/solver/linear/multigrid/MultigridSolver.h"
+
+#include "Neon/domain/dGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "Neon/solver/linear/krylov/CGContainers.h"
+#include "Neon/solver/linear/multigrid/MultigridContainers.h"
+
+namespace Neon {
+namespace solver {
+
+template <typename Grid_ta, typename Real_ta>
+void MultigridSolver_t<Grid_ta, Real_ta>::doInit(Field& x)
+{
+    // Get the cardinality of x for creating internal fields
+    const int cardinality = x.getCardinality();
+
+    m_r = x.getGrid().template newField<Real_ta>("r", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_s = x.getGrid().template newField<Real_ta>("s", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+    m_z = x.getGrid().template newField<Real_ta>("z", cardinality, Real_ta(0.), Neon::DataUse::HOST_DEVICE);
+
+    m_multigrid.init(x);
+}
+
+template <typename Grid_ta, typename Real_ta>
+SolverStatus MultigridSolver_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>      A,
+                                                        Field&                         x,
+                                                        Field&                         b,
+                                                        BdField&                       bd,
+                                                        const SolverParams&            params,
+                                                        SolverResultInfo&              result,
+                                                        const Neon::skeleton::Options& opt)
+{
+    // Make sure one time initializations have been done by the user by calling init()
+    if (!this->isInit()) {
+        NeonException exc("MultigridSolver_t::solve");
+        exc << "Attempting to call solve() before calling init()";
+        NEON_THROW(exc);
+    }
+    Neon::Timer_ms timerSolution;
+    Neon::Timer_ms timerTotal;
+
+    // Preparations before the solve loop
+    result.solverName = this->name();
+    timerTotal.start();
+
+    auto& bk = this->h_getBackend(x);
+
+    m_multigrid.setup(bd);
+
+    // r := (bnd == 1) ? b : x
+    // s := Ax
+    // r := r - s
+    // rr := <r,r>
+    auto rr = m_r.getGrid().template newPatternScalar<Real_ta>();
+    auto computeResidual = [&]() -> std::vector<Neon::set::Container> {
+        return {initR<Grid_ta, Real_ta>(m_r, x, b, bd),
+                A->matVec(x, bd, m_s),
+                AXPY<Grid_ta, Real_ta>(m_r, m_s),
+                m_r.getGrid().dot("rTr", m_r, m_r, rr)};
+    };
+
+    // Compute initial residual
+    bk.sync(Neon::Backend::mainStreamIdx);
+    {
+        Neon::skeleton::Skeleton skeleton(bk);
+        skeleton.sequence(computeResidual(), "MG::computeInitResidual");
+        skeleton.run();
+        bk.sync();
+    }
+    result.residualStart = std::sqrt(rr());
+
+    // Store all residuals if requested
+    if (params.needResiduals) {
+        result.residuals.reserve(params.maxIterations);
+        result.residuals.push_back(result.residualStart);
+    }
+
+    // z := V(r) (V-cycle containers)
+    // x := x + z (add container)
+    // r := b - Ax, rr := <r,r> (residual containers)
+    Neon::skeleton::Skeleton          mgIter(bk);
+    std::vector<Neon::set::Container> ops = m_multigrid.apply(m_r, bd, m_z);
+    ops.push_back(mgAdd<Grid_ta, Real_ta>(x, m_z, bd));
+    for (auto& op : computeResidual()) {
+        ops.push_back(op);
+    }
+    mgIter.sequence(ops, result.solverName, opt);
+
+    // Save the multi-GPU graph
+    mgIter.ioToDot(result.solverName +
+                       "_" + Neon::skeleton::OccUtils::toString(opt.occ()) +
+                       "_" + Neon::set::TransferModeUtils::toString(opt.transferMode()),
+                   "");
+
+    bk.syncAll();
+    timerSolution.start();
+
+    // Solve loop
+    size_t       iter = 0;
+    SolverStatus status = SolverStatus::Error;
+    result.residualEnd = result.residualStart;
+
+    for (iter = 0; iter < params.maxIterations; ++iter) {
+        // Stop if converged/diverged/reached maximum iteration
+        status = this->converged(result.residualEnd, result.residualStart, iter, params);
+        if (status == SolverStatus::Converged || status == SolverStatus::Error || status == SolverStatus::IterationLimit) {
+            break;
+        }
+
+        mgIter.run();
+
+        result.residualEnd = std::sqrt(rr());
+
+        // Store residual norms if requested
+        if (params.needResiduals) {
+            result.residuals.push_back(result.residualEnd);
+        }
+    }
+
+    // Post-processing after the solve loop
+    timerSolution.stop();
+    bk.sync();
+    result.numIterations = iter;
+    timerTotal.stop();
+    result.solveTime = timerSolution.time();
+    result.totalTime = timerTotal.time();
+    return status;
+}
+
+template class MultigridSolver_t<Neon::dGrid, double>;
+template class MultigridSolver_t<Neon::dGrid, float>;
+
+}  // namespace solver
+}  // namespace Neon
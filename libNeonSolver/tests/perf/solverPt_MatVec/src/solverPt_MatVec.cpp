@@ -0,0 +1,236 @@
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numeric>
+
+#include "Neon/Neon.h"
+
+#include "Neon/Report.h"
+
+#include "Neon/core/core.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/set/DevSet.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "Neon/solver/linear/matvecs/StencilMatVec.h"
+#include "Poisson.h"
+#include "gtest/gtest.h"
+
+using namespace Neon::set;
+using namespace Neon::solver;
+using namespace Neon::domain;
+
+std::vector<int>        DEVICES;            // GPU device IDs
+int                     DOMAIN_SIZE = 256;  // Number of voxels along each axis
+int                     ITERATIONS = 100;   // Number of operator applications timed per run
+std::string             GRID_TYPE = "dGrid";
+std::string             DATA_TYPE = "double";
+std::string             REPORT_FILENAME = "MatVec";
+int                     TIMES = 1;
+Neon::skeleton::Occ     occE = Neon::skeleton::Occ::none;
+Neon::set::TransferMode transferE = Neon::set::TransferMode::get;
+int                     ARGC;
+char**                  ARGV;
+
+/**
+ * Time ITERATIONS applications of an operator
+ * @return Average time of one application in ms
+ */
+template <typename Grid, typename T>
+double timeMatVec(const Neon::Backend&                          backend,
+                  std::shared_ptr<Neon::solver::MatVec<Grid, T>> A,
+                  const std::string&                             name,
+                  typename Grid::template Field<T, 0>&           u,
+                  typename Grid::template Field<int8_t, 0>&      bd,
+                  typename Grid::template Field<T, 0>&           out)
+{
+    Neon::skeleton::Skeleton skeleton(backend);
+    skeleton.sequence({A->matVec(u, bd, out)}, name, Neon::skeleton::Options(occE, transferE));
+
+    // Warm up
+    skeleton.run();
+    backend.syncAll();
+
+    Neon::Timer_ms timer;
+    timer.start();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        skeleton.run();
+    }
+    backend.syncAll();
+    timer.stop();
+    return timer.time() / ITERATIONS;
+}
+
+/**
+ * Largest absolute difference between two fields, read on the host
+ */
+template <typename Grid, typename T>
+double maxDifference(typename Grid::template Field<T, 0>& a, typename Grid::template Field<T, 0>& b)
+{
+    a.updateHostData(0);
+    b.updateHostData(0);
+    a.getGrid().getBackend().syncAll();
+
+    double diff = 0;
+    a.forEachActiveCell([&](const Neon::index_3d& idx, const int& card, T& val) {
+        diff = std::max(diff, std::abs(double(val) - double(b(idx, card))));
+    });
+    return diff;
+}
+
+template <typename Grid, typename T>
+int matVecPerfTest(const Neon::Backend& backend, Neon::Report& report)
+{
+    // The 27-point stencil is a superset of the others. Its first six points are the faces in the
+    // order of Stencil::s7_Laplace_t(), so on eGrid the 7-point operators keep their neighbor indices.
+    Grid grid = createGrid<Grid>(backend, DOMAIN_SIZE, StencilMatVecUtils::stencil<Laplacian27Stencil>());
+
+    auto u = grid.template newField<T>("u", 1, T(0), DataUse::HOST_DEVICE);
+    auto bd = grid.template newField<int8_t>("bd", 1, int8_t(0), DataUse::HOST_DEVICE);
+    auto kappa = grid.template newField<T>("kappa", 1, T(0), DataUse::HOST_DEVICE);
+    auto outRef = grid.template newField<T>("outRef", 1, T(0), DataUse::HOST_DEVICE);
+    auto out = grid.template newField<T>("out", 1, T(0), DataUse::HOST_DEVICE);
+
+    // A smooth non-trivial input, with the Dirichlet planes of the Poisson problem
+    const Neon::index_3d dims = grid.getDimension();
+    u.forEachActiveCell([](const Neon::index_3d& idx, const int& /*card*/, T& val) {
+        val = T(std::sin(0.1 * idx.x) + std::cos(0.2 * idx.y) + 0.01 * idx.z * idx.z);
+    });
+    bd.forEachActiveCell([dims](const Neon::index_3d& idx, const int& /*card*/, int8_t& val) {
+        val = (idx.z == 0 || idx.z == dims.z - 1) ? BoundaryCondition::Fixed : BoundaryCondition::Free;
+    });
+    kappa.forEachActiveCell([](const Neon::index_3d& /*idx*/, const int& /*card*/, T& val) {
+        val = T(1);
+    });
+    u.updateDeviceData(0);
+    bd.updateDeviceData(0);
+    kappa.updateDeviceData(0);
+
+    const double numCells = double(dims.rMulTyped<size_t>());
+
+    auto run = [&](const std::string& name, std::shared_ptr<MatVec<Grid, T>> A, typename Grid::template Field<T, 0>& output) {
+        std::vector<double> time(TIMES);
+        std::vector<double> mcups(TIMES);
+        for (int t = 0; t < TIMES; ++t) {
+            time[t] = timeMatVec<Grid, T>(backend, A, name, u, bd, output);
+            mcups[t] = numCells / (time[t] * 1e3);
+        }
+        report.addMember(name + "_ms", time);
+        report.addMember(name + "_MCUPS", mcups);
+        std::cout << " " << name << ": " << time[0] << " ms, " << mcups[0] << " MCUPS\n";
+    };
+
+    run("LaplacianMatVec", std::make_shared<LaplacianMatVec<Grid, T>>(T(1)), outRef);
+    run("Laplacian7", std::make_shared<StencilMatVec<Grid, T, Laplacian7Stencil>>(T(1)), out);
+    const double diff7 = maxDifference<Grid, T>(outRef, out);
+    run("VariableCoefficient", std::make_shared<VariableCoefficientMatVec<Grid, T>>(T(1), kappa), out);
+    const double diffVar = maxDifference<Grid, T>(outRef, out);
+    run("Laplacian19", std::make_shared<StencilMatVec<Grid, T, Laplacian19Stencil>>(T(1)), out);
+    run("Laplacian27", std::make_shared<StencilMatVec<Grid, T, Laplacian27Stencil>>(T(1)), out);
+
+    // With k = 1 all the 7-point operators are the same matrix
+    report.addMember("MaxDiff_Laplacian7", diff7);
+    report.addMember("MaxDiff_VariableCoefficient", diffVar);
+    std::cout << " max |Laplacian7 - LaplacianMatVec| = " << diff7 << "\n";
+    std::cout << " max |VariableCoefficient - LaplacianMatVec| = " << diffVar << "\n";
+
+    const double tol = std::is_same_v<T, float> ? 1e-3 : 1e-9;
+    return (diff7 <= tol && diffVar <= tol) ? 0 : -1;
+}
+
+template <typename T>
+int matVecPerfTest()
+{
+    assert(GRID_TYPE == "dGrid" || GRID_TYPE == "eGrid" || GRID_TYPE == "bGrid");
+    assert(DATA_TYPE == "double" || DATA_TYPE == "single");
+
+    if (DEVICES.empty()) {
+        DEVICES.push_back(0);
+    }
+    DevSet        deviceSet(Neon::DeviceType::CUDA, DEVICES);
+    Neon::Backend backend(deviceSet, Neon::Runtime::stream);
+    backend.setAvailableStreamSet(2);
+
+    // Create a report
+    Neon::Report report("MatVec_" + std::string(GRID_TYPE) + "_" + std::to_string(DEVICES.size()) + "GPUs");
+
+    report.commandLine(ARGC, ARGV);
+
+    Neon::index_3d dom(DOMAIN_SIZE, DOMAIN_SIZE, DOMAIN_SIZE);
+
+    report.addMember("iterations", ITERATIONS);
+    report.addMember("voxelDomain", dom.to_stringForComposedNames());
+    report.addMember("numGPUs", DEVICES.size());
+    report.addMember("gridType", GRID_TYPE);
+    report.addMember("dataType", DATA_TYPE);
+    report.addMember("skeletonOCC", Neon::skeleton::OccUtils::toString(occE));
+    report.addMember("skeletonTransferMode", Neon::set::TransferModeUtils::toString(transferE));
+
+    int status = -1;
+    if (GRID_TYPE == "eGrid") {
+        status = matVecPerfTest<eGrid, T>(backend, report);
+    } else if (GRID_TYPE == "dGrid") {
+        status = matVecPerfTest<dGrid, T>(backend, report);
+    } else if (GRID_TYPE == "bGrid") {
+        status = matVecPerfTest<bGrid, T>(backend, report);
+    }
+
+    std::stringstream stringstream;
+    stringstream << "Saving report file here: " << REPORT_FILENAME << std::endl;
+    NEON_INFO(stringstream.str());
+
+    report.write(REPORT_FILENAME);
+    return status;
+}
+
+int main(int argc, char** argv)
+{
+    ARGC = argc;
+    ARGV = argv;
+
+    Neon::init();
+
+    // CLI for benchmarks test
+    auto cli =
+        (clipp::option("--gpus") & clipp::integers("gpus", DEVICES) % "GPU ids to use",
+         clipp::option("--grid") & clipp::value("grid", GRID_TYPE) % "Could be eGrid, dGrid, or bGrid",
+         clipp::option("--data_type") & clipp::value("data_type", DATA_TYPE) % "Could be single or double",
+         clipp::option("--domain_size") & clipp::integer("domain_size", DOMAIN_SIZE) % "Voxels along each dimension of the cube domain",
+         clipp::option("--iterations") & clipp::integer("iterations", ITERATIONS) % "Operator applications timed per run",
+         clipp::option("--report_filename ") & clipp::value("report_filename", REPORT_FILENAME) % "Output report filename",
+         clipp::option("--times ") & clipp::integer("times", TIMES) % "Times to run the experiment",
+         ((clipp::option("--sOCC ").set(occE, Neon::skeleton::Occ::standard) % "Standard OCC") |
+          (clipp::option("--nOCC ").set(occE, Neon::skeleton::Occ::none) % "No OCC (on by default)") |
+          (clipp::option("--eOCC ").set(occE, Neon::skeleton::Occ::extended) % "Extended OCC") |
+          (clipp::option("--e2OCC ").set(occE, Neon::skeleton::Occ::twoWayExtended) % "Two-way Extended OCC")),
+         ((clipp::option("--put ").set(transferE, Neon::set::TransferMode::put) % "Set transfer mode to GET") |
+          (clipp::option("--get ").set(transferE, Neon::set::TransferMode::get) % "Set transfer mode to PUT (on by default)")));
+
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        return -1;
+    }
+    std::cout << " #gpus= " << (DEVICES.empty() ? 1 : DEVICES.size()) << "\n";
+    std::cout << " grid= " << GRID_TYPE << "\n";
+    std::cout << " data_type= " << DATA_TYPE << "\n";
+    std::cout << " domain_size= " << DOMAIN_SIZE << "\n";
+    std::cout << " iterations= " << ITERATIONS << "\n";
+    std::cout << " times= " << TIMES << "\n";
+    std::cout << " OCC= " << Neon::skeleton::OccUtils::toString(occE) << "\n";
+    std::cout << " transfer= " << Neon::set::TransferModeUtils::toString(transferE) << "\n";
+
+    if (Neon::sys::globalSpace::gpuSysObjStorage.numDevs() > 0) {
+        if (DATA_TYPE == "single") {
+            return matVecPerfTest<float>();
+        } else if (DATA_TYPE == "double") {
+            return matVecPerfTest<double>();
+        } else {
+            return -1;
+        }
+    } else {
+        return 0;
+    }
+}
@@ -26,6 +26,8 @@ double                       TOL = 1e-10;        // Absolute tolerance for use i
 int                          CARDINALITY = 1;
 std::string                  GRID_TYPE = "dGrid";
 std::string                  DATA_TYPE = "double";
+std::string                  SOLVER = "CG";
+size_t                       CHECK_EVERY = 1;    // Iterations between two convergence checks
 std::string                  REPORT_FILENAME = "Poisson";
 int                          TIMES = 1;
 Neon::skeleton::Occ occE = Neon::skeleton::Occ::none;
@@ -65,6 +67,8 @@ int poissonPerfTestScalability()
     report.addMember("absTol", TOL);
     report.addMember("gridType", GRID_TYPE);
     report.addMember("dataType", DATA_TYPE);
+    report.addMember("solver", SOLVER);
+    report.addMember("checkEvery", CHECK_EVERY);
     report.addMember("skeletonOCC", Neon::skeleton::OccUtils::toString(occE));
     report.addMember("skeletonTransferMode", Neon::set::TransferModeUtils::toString(transferE));
 
@@ -82,21 +86,21 @@ int poissonPerfTestScalability()
             std::array<T, 1> bdZMin{ZMIN};
             std::array<T, 1> bdZMax{ZMAX};
             if (GRID_TYPE == "eGrid") {
-                std::tie(result, status) = testPoissonContainers<eGrid, T, 1>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE);
+                std::tie(result, status) = testPoissonContainers<eGrid, T, 1>(backend, SOLVER, DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE, CHECK_EVERY);
             } else if (GRID_TYPE == "dGrid") {
-                std::tie(result, status) = testPoissonContainers<dGrid, T, 1>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE);
+                std::tie(result, status) = testPoissonContainers<dGrid, T, 1>(backend, SOLVER, DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE, CHECK_EVERY);
             } else if (GRID_TYPE == "bGrid") {
-                std::tie(result, status) = testPoissonContainers<bGrid, T, 1>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE);
+                std::tie(result, status) = testPoissonContainers<bGrid, T, 1>(backend, SOLVER, DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE, CHECK_EVERY);
             }
         } else if (CARDINALITY == 3) {
             std::array<T, 3> bdZMin{0, ZMIN, 0};
             std::array<T, 3> bdZMax{0, 0, ZMAX};
             if (GRID_TYPE == "eGrid") {
-                std::tie(result, status) = testPoissonContainers<eGrid, T, 3>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE);
+                std::tie(result, status) = testPoissonContainers<eGrid, T, 3>(backend, SOLVER, DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE, CHECK_EVERY);
             } else if (GRID_TYPE == "dGrid") {
-                std::tie(result, status) = testPoissonContainers<dGrid, T, 3>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE);
+                std::tie(result, status) = testPoissonContainers<dGrid, T, 3>(backend, SOLVER, DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE, CHECK_EVERY);
             } else if (GRID_TYPE == "bGrid") {
-                std::tie(result, status) = testPoissonContainers<bGrid, T, 3>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE);
+                std::tie(result, status) = testPoissonContainers<bGrid, T, 3>(backend, SOLVER, DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITER, static_cast<T>(TOL), occE, transferE, CHECK_EVERY);
             }
         }
 
@@ -133,10 +137,12 @@ int main(int argc, char** argv)
         (clipp::option("--gpus") & clipp::integers("gpus", DEVICES) % "GPU ids to use",
          clipp::option("--grid") & clipp::value("grid", GRID_TYPE) % "Could be eGrid, dGrid, or bGrid",
          clipp::option("--data_type") & clipp::value("data_type", DATA_TYPE) % "Could be single or double",
+         clipp::option("--solver") & clipp::value("solver", SOLVER) % "Could be CG, PipelinedCG, BiCGStab, GMRES, PCG or MG",
          clipp::option("--cardinality") & clipp::value("cardinality", CARDINALITY) % "Must be 1 or 3",
          clipp::option("--domain_size") & clipp::integer("domain_size", DOMAIN_SIZE) % "Voxels along each dimension of the cube domain",
          clipp::option("--max_iter") & clipp::integer("max_iter", MAX_ITER) % "Maximum solver iterations",
          clipp::option("--tol") & clipp::number("tol", TOL) % "Absolute tolerance for convergence",
+         clipp::option("--check_every") & clipp::integer("check_every", CHECK_EVERY) % "Iterations run between two convergence checks",
          clipp::option("--report_filename ") & clipp::value("report_filename", REPORT_FILENAME) % "Output report filename",
          clipp::option("--times ") & clipp::integer("times", TIMES) % "Times to run the experiment",
          ((clipp::option("--sOCC ").set(occE, Neon::skeleton::Occ::standard) % "Standard OCC") |
@@ -155,10 +161,12 @@ int main(int argc, char** argv)
     std::cout << " #gpus= " << (DEVICES.empty() ? 1 : DEVICES.size()) << "\n";
     std::cout << " grid= " << GRID_TYPE << "\n";
     std::cout << " data_type= " << DATA_TYPE << "\n";
+    std::cout << " solver= " << SOLVER << "\n";
     std::cout << " cardinality= " << CARDINALITY << "\n";
     std::cout << " domain_size= " << DOMAIN_SIZE << "\n";
     std::cout << " max_iter= " << MAX_ITER << "\n";
     std::cout << " tol= " << TOL << "\n";
+    std::cout << " check_every= " << CHECK_EVERY << "\n";
     std::cout << " times= " << TIMES << "\n";
     std::cout << " OCC= " << Neon::skeleton::OccUtils::toString(occE) << "\n";
     std::cout << " transfer= " << Neon::set::TransferModeUtils::toString(transferE) << "\n";
@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "Neon/core/core.h"
@@ -12,8 +13,15 @@
 #include "Neon/domain/bGrid.h"
 #include "Neon/set/DevSet.h"
 #include "Neon/solver/linear/IterativeLinearSolver.h"
+#include "Neon/solver/linear/krylov/BiCGStab.h"
 #include "Neon/solver/linear/krylov/CG.h"
+#include "Neon/solver/linear/krylov/GMRES.h"
+#include "Neon/solver/linear/krylov/PCG.h"
+#include "Neon/solver/linear/krylov/PipelinedCG.h"
+#include "Neon/solver/linear/matvecs/AdvectionDiffusionMatVec.h"
 #include "Neon/solver/linear/matvecs/LaplacianMatVec.h"
+#include "Neon/solver/linear/multigrid/GeometricMultigrid.h"
+#include "Neon/solver/linear/multigrid/MultigridSolver.h"
 
 // Alias for pointer to base solver
 template <typename Grid, typename Real>
@@ -63,12 +71,11 @@ void setupPoissonProblem(const Grid&                               grid,
         val = 0.0;
     });
 
-    // Move data to GPU if using CUDA backend
-    if (grid.getBackend().devType() == DeviceType::CUDA) {
-        u.updateDeviceData(0);
-        rhs.updateDeviceData(0);
-        bd.updateDeviceData(0);
-    }
+    // The containers read the device copies of the fields
+    u.updateDeviceData(0);
+    rhs.updateDeviceData(0);
+    bd.updateDeviceData(0);
+    grid.getBackend().sync(0);
 }
 
 /**
@@ -76,15 +83,42 @@ void setupPoissonProblem(const Grid&                               grid,
  * @tparam Grid Type of the grid
  * @tparam Real Real number type (float or double)
  * @param[in] name Name of the solver
- * @param[in] grid Grid where the solver is run
+ * @param[in] mgParams Parameters of the multigrid V-cycle used by 'PCG' and 'MG'
+ * @param[in] restart Restart length of 'GMRES'
  */
 template <typename Grid, typename Real>
-SolverPtr<Grid, Real> createSolver(std::string name)
+SolverPtr<Grid, Real> createSolver(std::string name, const Neon::solver::MultigridParams& mgParams = Neon::solver::MultigridParams(), int restart = 30)
 {
     if (name == "CG") {
         return std::make_shared<Neon::solver::CG_t<Grid, Real>>();
     }
-    throw std::runtime_error("Unknown solver name. Expected one of: 'CG', ");
+    if (name == "PipelinedCG") {
+        return std::make_shared<Neon::solver::PipelinedCG_t<Grid, Real>>();
+    }
+    if (name == "BiCGStab") {
+        return std::make_shared<Neon::solver::BiCGStab_t<Grid, Real>>();
+    }
+    if (name == "GMRES") {
+        return std::make_shared<Neon::solver::GMRES_t<Grid, Real>>(restart);
+    }
+    if constexpr (std::is_same_v<Grid, Neon::dGrid>) {
+        if (name == "PCG") {
+            auto multigrid = std::make_shared<Neon::solver::GeometricMultigrid<Grid, Real>>(Real(1.0), mgParams);
+            return std::make_shared<Neon::solver::PCG_t<Grid, Real>>(multigrid);
+        }
+        if (name == "MG") {
+            return std::make_shared<Neon::solver::MultigridSolver_t<Grid, Real>>(Real(1.0), mgParams);
+        }
+    }
+    throw std::runtime_error("Unknown solver name. Expected one of: 'CG', 'PipelinedCG', 'BiCGStab', 'GMRES', 'PCG', 'MG' ('PCG' and 'MG' are only available on dGrid)");
+}
+
+/**
+ * Whether a solver runs a multigrid V-cycle
+ */
+inline bool usesMultigrid(const std::string& name)
+{
+    return name == "PCG" || name == "MG";
 }
 
 /**
@@ -92,24 +126,52 @@ SolverPtr<Grid, Real> createSolver(std::string name)
  * @tparam Grid Type of the grid
  * @param[in] domainSize Size of the grid
  * @param[in] deviceSet Devices across which the grid will span
+ * @param[in] stencil Stencil of the grid
  */
 template <typename Grid>
-Grid createGrid(const Neon::Backend& /*backend*/, int /*domainSize*/)
+Grid createGrid(const Neon::Backend& /*backend*/, int /*domainSize*/, const Neon::domain::Stencil& /*stencil*/ = Neon::domain::Stencil::s7_Laplace_t())
 {
     throw std::invalid_argument("Unsupported grid type. Expected Grid to be one of (eGrid_t, ...)");
 }
 
 // Specialization for eGrid_t
 template <>
-inline Neon::domain::details::eGrid::eGrid createGrid<Neon::domain::details::eGrid::eGrid>(const Neon::Backend& backend, int domainSize);
+Neon::domain::details::eGrid::eGrid createGrid<Neon::domain::details::eGrid::eGrid>(const Neon::Backend& backend, int domainSize, const Neon::domain::Stencil& stencil);
 
 // Specialization for dGrid_t
 template <>
-inline Neon::dGrid createGrid<Neon::dGrid>(const Neon::Backend& backend, int domainSize);
+Neon::dGrid createGrid<Neon::dGrid>(const Neon::Backend& backend, int domainSize, const Neon::domain::Stencil& stencil);
 
 // Specialization for bGrid_t
 template <>
-inline Neon::domain::bGrid createGrid<Neon::domain::bGrid>(const Neon::Backend& backend, int domainSize);
+Neon::bGrid createGrid<Neon::bGrid>(const Neon::Backend& backend, int domainSize, const Neon::domain::Stencil& stencil);
+
+/**
+ * Print the status and the statistics of a solve
+ */
+inline void printSolverResult(const Neon::solver::SolverResultInfo& result, Neon::solver::SolverStatus status)
+{
+    using Neon::solver::SolverStatus;
+    switch (status) {
+        case SolverStatus::Converged:
+            printf("SolverStatus is Converged\n");
+            break;
+        case SolverStatus::IterationLimit:
+            printf("SolverStatus is IterationLimit\n");
+            break;
+        case SolverStatus::Error:
+            printf("SolverStatus is Error\n");
+            break;
+        case SolverStatus::Iterating:
+            printf("SolverStatus is Iterating\n");
+            break;
+        case SolverStatus::NumericalIssue:
+            printf("SolverStatus is NumericalIssue\n");
+            break;
+    }
+    printf("Start residual: %.11f\nEnd residual: %.11f\nIterations: %zd\nSolve time: %.11f ms\nTotal time: %.11f ms\n",
+           result.residualStart, result.residualEnd, result.numIterations, result.solveTime, result.totalTime);
+}
 
 /**
  * Solve the poisson problem
@@ -125,6 +187,7 @@ inline Neon::domain::bGrid createGrid<Neon::domain::bGrid>(const Neon::Backend&
  * @param[in] bdZmax Dirichlet boundary value at z = domainSize - 1 of the grid
  * @param[in] maxIterations Maximum iterations for solver
  * @param[in] tolerance Tolerance for convergence check
+ * @param[in] checkEvery Number of iterations between two convergence checks
  */
 template <typename Grid, typename Real, int Cardinality>
 auto testPoissonContainers(const Neon::Backend&           backend,
@@ -135,7 +198,8 @@ auto testPoissonContainers(const Neon::Backend&           backend,
                            size_t                         maxIterations,
                            Real                           tolerance,
                            Neon::skeleton::Occ occE,
-                           Neon::set::TransferMode transferE)
+                           Neon::set::TransferMode transferE,
+                           size_t                         checkEvery = 1)
     -> std::pair<Neon::solver::SolverResultInfo, Neon::solver::SolverStatus>
 {
     using namespace Neon;
@@ -143,6 +207,9 @@ auto testPoissonContainers(const Neon::Backend&           backend,
     using namespace Neon::solver;
 
     // Setup problem
+    MultigridParams mgParams;
+    mgParams.numLevels = GeometricMultigridUtils::maxLevels(Neon::index_3d(domainSize, domainSize, domainSize),
+                                                            backend.devSet().setCardinality());
     Grid grid = createGrid<Grid>(backend, domainSize);
 
     auto u = grid.template newField<Real>("u", Cardinality, Real(0), DataUse::HOST_DEVICE);
@@ -155,36 +222,83 @@ auto testPoissonContainers(const Neon::Backend&           backend,
     auto L = std::make_shared<Neon::solver::LaplacianMatVec<Grid, Real>>(Real(1.0));
 
     // Create solver and solve problem
-    auto solverBase = createSolver<Grid, Real>(solverName);
-    auto solver = std::dynamic_pointer_cast<CG_t<Grid, Real>>(solverBase);
+    auto solver = createSolver<Grid, Real>(solverName, mgParams);
     solver->init(u);
     SolverParams params;
     params.maxIterations = maxIterations;
     params.toleranceAbs = tolerance;
     params.toleranceRel = 0.0;
+    params.checkEvery = checkEvery;
     SolverResultInfo result;
     NEON_INFO(std::string("Backend") + backend.toString());
     const Neon::skeleton::Options   skeletonOpt(occE, transferE);
     SolverStatus                    status = solver->solve(L, u, rhs, bd, params, result, skeletonOpt);
-    switch (status) {
-        case SolverStatus::Converged:
-            printf("SolverStatus is Converged\n");
-            break;
-        case SolverStatus::IterationLimit:
-            printf("SolverStatus is IterationLimit\n");
-            break;
-        case SolverStatus::Error:
-            printf("SolverStatus is Error\n");
-            break;
-        case SolverStatus::Iterating:
-            printf("SolverStatus is Iterating\n");
-            break;
-        case SolverStatus::NumericalIssue:
-            printf("SolverStatus is NumericalIssue\n");
-            break;
+    printSolverResult(result, status);
+    return {result, status};
+}
+
+/**
+ * Solve the advection-diffusion problem -Laplacian(u) + a . grad(u) = 0 with the boundary conditions of the Poisson problem
+ * and the velocity a = (velocity, 0, 0). The operator is non-symmetric: use 'BiCGStab' or 'GMRES'.
+ * @tparam Grid Type of the grid
+ * @tparam Real Type of data in the fields
+ * @tparam Cardinality Cardinality of elements in the fields
+ * @param[in] backend Backend to use
+ * @param[in] solverName Name of the solver
+ * @param[in] domainSize Size of the grid domain
+ * @param[in] bdZmin Dirichlet boundary value at z = 0 of the grid
+ * @param[in] bdZmax Dirichlet boundary value at z = domainSize - 1 of the grid
+ * @param[in] velocity Advection velocity along x
+ * @param[in] maxIterations Maximum iterations for solver
+ * @param[in] tolerance Tolerance for convergence check
+ * @param[in] restart Restart length of 'GMRES'
+ */
+template <typename Grid, typename Real, int Cardinality>
+auto testAdvectionDiffusionContainers(const Neon::Backend&          backend,
+                                      const std::string&            solverName,
+                                      int                           domainSize,
+                                      std::array<Real, Cardinality> bdZmin,
+                                      std::array<Real, Cardinality> bdZmax,
+                                      Real                          velocity,
+                                      size_t                        maxIterations,
+                                      Real                          tolerance,
+                                      Neon::skeleton::Occ           occE,
+                                      Neon::set::TransferMode       transferE,
+                                      int                           restart = 30)
+    -> std::pair<Neon::solver::SolverResultInfo, Neon::solver::SolverStatus>
+{
+    using namespace Neon;
+    using namespace Neon::set;
+    using namespace Neon::solver;
+
+    if (usesMultigrid(solverName)) {
+        throw std::invalid_argument("The multigrid V-cycle is built for the Laplacian, it does not apply to the advection-diffusion operator");
     }
-    printf("Start residual: %.11f\nEnd residual: %.11f\nIterations: %zd\nSolve time: %.11f ms\nTotal time: %.11f ms\n",
-           result.residualStart, result.residualEnd, result.numIterations, result.solveTime, result.totalTime);
+
+    // Setup problem
+    Grid grid = createGrid<Grid>(backend, domainSize);
+
+    auto u = grid.template newField<Real>("u", Cardinality, Real(0), DataUse::HOST_DEVICE);
+    auto rhs = grid.template newField<Real>("rhs", Cardinality, Real(0), DataUse::HOST_DEVICE);
+    auto bd = grid.template newField<int8_t>("bd", Cardinality, int8_t(0), DataUse::HOST_DEVICE);
+
+    setupPoissonProblem<Grid, Real, Cardinality>(grid, u, rhs, bd, bdZmin, bdZmax);
+
+    // Advection-diffusion matvec operation
+    auto A = std::make_shared<Neon::solver::AdvectionDiffusionMatVec<Grid, Real>>(Real(1.0), Real(1.0), std::array<Real, 3>{velocity, Real(0), Real(0)});
+
+    // Create solver and solve problem
+    auto solver = createSolver<Grid, Real>(solverName, MultigridParams(), restart);
+    solver->init(u);
+    SolverParams params;
+    params.maxIterations = maxIterations;
+    params.toleranceAbs = tolerance;
+    params.toleranceRel = 0.0;
+    SolverResultInfo result;
+    NEON_INFO(std::string("Backend") + backend.toString());
+    const Neon::skeleton::Options skeletonOpt(occE, transferE);
+    SolverStatus                  status = solver->solve(A, u, rhs, bd, params, result, skeletonOpt);
+    printSolverResult(result, status);
     return {result, status};
 }
 
@@ -195,20 +309,40 @@ auto testPoissonContainers(const Neon::Backend&           backend,
                                             int domainSize, std::array<REAL, CARD> bdZmin, \
                                             std::array<REAL, CARD> bdZmax,                 \
                                             size_t maxIterations, REAL tolerance,          \
-                                            Neon::skeleton::Occ occE, Neon::set::TransferMode transferE);
+                                            Neon::skeleton::Occ occE, Neon::set::TransferMode transferE, \
+                                            size_t checkEvery);
 
 EXTERN_TEMPLATE_INST(Neon::dGrid, double, 1)
 EXTERN_TEMPLATE_INST(Neon::dGrid, double, 3)
-EXTERN_TEMPLATE_INST(Neon::domain::bGrid, double, 1)
-EXTERN_TEMPLATE_INST(Neon::domain::bGrid, double, 3)
-EXTERN_TEMPLATE_INST(Neon::domain::eGrid, double, 1)
-EXTERN_TEMPLATE_INST(Neon::domain::eGrid, double, 3)
+EXTERN_TEMPLATE_INST(Neon::bGrid, double, 1)
+EXTERN_TEMPLATE_INST(Neon::bGrid, double, 3)
+EXTERN_TEMPLATE_INST(Neon::eGrid, double, 1)
+EXTERN_TEMPLATE_INST(Neon::eGrid, double, 3)
 
 EXTERN_TEMPLATE_INST(Neon::dGrid, float, 1)
 EXTERN_TEMPLATE_INST(Neon::dGrid, float, 3)
-EXTERN_TEMPLATE_INST(Neon::domain::bGrid, float, 1)
-EXTERN_TEMPLATE_INST(Neon::domain::bGrid, float, 3)
-EXTERN_TEMPLATE_INST(Neon::domain::eGrid, float, 1)
-EXTERN_TEMPLATE_INST(Neon::domain::eGrid, float, 3)
+EXTERN_TEMPLATE_INST(Neon::bGrid, float, 1)
+EXTERN_TEMPLATE_INST(Neon::bGrid, float, 3)
+EXTERN_TEMPLATE_INST(Neon::eGrid, float, 1)
+EXTERN_TEMPLATE_INST(Neon::eGrid, float, 3)
+
+#undef EXTERN_TEMPLATE_INST
+
+#define EXTERN_ADVECTION_DIFFUSION_INST(GRID, REAL, CARD)                                          \
+    extern template std::pair<Neon::solver::SolverResultInfo, Neon::solver::SolverStatus>          \
+    testAdvectionDiffusionContainers<GRID, REAL, CARD>(const Neon::Backend& backend,               \
+                                                       const std::string&   solverName,            \
+                                                       int domainSize, std::array<REAL, CARD> bdZmin, \
+                                                       std::array<REAL, CARD> bdZmax, REAL velocity, \
+                                                       size_t maxIterations, REAL tolerance,       \
+                                                       Neon::skeleton::Occ occE, Neon::set::TransferMode transferE, \
+                                                       int restart);
+
+EXTERN_ADVECTION_DIFFUSION_INST(Neon::dGrid, double, 1)
+EXTERN_ADVECTION_DIFFUSION_INST(Neon::bGrid, double, 1)
+EXTERN_ADVECTION_DIFFUSION_INST(Neon::eGrid, double, 1)
+EXTERN_ADVECTION_DIFFUSION_INST(Neon::dGrid, float, 1)
+EXTERN_ADVECTION_DIFFUSION_INST(Neon::bGrid, float, 1)
+EXTERN_ADVECTION_DIFFUSION_INST(Neon::eGrid, float, 1)
 
-#undef EXTERN_TEMPLATE_INST
\ No newline at end of file
+#undef EXTERN_ADVECTION_DIFFUSION_INST
\ No newline at end of file
@@ -2,10 +2,10 @@
 
 // Specialization for eGrid_t
 template <>
-Neon::domain::eGrid createGrid<Neon::domain::eGrid>(const Neon::Backend& backend, int domainSize)
+Neon::eGrid createGrid<Neon::eGrid>(const Neon::Backend& backend, int domainSize, const Neon::domain::Stencil& stencil)
 {
     using namespace Neon;
-    using Neon::domain::eGrid;
+    using Neon::eGrid;
 
     // Create a dense grid
     index_3d                      cellDomain(domainSize, domainSize, domainSize);
@@ -13,15 +13,15 @@ Neon::domain::eGrid createGrid<Neon::domain::eGrid>(const Neon::Backend& backend
         return true;
     };
 
-    // Create a 6-neighbor stencil for Laplacian kernel
-    eGrid grid(backend, cellDomain, activeCells, Neon::domain::Stencil::s7_Laplace_t());
+    // 6-neighbor stencil for the Laplacian kernel
+    eGrid grid(backend, cellDomain, activeCells, stencil);
     return grid;
 }
 
 
 // Specialization for dGrid_t
 template <>
-Neon::dGrid createGrid<Neon::dGrid>(const Neon::Backend& backend, int domainSize)
+Neon::dGrid createGrid<Neon::dGrid>(const Neon::Backend& backend, int domainSize, const Neon::domain::Stencil& stencil)
 {
     using namespace Neon;
     using Neon::dGrid;
@@ -32,17 +32,17 @@ Neon::dGrid createGrid<Neon::dGrid>(const Neon::Backend& backend, int domainSize
         return true;
     };
 
-    // Create a 6-neighbor stencil for Laplacian kernel
-    dGrid grid(backend, cellDomain, activeCells, Neon::domain::Stencil::s7_Laplace_t());
+    // 6-neighbor stencil for the Laplacian kernel
+    dGrid grid(backend, cellDomain, activeCells, stencil);
     return grid;
 }
 
 // Specialization for bGrid_t
 template <>
-Neon::domain::bGrid createGrid<Neon::domain::bGrid>(const Neon::Backend& backend, int domainSize)
+Neon::bGrid createGrid<Neon::bGrid>(const Neon::Backend& backend, int domainSize, const Neon::domain::Stencil& stencil)
 {
     using namespace Neon;
-    using Neon::domain::bGrid;
+    using Neon::bGrid;
 
     // Create a dense grid
     index_3d                      cellDomain(domainSize, domainSize, domainSize);
@@ -50,8 +50,8 @@ Neon::domain::bGrid createGrid<Neon::domain::bGrid>(const Neon::Backend& backend
         return true;
     };
 
-    // Create a 6-neighbor stencil for Laplacian kernel
-    bGrid grid(backend, cellDomain, activeCells, Neon::domain::Stencil::s7_Laplace_t());
+    // 6-neighbor stencil for the Laplacian kernel
+    bGrid grid(backend, cellDomain, activeCells, stencil);
     return grid;
 }
 
@@ -64,22 +64,46 @@ Neon::domain::bGrid createGrid<Neon::domain::bGrid>(const Neon::Backend& backend
                                                           size_t                         maxIterations, \
                                                           REAL                           tolerance,     \
                                                           Neon::skeleton::Occ occE,          \
-                                                          Neon::set::TransferMode transferE)     \
+                                                          Neon::set::TransferMode transferE,     \
+                                                          size_t                         checkEvery)    \
         ->std::pair<Neon::solver::SolverResultInfo,                                                     \
                     Neon::solver::SolverStatus>;
 
 TEMPLATE_INST(Neon::dGrid, double, 1)
 TEMPLATE_INST(Neon::dGrid, double, 3)
-TEMPLATE_INST(Neon::domain::bGrid, double, 1)
-TEMPLATE_INST(Neon::domain::bGrid, double, 3)
-TEMPLATE_INST(Neon::domain::eGrid, double, 1)
-TEMPLATE_INST(Neon::domain::eGrid, double, 3)
+TEMPLATE_INST(Neon::bGrid, double, 1)
+TEMPLATE_INST(Neon::bGrid, double, 3)
+TEMPLATE_INST(Neon::eGrid, double, 1)
+TEMPLATE_INST(Neon::eGrid, double, 3)
 
 TEMPLATE_INST(Neon::dGrid, float, 1)
 TEMPLATE_INST(Neon::dGrid, float, 3)
-TEMPLATE_INST(Neon::domain::bGrid, float, 1)
-TEMPLATE_INST(Neon::domain::bGrid, float, 3)
-TEMPLATE_INST(Neon::domain::eGrid, float, 1)
-TEMPLATE_INST(Neon::domain::eGrid, float, 3)
+TEMPLATE_INST(Neon::bGrid, float, 1)
+TEMPLATE_INST(Neon::bGrid, float, 3)
+TEMPLATE_INST(Neon::eGrid, float, 1)
+TEMPLATE_INST(Neon::eGrid, float, 3)
 
-#undef TEMPLATE_INST
\ No newline at end of file
+#undef TEMPLATE_INST
+#define ADVECTION_DIFFUSION_INST(GRID, REAL, CARD)                                                                 \
+    template auto testAdvectionDiffusionContainers<GRID, REAL, CARD>(const Neon::Backend&    backend,       \
+                                                                     const std::string&      solverName,    \
+                                                                     int                     domainSize,    \
+                                                                     std::array<REAL, CARD>  bdZmin,        \
+                                                                     std::array<REAL, CARD>  bdZmax,        \
+                                                                     REAL                    velocity,      \
+                                                                     size_t                  maxIterations, \
+                                                                     REAL                    tolerance,     \
+                                                                     Neon::skeleton::Occ     occE,          \
+                                                                     Neon::set::TransferMode transferE,     \
+                                                                     int                     restart)       \
+        ->std::pair<Neon::solver::SolverResultInfo,                                                                \
+                    Neon::solver::SolverStatus>;
+
+ADVECTION_DIFFUSION_INST(Neon::dGrid, double, 1)
+ADVECTION_DIFFUSION_INST(Neon::bGrid, double, 1)
+ADVECTION_DIFFUSION_INST(Neon::eGrid, double, 1)
+ADVECTION_DIFFUSION_INST(Neon::dGrid, float, 1)
+ADVECTION_DIFFUSION_INST(Neon::bGrid, float, 1)
+ADVECTION_DIFFUSION_INST(Neon::eGrid, float, 1)
+
+#undef ADVECTION_DIFFUSION_INST
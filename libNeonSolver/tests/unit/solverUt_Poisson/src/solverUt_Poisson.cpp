@@ -13,31 +13,27 @@
 #include "Poisson.h"
 
 // Unit test params
-constexpr int    DOMAIN_SIZE = 100;
+// 2^k + 1 cells so that the Dirichlet planes lie on all the multigrid levels
+constexpr int    DOMAIN_SIZE = 33;
 constexpr size_t MAX_ITERATIONS = 1000;
 constexpr double TOLERANCE = 1e-10;
+// A power of two so that the partitions of all the multigrid levels are aligned
+constexpr int NUM_DEVICES = 2;
 
 using namespace Neon::set;
 using namespace Neon::solver;
-using namespace Neon::domain;
+using Neon::dGrid;
+using Neon::eGrid;
 
-// Gets two GPU ids based on availability. If there's only one GPU,
-// then it is oversubscribed.
-const std::vector<int> getDevices()
+// The solvers run on the OpenMP runtime with two partitions, so that the halo updates are exercised
+Neon::Backend getBackend()
 {
-    std::vector<int>    gpuIds{0};
-    Neon::set::DevSet   maxDeviceSet = Neon::set::DevSet::maxSet();
-    if (maxDeviceSet.setCardinality() >= 2) {
-        gpuIds.push_back(1);
-    } else {
-        gpuIds.push_back(0);
-    }
-    return gpuIds;
+    return Neon::Backend(NUM_DEVICES, Neon::Runtime::openmp);
 }
 
-TEST(PoissonTest, DISABLED_CG_Scalar_eGrid_GPU)
+TEST(PoissonTest, CG_Scalar_eGrid)
 {
-    Neon::Backend         backend = Neon::Backend(getDevices(), Neon::Runtime::stream);
+    Neon::Backend         backend = getBackend();
     std::array<double, 1> bdZMin{-20.0};
     std::array<double, 1> bdZMax{20.0};
 
@@ -67,9 +63,9 @@ TEST(PoissonTest, DISABLED_CG_Scalar_eGrid_GPU)
     }
 }
 
-TEST(PoissonTest, DISABLED_CG_Vector_eGrid_GPU)
+TEST(PoissonTest, CG_Vector_eGrid)
 {
-    Neon::Backend         backend = Neon::Backend(getDevices(), Neon::Runtime::stream);
+    Neon::Backend         backend = getBackend();
     std::array<double, 3> bdZMin{0, -20.0, 0};
     std::array<double, 3> bdZMax{0, 0, 20.0};
 
@@ -84,9 +80,9 @@ TEST(PoissonTest, DISABLED_CG_Vector_eGrid_GPU)
 }
 
 
-TEST(PoissonTest, DISABLED_CG_Vector_dGrid_GPU)
+TEST(PoissonTest, CG_Vector_dGrid)
 {
-    Neon::Backend         backend = Neon::Backend(getDevices(), Neon::Runtime::stream);
+    Neon::Backend         backend = getBackend();
     std::array<double, 3> bdZMin{0, -20.0, 0};
     std::array<double, 3> bdZMax{0, 0, 20.0};
 
@@ -100,6 +96,103 @@ TEST(PoissonTest, DISABLED_CG_Vector_dGrid_GPU)
     ASSERT_TRUE(result.residualEnd <= TOLERANCE);
 }
 
+TEST(PoissonTest, PipelinedCG_Scalar_dGrid)
+{
+    Neon::Backend         backend = getBackend();
+    std::array<double, 1> bdZMin{-20.0};
+    std::array<double, 1> bdZMax{20.0};
+
+    // The pipelined recurrences lose some accuracy with respect to CG
+    constexpr double tolerance = 1e-8;
+
+    for (auto occE : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard}) {
+        auto [result, status] = testPoissonContainers<dGrid, double, 1>(backend, "PipelinedCG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITERATIONS, tolerance, occE, Neon::set::TransferMode::get);
+        ASSERT_TRUE(status == SolverStatus::Converged);
+        ASSERT_TRUE(result.residualEnd <= tolerance);
+
+        auto [resultCG, statusCG] = testPoissonContainers<dGrid, double, 1>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITERATIONS, tolerance, occE, Neon::set::TransferMode::get);
+        ASSERT_TRUE(statusCG == SolverStatus::Converged);
+        // The residual checked by the pipelined CG lags one iteration behind
+        ASSERT_LE(result.numIterations, resultCG.numIterations + 2);
+    }
+}
+
+TEST(PoissonTest, CG_CheckEvery_dGrid)
+{
+    Neon::Backend         backend = getBackend();
+    std::array<double, 1> bdZMin{-20.0};
+    std::array<double, 1> bdZMax{20.0};
+
+    constexpr size_t checkEvery = 4;
+
+    auto [resultCG, statusCG] = testPoissonContainers<dGrid, double, 1>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITERATIONS, TOLERANCE, Neon::skeleton::Occ::none, Neon::set::TransferMode::get);
+    ASSERT_TRUE(statusCG == SolverStatus::Converged);
+
+    auto [result, status] = testPoissonContainers<dGrid, double, 1>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITERATIONS, TOLERANCE, Neon::skeleton::Occ::none, Neon::set::TransferMode::get, checkEvery);
+    ASSERT_TRUE(status == SolverStatus::Converged);
+    ASSERT_TRUE(result.residualEnd <= TOLERANCE);
+    // At most checkEvery - 1 iterations past the one where the check of every iteration stops
+    ASSERT_GE(result.numIterations, resultCG.numIterations);
+    ASSERT_LT(result.numIterations, resultCG.numIterations + checkEvery);
+}
+
+TEST(PoissonTest, PCG_Multigrid_Scalar)
+{
+    Neon::Backend         backend = getBackend();
+    std::array<double, 1> bdZMin{-20.0};
+    std::array<double, 1> bdZMax{20.0};
+
+    // The multigrid V-cycle is only available on dGrid
+    for (auto occE : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard}) {
+        {
+            auto [result, status] = testPoissonContainers<dGrid, double, 1>(backend, "PCG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITERATIONS, TOLERANCE, occE, Neon::set::TransferMode::get);
+            ASSERT_TRUE(status == SolverStatus::Converged);
+            ASSERT_TRUE(result.residualEnd <= TOLERANCE);
+
+            auto [resultCG, statusCG] = testPoissonContainers<dGrid, double, 1>(backend, "CG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITERATIONS, TOLERANCE, occE, Neon::set::TransferMode::get);
+            ASSERT_TRUE(statusCG == SolverStatus::Converged);
+            ASSERT_LT(result.numIterations, resultCG.numIterations);
+        }
+        {
+            auto [result, status] = testPoissonContainers<dGrid, double, 1>(backend, "MG", DOMAIN_SIZE, bdZMin, bdZMax, MAX_ITERATIONS, TOLERANCE, occE, Neon::set::TransferMode::get);
+            ASSERT_TRUE(status == SolverStatus::Converged);
+            ASSERT_TRUE(result.residualEnd <= TOLERANCE);
+        }
+    }
+}
+
+TEST(PoissonTest, BiCGStab_GMRES_AdvectionDiffusion)
+{
+    Neon::Backend         backend = getBackend();
+    std::array<double, 1> bdZMin{-20.0};
+    std::array<double, 1> bdZMax{20.0};
+
+    constexpr int    domainSize = 32;
+    constexpr double velocity = 10.0;
+    // GMRES(30) on a non-symmetric operator needs many more iterations than BiCGStab
+    constexpr size_t maxIterations = 5000;
+
+    for (const std::string solverName : {"BiCGStab", "GMRES"}) {
+        {
+            auto [result, status] = testAdvectionDiffusionContainers<dGrid, double, 1>(backend, solverName, domainSize, bdZMin, bdZMax, velocity, maxIterations, TOLERANCE, Neon::skeleton::Occ::none, Neon::set::TransferMode::get);
+            ASSERT_TRUE(status == SolverStatus::Converged);
+            ASSERT_TRUE(result.residualEnd <= TOLERANCE);
+        }
+        {
+            auto [result, status] = testAdvectionDiffusionContainers<eGrid, double, 1>(backend, solverName, domainSize, bdZMin, bdZMax, velocity, maxIterations, TOLERANCE, Neon::skeleton::Occ::standard, Neon::set::TransferMode::get);
+            ASSERT_TRUE(status == SolverStatus::Converged);
+            ASSERT_TRUE(result.residualEnd <= TOLERANCE);
+        }
+    }
+
+    // Both solvers also apply to the symmetric Poisson problem
+    for (const std::string solverName : {"BiCGStab", "GMRES"}) {
+        auto [result, status] = testPoissonContainers<dGrid, double, 1>(backend, solverName, DOMAIN_SIZE, bdZMin, bdZMax, maxIterations, TOLERANCE, Neon::skeleton::Occ::none, Neon::set::TransferMode::get);
+        ASSERT_TRUE(status == SolverStatus::Converged);
+        ASSERT_TRUE(result.residualEnd <= TOLERANCE);
+    }
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -51,6 +51,16 @@ class CpuDev : public DeviceInterface
          * Frees memory allocated with the standard malloc method.
          */
         static void free(void* pointer);
+        /**
+         * Allocating memory aligned to the cache line size.
+         * Buffers of at least a huge page (2 MB) are aligned to the huge page size
+         * and, on Linux, marked as candidates for transparent huge pages.
+         */
+        static void* mallocHugePageByte(size_t size);
+        /**
+         * Frees memory allocated with mallocHugePageByte.
+         */
+        static void freeHugePageByte(void* pointer);
         /**
          * Allocating memory with the cuda host allocator.
          * This is pinned memory.
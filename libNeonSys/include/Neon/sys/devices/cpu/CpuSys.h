@@ -19,6 +19,16 @@ class CpuMem;
 class CpuSys
 {
    public:
+    /**
+     * Description of a NUMA node of the host
+     */
+    struct NumaNode
+    {
+        int              id = 0;     /**< Index of the node as reported by the OS */
+        std::vector<int> cpus;       /**< Logical CPUs belonging to the node */
+        int64_t          memory = 0; /**< Physical memory attached to the node in bytes */
+    };
+
     std::vector<CpuDev> m_cpuDevVec;  // Devices...
     std::vector<CpuMem> m_cpuMemVec;  // Allocators ....
 
@@ -53,9 +63,26 @@ class CpuSys
     */
     bool isInit() const;
 
+    /**
+     * Returns the NUMA nodes of the host.
+     * When the topology can not be detected a single node holding all the CPUs is returned.
+     */
+    const std::vector<NumaNode>& numaNodes() const;
+
+    /**
+     * Returns the number of NUMA nodes of the host
+     */
+    int32_t numNumaNodes() const;
+
 
    private:
-    bool mInit;
+    /**
+     * Reads the NUMA topology of the host
+     */
+    void helpDetectNumaTopology();
+
+    bool                  mInit;
+    std::vector<NumaNode> mNumaNodes;
 };
 
 
@@ -1,6 +1,8 @@
 #pragma once
 
+#ifdef NEON_USE_CUBLAS
 #include <cublas_v2.h>
+#endif
 #include <utility>
 
 #include "Neon/core/core.h"
@@ -305,10 +307,12 @@ class GpuDevice : public DeviceInterface
          */
         GpuEvent event(bool disableTiming) const;
 
+#ifdef NEON_USE_CUBLAS
         /**
          * Create and initialize a new cublas handle          
         */
         cublasHandle_t cublasHandle(bool device_pointer_mode = true) const;
+#endif
 
         /**
          * return device properties          
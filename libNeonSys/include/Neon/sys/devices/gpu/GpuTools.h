@@ -1,5 +1,7 @@
 #pragma once
+#ifdef NEON_USE_CUBLAS
 #include <cublas_v2.h>
+#endif
 #include <string>
 
 namespace Neon {
@@ -8,12 +10,14 @@ namespace sys {
 void gpuCheckLastError(const std::string& errorMsg);
 void gpuCheckLastError();
 
+#ifdef NEON_USE_CUBLAS
 /**
  * @brief Converting cublas status to string 
  * @param status the input status
  * @return a string of the status 
 */
 std::string cublasGetErrorString(cublasStatus_t status);
+#endif
 
 
 }  // namespace sys
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Neon/core/core.h"
+
+#include <algorithm>
+
+namespace Neon::sys {
+
+/**
+ * Traversal of a dense 3D buffer by the OpenMP launchers, used by MemDevice to first touch
+ * the pages of a CPU buffer with the same thread mapping as the computation.
+ *
+ * Only buffers with the enabled flag are first touched, i.e. the buffers the OpenMP runtime computes on.
+ *
+ * A component of the buffer is seen as slices of rowsPerSlice rows of rowLength elements (x fastest).
+ * The last paddingSlices slices of the allocation are not used: the components are packed before them.
+ * Within a component the first and the last haloSlices slices are not computed, the others are split into tiles
+ * that are numbered x fastest and handed out to threads by a static schedule with the given chunk.
+ * A tile component set to zero spans the whole extent in that direction.
+ */
+struct FirstTouchTiling
+{
+    bool           enabled = false;
+    int64_t        rowLength = 0;
+    int64_t        rowsPerSlice = 0;
+    int64_t        haloSlices = 0;
+    int64_t        paddingSlices = 0;
+    Neon::index_3d tile{0, 0, 0};
+    int            chunk = 1;
+
+    /**
+     * Returns true if a traversal is defined, otherwise buffers are touched element by element
+     */
+    auto isDefined() const -> bool
+    {
+        return rowLength > 0 && rowsPerSlice > 0;
+    }
+
+    /**
+     * Calls touch(begin, end) for every range of elements of a buffer of nComponents components of nElements elements,
+     * on the thread that the OpenMP launchers assign to the range. Elements are indexed from the start of the buffer.
+     * It must be called by all the threads of a parallel region.
+     */
+    template <typename Touch>
+    auto forEachRange(int64_t nElements, int nComponents, const Touch& touch) const -> void
+    {
+        const int64_t sliceElements = rowLength * rowsPerSlice;
+        const int64_t nSlices = isDefined() ? nElements / sliceElements : 0;
+        const int64_t componentSlices = nSlices - paddingSlices;
+        const int64_t nComputedSlices = componentSlices - 2 * haloSlices;
+        const bool    isTiled = isDefined() &&
+                             nSlices * sliceElements == nElements &&
+                             nComputedSlices > 0;
+
+        if (!isTiled) {
+            // Static schedule over the elements (1D launchers)
+            for (int c = 0; c < nComponents; c++) {
+#pragma omp for schedule(static)
+                for (int64_t i = 0; i < nElements; i++) {
+                    touch(c * nElements + i, c * nElements + i + 1);
+                }
+            }
+            return;
+        }
+
+        // Same tile resolution and numbering as launchLambdaOnSpanOMP
+        const Neon::int64_3d dim(rowLength, rowsPerSlice, nComputedSlices);
+        auto                 resolve = [](int userTile, int64_t domain) -> int64_t {
+            return (userTile <= 0 || int64_t(userTile) > domain) ? domain : int64_t(userTile);
+        };
+        const Neon::int64_3d tileDim(resolve(tile.x, dim.x),
+                                     resolve(tile.y, dim.y),
+                                     resolve(tile.z, dim.z));
+        const Neon::int64_3d nTiles((dim.x + tileDim.x - 1) / tileDim.x,
+                                    (dim.y + tileDim.y - 1) / tileDim.y,
+                                    (dim.z + tileDim.z - 1) / tileDim.z);
+        const int     nTotalTiles = static_cast<int>(nTiles.x * nTiles.y * nTiles.z);
+        const int     tileChunk = std::max(1, chunk);
+        const int64_t componentElements = componentSlices * sliceElements;
+        const int64_t haloElements = haloSlices * sliceElements;
+
+        // Halo and padding slices are not computed, they are touched by a static schedule over the elements
+#pragma omp for schedule(static) nowait
+        for (int64_t i = nComponents * componentElements; i < nComponents * nElements; i++) {
+            touch(i, i + 1);
+        }
+        for (int c = 0; c < nComponents; c++) {
+            const int64_t componentBegin = c * componentElements;
+#pragma omp for schedule(static) nowait
+            for (int64_t i = 0; i < haloElements; i++) {
+                touch(componentBegin + i, componentBegin + i + 1);
+                touch(componentBegin + componentElements - haloElements + i,
+                      componentBegin + componentElements - haloElements + i + 1);
+            }
+#pragma omp for schedule(static, tileChunk)
+            for (int tileIdx = 0; tileIdx < nTotalTiles; tileIdx++) {
+                const int64_t tx = tileIdx % nTiles.x;
+                const int64_t ty = (tileIdx / nTiles.x) % nTiles.y;
+                const int64_t tz = tileIdx / (nTiles.x * nTiles.y);
+
+                const int64_t xBegin = tx * tileDim.x;
+                const int64_t xEnd = std::min(xBegin + tileDim.x, dim.x);
+                for (int64_t z = tz * tileDim.z; z < std::min((tz + 1) * tileDim.z, dim.z); z++) {
+                    for (int64_t y = ty * tileDim.y; y < std::min((ty + 1) * tileDim.y, dim.y); y++) {
+                        const int64_t rowBegin = componentBegin + haloElements + z * sliceElements + y * dim.x;
+                        touch(rowBegin + xBegin, rowBegin + xEnd);
+                    }
+                }
+            }
+        }
+    }
+};
+
+}  // namespace Neon::sys
@@ -9,6 +9,7 @@
 #include "Neon/sys/devices/DevInterface.h"
 #include "Neon/sys/devices/cpu/CpuDevice.h"
 #include "Neon/sys/devices/gpu/GpuDevice.h"
+#include "Neon/sys/memory/FirstTouchTiling.h"
 #include "Neon/sys/memory/memConf.h"
 namespace Neon::sys {
 
@@ -150,13 +151,15 @@ struct MemDevice
 
     /**
      * Constructor (Sys managed)
+     * An enabled firstTouchTiling makes CPU buffers be first touched with the traversal of the OpenMP launchers.
      */
-    MemDevice(int                cardinality,
-              Neon::MemoryLayout order,
-              DeviceType         devType,
-              DeviceID           devId,
-              Neon::Allocator    allocType,
-              uint64_t           nElements);
+    MemDevice(int                     cardinality,
+              Neon::MemoryLayout      order,
+              DeviceType              devType,
+              DeviceID                devId,
+              Neon::Allocator         allocType,
+              uint64_t                nElements,
+              const FirstTouchTiling& firstTouchTiling = FirstTouchTiling());
 
 
     /**
@@ -427,7 +430,13 @@ struct MemDevice
     /**
      * Helper function to allocate GPU memory
      */
-    void helperAllocMem();
+    void helperAllocMem(const FirstTouchTiling& firstTouchTiling = FirstTouchTiling());
+
+    /**
+     * Helper function to zero a CPU buffer with the thread mapping of the OpenMP launchers,
+     * so that on NUMA systems pages are placed close to the threads that will use them
+     */
+    void helperFirstTouch(const FirstTouchTiling& firstTouchTiling);
 
     /**
      * Helper function to reset local information
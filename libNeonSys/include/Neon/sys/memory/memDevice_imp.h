@@ -6,6 +6,8 @@
 #include "Neon/sys/global/GpuSysGlobal.h"
 #include "Neon/sys/memory/GpuMem.h"
 
+#include <cstring>
+
 namespace Neon {
 namespace sys {
 
@@ -64,12 +66,13 @@ MemDevice<T_ta>::MemDevice(DeviceType      devType,
  * Constructor (Sys managed)
  */
 template <typename T_ta>
-MemDevice<T_ta>::MemDevice(int                cardinality,
-                           Neon::MemoryLayout order,
-                           DeviceType         devType,
-                           DeviceID           devId,
-                           Neon::Allocator    allocType,
-                           uint64_t           nElements)
+MemDevice<T_ta>::MemDevice(int                     cardinality,
+                           Neon::MemoryLayout      order,
+                           DeviceType              devType,
+                           DeviceID                devId,
+                           Neon::Allocator         allocType,
+                           uint64_t                nElements,
+                           const FirstTouchTiling& firstTouchTiling)
     : m_devType(devType),
       m_devIdx(devId),
       m_allocType(allocType),
@@ -85,7 +88,7 @@ MemDevice<T_ta>::MemDevice(int                cardinality,
         return;
     }
     m_refCounter = new std::atomic_uint64_t(0);
-    helperAllocMem();
+    helperAllocMem(firstTouchTiling);
 }
 
 
@@ -225,7 +228,7 @@ const index64_2d& MemDevice<T_ta>::pitch() const
 
 
 template <typename T_ta>
-void MemDevice<T_ta>::helperAllocMem()
+void MemDevice<T_ta>::helperAllocMem(const FirstTouchTiling& firstTouchTiling)
 {
 
     auto getAllocatedMemorySizeTotal = [&](size_t elPadding ) {
@@ -260,6 +263,11 @@ void MemDevice<T_ta>::helperAllocMem()
             m_notAlignedBuffer = mem.allocateMem(m_allocType, allocatedMemorySizeTotal);
             computeBuffer = (T_ta*)m_notAlignedBuffer;
             m_refCounter->fetch_add(1);
+            if (firstTouchTiling.enabled &&
+                (m_allocType == Neon::Allocator::MALLOC ||
+                 m_allocType == Neon::Allocator::HUGE_PAGE_MEM)) {
+                helperFirstTouch(firstTouchTiling);
+            }
             break;
         }
 
@@ -293,6 +301,26 @@ void MemDevice<T_ta>::helperAllocMem()
     return;
 }
 
+template <typename T_ta>
+void MemDevice<T_ta>::helperFirstTouch(const FirstTouchTiling& firstTouchTiling)
+{
+    // Pages are placed on the NUMA node of the thread that writes them first.
+    // Each element is zeroed by the thread that the OpenMP launchers assign to it (see FirstTouchTiling).
+    const bool    isStructOfArrays = m_cardinality == 1 || m_order == Neon::MemoryLayout::structOfArrays;
+    const int     nComponents = isStructOfArrays ? m_cardinality : 1;
+    const size_t  elementBytes = isStructOfArrays ? sizeof(T_ta) : sizeof(T_ta) * m_cardinality;
+    const int64_t nElements = static_cast<int64_t>(m_nElements);
+    char*         buffer = static_cast<char*>(m_notAlignedBuffer);
+
+    // Buffers of a few pages are not worth a parallel region
+    const bool isLarge = m_allocatedBytes >= (size_t(1) << 20);
+
+#pragma omp parallel if (isLarge)
+    firstTouchTiling.forEachRange(nElements, nComponents, [&](int64_t begin, int64_t end) {
+        std::memset(buffer + begin * elementBytes, 0, (end - begin) * elementBytes);
+    });
+}
+
 template <typename T_ta>
 void MemDevice<T_ta>::helperFreeMem()
 {
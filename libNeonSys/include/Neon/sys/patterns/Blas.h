@@ -1,5 +1,7 @@
 #pragma once
+#ifdef NEON_USE_CUBLAS
 #include <cublas_v2.h>
+#endif
 
 #include "Neon/sys/devices/gpu/GpuStream.h"
 #include "Neon/sys/memory/MemDevice.h"
@@ -10,10 +12,11 @@ enum class Engine
 {
     cuBlas = 0,
     CUB = 1,
+    OpenMP = 2, /**< multithreaded host kernels, it requires host buffers */
 };
 
 /**
- * Collection of computational patterns computed using cuBLAS. This class is not thread safe as it assumes only a single host thread to call it
+ * Collection of computational patterns computed using cuBLAS, CUB or OpenMP. This class is not thread safe as it assumes only a single host thread to call it
 */
 template <typename T /**< The input/output data type. Only float and double are allowed */>
 class Blas
@@ -30,6 +33,11 @@ class Blas
          const Neon::DeviceType&     devType = Neon::DeviceType::CUDA, /**< The device type*/
          const Engine                engine = Engine::cuBlas /**< the type of the backend engine */);
 
+    /**
+     * Constructor for a Blas working on host buffers only. No GPU is required.
+    */
+    explicit Blas(const Engine engine /**< the type of the backend engine */);
+
     /**
      * Set the working stream for the pattern. It needs to be set only once unless the stream needs to be changes      
     */
@@ -70,7 +78,8 @@ class Blas
              int                 num_elements = std::numeric_limits<int>::max() /**< number of elements where computation should be done starting from start_id*/);
 
     /**
-     * Execute the second phase on reduction using CUB engine      
+     * Execute the second phase on reduction using CUB or OpenMP engine.
+     * With the OpenMP engine, the first phase output and the output buffer are on the host.
     */
     template <typename ReductionOp>
     void reducePhase2(MemDevice<T>& output, ReductionOp reduction_op, T init);
@@ -101,7 +110,15 @@ class Blas
     */
     void checkAllocator(const MemDevice<T>& input, const MemDevice<T>& output);
 
+    /**
+     * Multithreaded and vectorized host reduction: sum_{i=start}^{start+n-1}(op(i))
+    */
+    template <typename Op>
+    static auto hostSum(int start_id, int num_elements, Op op) -> T;
+
+#ifdef NEON_USE_CUBLAS
     std::shared_ptr<cublasHandle_t> mHandle;                /**< cuBLAS handle */
+#endif
     Neon::DeviceType                mDevType;               /** < type of the device*/
     DeviceID                        mDevID;                 /** < the device on which the computation and temp memory allocations happens*/
     Neon::sys::GpuStream            mStream;                /** < stream used for the computations */
@@ -2,6 +2,8 @@
 #include "Neon/sys/devices/gpu/GpuTools.h"
 #include "Neon/sys/patterns/Blas.h"
 
+#include <cmath>
+
 namespace Neon::sys::patterns {
 
 template <typename T>
@@ -15,10 +17,22 @@ Blas<T>::Blas(const Neon::sys::GpuDevice& dev,
     mDevID = dev.getIdx();
     mDeviceCUBTempMemBytes = 0;
 
+#ifdef NEON_USE_CUBLAS
     mHandle = std::make_shared<cublasHandle_t>();
     if (mDevType == Neon::DeviceType::CUDA) {
         *mHandle = dev.tools.cublasHandle(false);
     }
+#endif
+}
+
+template <typename T>
+Blas<T>::Blas(const Engine engine)
+{
+    mDevType = Neon::DeviceType::CPU;
+    mEngine = engine;
+    mNumBlocks = 0;
+    mDevID = 0;
+    mDeviceCUBTempMemBytes = 0;
 }
 
 template <typename T>
@@ -26,12 +40,14 @@ void Blas<T>::setStream(Neon::sys::GpuStream& stream)
 {
     if (mDevType == Neon::DeviceType::CUDA) {
         mStream = stream;
+#ifdef NEON_USE_CUBLAS
         cublasStatus_t status = cublasSetStream(*mHandle, stream.stream());
         if (status != CUBLAS_STATUS_SUCCESS) {
             NeonException exc;
             exc << "cuBLAS error setting stream with error: " << Neon::sys::cublasGetErrorString(status);
             NEON_THROW(exc);
         }
+#endif
     }
 }
 
@@ -62,12 +78,43 @@ void Blas<T>::checkAllocator(const MemDevice<T>& input, const MemDevice<T>& outp
         NEON_THROW(exc);
     }
 
-    if (output.allocType() != Neon::Allocator::MALLOC && output.allocType() != Neon::Allocator::CUDA_MEM_HOST) {
+    if (output.allocType() != Neon::Allocator::MALLOC &&
+        output.allocType() != Neon::Allocator::HUGE_PAGE_MEM &&
+        output.allocType() != Neon::Allocator::CUDA_MEM_HOST) {
         NeonException exc("Blas::checkAllocator");
         exc << "Output allocator should be on the host";
         exc << "\n Output allocator is " << Neon::AllocatorUtils::toString(output.allocType());
         NEON_THROW(exc);
     }
+
+    const bool isInputOnDevice = input.allocType() == Neon::Allocator::CUDA_MEM_DEVICE ||
+                                 input.allocType() == Neon::Allocator::CUDA_MEM_UNIFIED;
+    if (isInputOnDevice && mEngine == Engine::OpenMP) {
+        NeonException exc("Blas::checkAllocator");
+        exc << "OpenMP engine requires input buffers on the host";
+        exc << "\n Input allocator is " << Neon::AllocatorUtils::toString(input.allocType());
+        NEON_THROW(exc);
+    }
+#ifndef NEON_USE_CUBLAS
+    if (isInputOnDevice) {
+        NeonException exc("Blas::checkAllocator");
+        exc << "Neon was built without cuBLAS, reductions on device buffers are not available";
+        NEON_THROW(exc);
+    }
+#endif
+}
+
+template <typename T>
+template <typename Op>
+auto Blas<T>::hostSum(int start_id, int num_elements, Op op) -> T
+{
+    T ret = 0;
+#pragma omp parallel for simd reduction(+ \
+                                        : ret) schedule(static)
+    for (int i = start_id; i < start_id + num_elements; ++i) {
+        ret += op(i);
+    }
+    return ret;
 }
 
 template <typename T>
@@ -78,6 +125,7 @@ void Blas<T>::absoluteSum(const MemDevice<T>& input, MemDevice<T>& output, int s
     num_elements = (num_elements == std::numeric_limits<int>::max()) ? static_cast<int>(input.nElements()) : num_elements;
 
 
+#ifdef NEON_USE_CUBLAS
     if (input.allocType() == Neon::Allocator::CUDA_MEM_DEVICE ||
         input.allocType() == Neon::Allocator::CUDA_MEM_UNIFIED) {
 
@@ -108,19 +156,19 @@ void Blas<T>::absoluteSum(const MemDevice<T>& input, MemDevice<T>& output, int s
             check_error(status);
             return;
         }
-    } else if (input.allocType() == Neon::Allocator::CUDA_MEM_HOST ||
-               input.allocType() == Neon::Allocator::MALLOC) {
-        T ret = 0;
-#pragma omp parallel for reduction(+ \
-                                   : ret)
-        for (int i = start_id; i < start_id + num_elements; ++i) {
+    }
+#endif
+    if (input.allocType() == Neon::Allocator::CUDA_MEM_HOST ||
+        input.allocType() == Neon::Allocator::MALLOC ||
+        input.allocType() == Neon::Allocator::HUGE_PAGE_MEM) {
+        const T* in = input.mem();
+        output.mem()[0] = hostSum(start_id, num_elements, [in](int i) {
             if constexpr (std::is_signed_v<T>) {
-                ret += std::abs(input.mem()[i]);
+                return static_cast<T>(std::abs(in[i]));
             } else {
-                ret += input.mem()[i];
+                return in[i];
             }
-        }
-        output.mem()[0] = ret;
+        });
     }
 }
 
@@ -140,6 +188,7 @@ void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDev
 
     num_elements = (num_elements == std::numeric_limits<int>::max()) ? static_cast<int>(input1.nElements()) : num_elements;
 
+#ifdef NEON_USE_CUBLAS
     if (input1.allocType() == Neon::Allocator::CUDA_MEM_DEVICE ||
         input1.allocType() == Neon::Allocator::CUDA_MEM_UNIFIED) {
 
@@ -174,15 +223,14 @@ void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDev
             check_error(status);
             return;
         }
-    } else if (input1.allocType() == Neon::Allocator::CUDA_MEM_HOST ||
-               input1.allocType() == Neon::Allocator::MALLOC) {
-        T ret = 0;
-#pragma omp parallel for reduction(+ \
-                                   : ret)
-        for (int i = start_id; i < start_id + num_elements; ++i) {
-            ret += input1.mem()[i] * input2.mem()[i];
-        }
-        output.mem()[0] = ret;
+    }
+#endif
+    if (input1.allocType() == Neon::Allocator::CUDA_MEM_HOST ||
+        input1.allocType() == Neon::Allocator::MALLOC ||
+        input1.allocType() == Neon::Allocator::HUGE_PAGE_MEM) {
+        const T* in1 = input1.mem();
+        const T* in2 = input2.mem();
+        output.mem()[0] = hostSum(start_id, num_elements, [in1, in2](int i) { return in1[i] * in2[i]; });
     }
 }
 
@@ -193,6 +241,7 @@ void Blas<T>::norm2(const MemDevice<T>& input, MemDevice<T>& output, int start_i
 
     num_elements = (num_elements == std::numeric_limits<int>::max()) ? static_cast<int>(input.nElements()) : num_elements;
 
+#ifdef NEON_USE_CUBLAS
     if (input.allocType() == Neon::Allocator::CUDA_MEM_DEVICE ||
         input.allocType() == Neon::Allocator::CUDA_MEM_UNIFIED) {
 
@@ -225,15 +274,13 @@ void Blas<T>::norm2(const MemDevice<T>& input, MemDevice<T>& output, int start_i
             return;
         }
 
-
-    } else if (input.allocType() == Neon::Allocator::CUDA_MEM_HOST ||
-               input.allocType() == Neon::Allocator::MALLOC) {
-        T ret = 0;
-#pragma omp parallel for reduction(+ \
-                                   : ret)
-        for (int i = start_id; i < start_id + num_elements; ++i) {
-            ret += input.mem()[i] * input.mem()[i];
-        }
+    }
+#endif
+    if (input.allocType() == Neon::Allocator::CUDA_MEM_HOST ||
+        input.allocType() == Neon::Allocator::MALLOC ||
+        input.allocType() == Neon::Allocator::HUGE_PAGE_MEM) {
+        const T* in = input.mem();
+        const T  ret = hostSum(start_id, num_elements, [in](int i) { return in[i] * in[i]; });
         output.mem()[0] = static_cast<T>(std::sqrt(ret));
     }
 }
@@ -247,6 +294,7 @@ MemDevice<T>& Blas<T>::getReducePhase1Output()
 template <typename T>
 Blas<T>::~Blas() noexcept(false)
 {
+#ifdef NEON_USE_CUBLAS
     if (mHandle.use_count() == 1 && mDevType == Neon::DeviceType::CUDA) {
         cublasStatus_t status = cublasDestroy(*mHandle);
         if (status != CUBLAS_STATUS_SUCCESS) {
@@ -255,5 +303,6 @@ Blas<T>::~Blas() noexcept(false)
             NEON_THROW(exc);
         }
     }
+#endif
 }
 }  // namespace Neon::sys::patterns
\ No newline at end of file
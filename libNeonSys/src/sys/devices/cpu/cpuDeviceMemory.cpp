@@ -2,12 +2,15 @@
 #include "Neon/sys/devices/cpu/CpuDevice.h"
 
 
+#include <algorithm>
+
 #include "cuda.h"
 #include "cuda_runtime.h"
 
 #if defined(NEON_OS_WINDOWS)
 #include "windows.h"
 #elif defined(NEON_OS_LINUX)
+#include "sys/mman.h"
 #include "sys/sysinfo.h"
 #include "sys/types.h"
 #else  // defined(NEON_OS_MAC)
@@ -44,6 +47,51 @@ void CpuDev::memory_t::free(void* pointer)
     ::free(pointer);
 }
 
+void* CpuDev::memory_t::mallocHugePageByte(size_t allocationSize)
+{
+    constexpr size_t cacheLineSize = 64;
+    constexpr size_t hugePageSize = size_t(2) << 20;
+
+    // Small buffers would waste most of a huge page: they are only aligned to the cache line.
+    // Large ones are padded to a multiple of the huge page so that the last page can be a huge one too.
+    const bool   isHuge = allocationSize >= hugePageSize;
+    const size_t alignment = isHuge ? hugePageSize : cacheLineSize;
+    const size_t paddedSize = ((std::max(allocationSize, size_t(1)) + alignment - 1) / alignment) * alignment;
+
+    void* mem = nullptr;
+#if defined(NEON_OS_WINDOWS)
+    mem = _aligned_malloc(paddedSize, alignment);
+#else
+    if (posix_memalign(&mem, alignment, paddedSize) != 0) {
+        mem = nullptr;
+    }
+#endif
+    if (nullptr == mem) {
+        NeonException exc;
+        exc << "Error completing aligned malloc operation: "
+            << "\n   memory size        " << allocationSize
+            << "\n   alignment          " << alignment;
+        NEON_THROW(exc);
+    }
+
+#if defined(NEON_OS_LINUX) && defined(MADV_HUGEPAGE)
+    if (isHuge) {
+        // This is only a hint: if transparent huge pages are disabled the buffer stays on regular pages.
+        madvise(mem, paddedSize, MADV_HUGEPAGE);
+    }
+#endif
+    return mem;
+}
+
+void CpuDev::memory_t::freeHugePageByte(void* pointer)
+{
+#if defined(NEON_OS_WINDOWS)
+    _aligned_free(pointer);
+#else
+    ::free(pointer);
+#endif
+}
+
 void* CpuDev::memory_t::mallocCudaHostByte(size_t allocationSize)
 {
     void* mem = nullptr;
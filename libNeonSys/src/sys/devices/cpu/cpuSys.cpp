@@ -2,9 +2,37 @@
 #include "Neon/core/core.h"
 #include "Neon/sys/devices/cpu/CpuDevice.h"
 
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
 namespace Neon {
 namespace sys {
 
+namespace {
+/**
+ * Parses a list in the sysfs format, e.g. "0-3,8,10-11"
+ */
+auto parseSysfsList(const std::string& list) -> std::vector<int>
+{
+    std::vector<int>   ids;
+    std::istringstream stream(list);
+    std::string        range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        const auto dash = range.find('-');
+        const int  first = std::stoi(range.substr(0, dash));
+        const int  last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int id = first; id <= last; id++) {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+}  // namespace
 
 CpuSys::CpuSys()
     : mInit(false)
@@ -20,6 +48,59 @@ void CpuSys::init()
     this->m_cpuMemVec.emplace_back(this->m_cpuDevVec[0]);
 
     NEON_INFO("CpuSys_t: Loading info on CPU subsystem");
+
+    helpDetectNumaTopology();
+    for (auto const& node : mNumaNodes) {
+        NEON_INFO("CpuSys_t: NUMA node {} with {} CPUs and {} MB of memory", node.id, node.cpus.size(), node.memory / (1024 * 1024));
+    }
+}
+
+void CpuSys::helpDetectNumaTopology()
+{
+    mNumaNodes.clear();
+#if defined(NEON_OS_LINUX)
+    try {
+        const std::string nodeRoot = "/sys/devices/system/node/";
+        std::ifstream     onlineFile(nodeRoot + "online");
+        std::string       onlineList;
+        if (onlineFile && std::getline(onlineFile, onlineList)) {
+            for (int id : parseSysfsList(onlineList)) {
+                NumaNode node;
+                node.id = id;
+
+                const std::string nodeDir = nodeRoot + "node" + std::to_string(id) + "/";
+                std::ifstream     cpuFile(nodeDir + "cpulist");
+                std::string       cpuList;
+                if (cpuFile && std::getline(cpuFile, cpuList)) {
+                    node.cpus = parseSysfsList(cpuList);
+                }
+
+                // Line format: "Node 0 MemTotal:       65843868 kB"
+                std::ifstream memFile(nodeDir + "meminfo");
+                std::string   line;
+                while (memFile && std::getline(memFile, line)) {
+                    const auto pos = line.find("MemTotal:");
+                    if (pos != std::string::npos) {
+                        node.memory = std::stoll(line.substr(pos + 9)) * 1024;
+                        break;
+                    }
+                }
+                mNumaNodes.push_back(node);
+            }
+        }
+    } catch (...) {
+        mNumaNodes.clear();
+    }
+#endif
+    if (mNumaNodes.empty()) {
+        NumaNode node;
+        const int nCpus = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        for (int cpu = 0; cpu < nCpus; cpu++) {
+            node.cpus.push_back(cpu);
+        }
+        node.memory = m_cpuDevVec.empty() ? 0 : m_cpuDevVec[0].physMemory();
+        mNumaNodes.push_back(node);
+    }
 }
 
 const CpuDev& CpuSys::dev() const
@@ -46,5 +127,15 @@ bool CpuSys::isInit() const
     return mInit;
 }
 
+const std::vector<CpuSys::NumaNode>& CpuSys::numaNodes() const
+{
+    return mNumaNodes;
+}
+
+int32_t CpuSys::numNumaNodes() const
+{
+    return static_cast<int32_t>(mNumaNodes.size());
+}
+
 }  // namespace sys
-}  // End of namespace Neon
\ No newline at end of file
+}  // End of namespace Neon
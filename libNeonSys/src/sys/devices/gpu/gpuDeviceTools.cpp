@@ -150,6 +150,7 @@ GpuEvent GpuDevice::tools_t::event(bool disableTiming) const
     return event;
 }
 
+#ifdef NEON_USE_CUBLAS
 cublasHandle_t GpuDevice::tools_t::cublasHandle(bool device_pointer_mode) const
 {
     this->gpuDev.tools.setActiveDevContext();
@@ -174,6 +175,7 @@ cublasHandle_t GpuDevice::tools_t::cublasHandle(bool device_pointer_mode) const
     }
     return handle;
 }
+#endif
 
 void GpuDevice::tools_t::streamDestroy(GpuStream& stream) const
 {
@@ -28,6 +28,7 @@ void gpuCheckLastError()
     }
 }
 
+#ifdef NEON_USE_CUBLAS
 std::string cublasGetErrorString(cublasStatus_t status)
 {
     switch (status) {
@@ -55,6 +56,7 @@ std::string cublasGetErrorString(cublasStatus_t status)
             return "UNKNOWN_ERROR";
     }
 };
+#endif
 
 }  // namespace sys
 }  // namespace Neon
\ No newline at end of file
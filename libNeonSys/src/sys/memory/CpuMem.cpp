@@ -90,6 +90,16 @@ void* CpuMem::allocateMem(const Neon::Allocator& allocType, size_t size)
 
             return buffer;
         }
+        case Neon::Allocator::HUGE_PAGE_MEM: {
+
+            void* buffer = nullptr;
+            buffer = CpuDev::memory_t::mallocHugePageByte(size);
+
+            size_t usedNow = m_allocatedMemPageable.fetch_add(size) + size;
+            this->updateMaxUsePageable(usedNow);
+
+            return buffer;
+        }
         case Neon::Allocator::CUDA_MEM_HOST: {
 
             void* buffer = nullptr;
@@ -129,6 +139,13 @@ void CpuMem::releaseMem(const Neon::Allocator& allocType, size_t size, void* mem
 
             return;
         }
+        case Neon::Allocator::HUGE_PAGE_MEM: {
+
+            CpuDev::memory_t::freeHugePageByte(mem);
+            m_allocatedMemPageable.fetch_sub(size);
+
+            return;
+        }
         case Neon::Allocator::CUDA_MEM_HOST: {
 
             CpuDev::memory_t::freeCudaHostByte(mem);
@@ -9,7 +9,7 @@ template <typename T>
 void Blas<T>::setNumBlocks(const uint32_t numBlocks)
 {
     mNumBlocks = numBlocks;
-    if (mDevType == Neon::DeviceType::CUDA) {
+    if (mDevType == Neon::DeviceType::CUDA && mEngine != Engine::OpenMP) {
 
         mDevice1stPhaseOutput = Neon::sys::MemDevice<T>(Neon::DeviceType::CUDA,
                                                         mDevID,
@@ -29,6 +29,12 @@ void Blas<T>::setNumBlocks(const uint32_t numBlocks)
                                                     mDevID,
                                                     Neon::Allocator::CUDA_MEM_DEVICE,
                                                     NEON_DIVIDE_UP(mDeviceCUBTempMemBytes, sizeof(T)));
+    } else {
+        // The first phase output stays on the host and no CUB temp memory is needed
+        mDevice1stPhaseOutput = Neon::sys::MemDevice<T>(Neon::DeviceType::CPU,
+                                                        0,
+                                                        Neon::Allocator::MALLOC,
+                                                        mNumBlocks);
     }
 }
 
@@ -45,6 +51,24 @@ void Blas<T>::reducePhase2(MemDevice<T>& output, ReductionOp reduction_op, T ini
         NEON_THROW(exc);
     }
 
+    if (mEngine == Engine::OpenMP) {
+        if (output.allocType() != Neon::Allocator::MALLOC &&
+            output.allocType() != Neon::Allocator::HUGE_PAGE_MEM &&
+            output.allocType() != Neon::Allocator::CUDA_MEM_HOST) {
+            NeonException exc("Blas::reducePhase2");
+            exc << "Output allocator should be on the host for the OpenMP engine";
+            exc << "\n Output allocator is " << Neon::AllocatorUtils::toString(output.allocType());
+            NEON_THROW(exc);
+        }
+        const T* in = mDevice1stPhaseOutput.mem();
+        T        ret = init;
+        for (uint32_t i = 0; i < mNumBlocks; ++i) {
+            ret = reduction_op(ret, in[i]);
+        }
+        output.mem()[0] = ret;
+        return;
+    }
+
     if (output.allocType() != Neon::Allocator::CUDA_MEM_UNIFIED && output.allocType() != Neon::Allocator::CUDA_MEM_DEVICE) {
         NeonException exc("Blas::reducePhase2");
         exc << "Output allocator should be on the device";
@@ -54,7 +78,7 @@ void Blas<T>::reducePhase2(MemDevice<T>& output, ReductionOp reduction_op, T ini
 
     if (mEngine != Engine::CUB) {
         NeonException exc("Blas::reducePhase2");
-        exc << "Can not call reducePhase2 is backend engine is not CUB";
+        exc << "Can not call reducePhase2 is backend engine is not CUB or OpenMP";
         NEON_THROW(exc);
     }
 
@@ -4,6 +4,7 @@
 #include "Neon/Neon.h"
 
 #include "Neon/sys/devices/cpu/CpuDevice.h"
+#include "Neon/sys/global/CpuSysGlobal.h"
 #include <cstring>
 #include <iostream>
 
@@ -14,6 +15,16 @@ TEST(cpuDev, memory)
     NEON_INFO("GoogleTest::cpuDev {}", res);
 }
 
+TEST(cpuSys, numaTopology)
+{
+    const auto& nodes = Neon::sys::globalSpace::cpuSysObj().numaNodes();
+    ASSERT_GE(Neon::sys::globalSpace::cpuSysObj().numNumaNodes(), 1);
+    ASSERT_EQ(int(nodes.size()), Neon::sys::globalSpace::cpuSysObj().numNumaNodes());
+    for (auto const& node : nodes) {
+        NEON_INFO("GoogleTest::cpuSys NUMA node {}: {} CPUs, {} bytes", node.id, node.cpus.size(), node.memory);
+        ASSERT_GE(node.id, 0);
+    }
+}
 
 int main(int argc, char** argv)
 {
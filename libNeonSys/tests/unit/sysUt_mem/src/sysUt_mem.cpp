@@ -10,6 +10,7 @@
 
 #include "Neon/sys/memory/MemDevice.h"
 
+#include <omp.h>
 #include <cstring>
 #include <iostream>
 
@@ -107,6 +108,121 @@ TEST(Allocator, MALLOC)
     }
 }
 
+TEST(Allocator, HUGE_PAGE_MEM)
+{
+    using namespace Neon;
+    // Below and above the huge page size
+    std::vector<size_t> sizes{1, 1000, size_t(2) << 20, (size_t(5) << 20) + 3};
+
+    for (auto newSize : sizes) {
+        Neon::sys::MemDevice<char> buffer(Neon::DeviceType::CPU, 0, Neon::Allocator::HUGE_PAGE_MEM, newSize);
+        ASSERT_TRUE(Neon::sys::globalSpace::cpuSysObj().allocator().inUsedMemPageable() == newSize);
+        ASSERT_TRUE(Neon::sys::globalSpace::cpuSysObj().allocator().inUsedMemPinned() == 0);
+
+        const auto   address = reinterpret_cast<uintptr_t>(buffer.mem());
+        const size_t alignment = newSize >= (size_t(2) << 20) ? (size_t(2) << 20) : 64;
+        ASSERT_EQ(address % alignment, 0u) << "Buffer of " << newSize << " bytes is not aligned";
+
+        for (size_t i = 0; i < newSize; i++) {
+            buffer.mem()[i] = char(i);
+        }
+        ASSERT_EQ(buffer.mem()[newSize - 1], char(newSize - 1));
+    }
+    ASSERT_TRUE(Neon::sys::globalSpace::cpuSysObj().allocator().inUsedMemPageable() == 0);
+}
+
+TEST(Allocator, firstTouch)
+{
+    using namespace Neon;
+    // Large enough for the parallel first touch
+    const uint64_t nElements = (uint64_t(1) << 20) + 7;
+    const int      cardinality = 3;
+
+    Neon::sys::FirstTouchTiling firstTouch;
+    firstTouch.enabled = true;
+
+    for (auto order : {Neon::MemoryLayout::structOfArrays, Neon::MemoryLayout::arrayOfStructs}) {
+        for (auto allocator : {Neon::Allocator::MALLOC, Neon::Allocator::HUGE_PAGE_MEM}) {
+            Neon::sys::MemDevice<double> buffer(cardinality, order, Neon::DeviceType::CPU, 0, allocator, nElements, firstTouch);
+            for (uint64_t i = 0; i < nElements * cardinality; i++) {
+                ASSERT_EQ(buffer.mem()[i], 0.0) << "Element " << i << " was not initialized";
+            }
+        }
+    }
+}
+
+TEST(Allocator, firstTouchTiled)
+{
+    using namespace Neon;
+    // Rows and tiles that do not divide each other, with two halo slices at each end
+    Neon::sys::FirstTouchTiling tiling;
+    tiling.enabled = true;
+    tiling.rowLength = 37;
+    tiling.rowsPerSlice = 19;
+    tiling.haloSlices = 2;
+    tiling.tile = Neon::index_3d(5, 8, 3);
+    tiling.chunk = 2;
+    const uint64_t nElements = uint64_t(tiling.rowLength * tiling.rowsPerSlice) * (400 + 2 * tiling.haloSlices);
+    const int      cardinality = 3;
+
+    // The last size does not match the tiling, the buffer is then touched element by element
+    for (uint64_t size : {nElements, nElements + 7}) {
+        for (auto order : {Neon::MemoryLayout::structOfArrays, Neon::MemoryLayout::arrayOfStructs}) {
+            Neon::sys::MemDevice<double> buffer(cardinality, order, Neon::DeviceType::CPU, 0, Neon::Allocator::MALLOC, size, tiling);
+            for (uint64_t i = 0; i < size * cardinality; i++) {
+                ASSERT_EQ(buffer.mem()[i], 0.0) << "Element " << i << " was not initialized";
+            }
+        }
+    }
+}
+
+TEST(Allocator, firstTouchPlacement)
+{
+    using namespace Neon;
+    // Two halo slices at each end of a component and three unused slices at the end of the allocation
+    Neon::sys::FirstTouchTiling tiling;
+    tiling.enabled = true;
+    tiling.rowLength = 37;
+    tiling.rowsPerSlice = 19;
+    tiling.haloSlices = 2;
+    tiling.paddingSlices = 3;
+    tiling.tile = Neon::index_3d(5, 8, 3);
+    tiling.chunk = 2;
+    const int64_t sliceElements = tiling.rowLength * tiling.rowsPerSlice;
+    const int64_t computedSlices = 40;
+    const int64_t componentSlices = computedSlices + 2 * tiling.haloSlices;
+    const int64_t nElements = sliceElements * (componentSlices + tiling.paddingSlices);
+    const int     nComponents = 3;
+    const int     nThreads = 4;
+
+    std::vector<int> owner(nElements * nComponents, -1);
+    std::vector<int> touches(nElements * nComponents, 0);
+#pragma omp parallel num_threads(nThreads)
+    tiling.forEachRange(nElements, nComponents, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            owner[i] = omp_get_thread_num();
+            touches[i]++;
+        }
+    });
+
+    // The dense launchers run tile t on thread (t / chunk) % nThreads (static schedule with chunk)
+    const Neon::int64_3d nTiles((tiling.rowLength + tiling.tile.x - 1) / tiling.tile.x,
+                                (tiling.rowsPerSlice + tiling.tile.y - 1) / tiling.tile.y,
+                                (computedSlices + tiling.tile.z - 1) / tiling.tile.z);
+    for (int64_t i = 0; i < nElements * nComponents; i++) {
+        ASSERT_EQ(touches[i], 1) << "Element " << i << " was touched " << touches[i] << " times";
+        const int64_t c = i / (componentSlices * sliceElements);
+        const int64_t z = (i / sliceElements) % componentSlices - tiling.haloSlices;
+        if (c >= nComponents || z < 0 || z >= computedSlices) {
+            continue;
+        }
+        const int64_t x = i % tiling.rowLength;
+        const int64_t y = (i / tiling.rowLength) % tiling.rowsPerSlice;
+        const int64_t tileIdx = x / tiling.tile.x + nTiles.x * (y / tiling.tile.y + nTiles.y * (z / tiling.tile.z));
+        ASSERT_EQ(owner[i], (tileIdx / tiling.chunk) % nThreads) << "Element " << i << " of component " << c;
+    }
+}
+
 TEST(Allocator, CUDA_UNIFIED)
 {
     if (Neon::sys::globalSpace::gpuSysObjStorage.numDevs() > 0) {
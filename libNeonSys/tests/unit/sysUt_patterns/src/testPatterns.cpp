@@ -167,13 +167,67 @@ TEST(Blas, DeviceDot)
 
     EXPECT_NEAR(results, static_cast<dataT>(-2.0 * 2.0 * buffer_size), 0.001);
 }
+TEST(BlasOpenMP, Sum)
+{
+    using dataT = double;
+    int                         buffer_size = 1000;
+    Neon::sys::MemDevice<dataT> input(Neon::DeviceType::CPU, 0, Neon::Allocator::MALLOC, buffer_size);
+    Neon::sys::MemDevice<dataT> output(Neon::DeviceType::CPU, 0, Neon::Allocator::MALLOC, 1);
+
+    for (int i = 0; i < buffer_size; ++i) {
+        input.mem()[i] = -i;
+    }
+
+    Neon::sys::patterns::Blas<dataT> pat(Neon::sys::patterns::Engine::OpenMP);
+    pat.absoluteSum(input, output, 10, 100);
+
+    // sum of 10..109
+    EXPECT_EQ(output.elRef(0), static_cast<dataT>(5950));
+}
+
+TEST(BlasOpenMP, Norm2)
+{
+    using dataT = float;
+    int                         buffer_size = 1024;
+    Neon::sys::MemDevice<dataT> input(Neon::DeviceType::CPU, 0, Neon::Allocator::HUGE_PAGE_MEM, buffer_size);
+    Neon::sys::MemDevice<dataT> output(Neon::DeviceType::CPU, 0, Neon::Allocator::MALLOC, 1);
+
+    for (int i = 0; i < buffer_size; ++i) {
+        input.mem()[i] = -2;
+    }
+
+    Neon::sys::patterns::Blas<dataT> pat(Neon::sys::patterns::Engine::OpenMP);
+    pat.norm2(input, output);
+
+    EXPECT_NEAR(output.elRef(0), static_cast<dataT>(std::sqrt(2.0 * 2.0 * buffer_size)), 0.001);
+}
+
+TEST(BlasOpenMP, Dot)
+{
+    using dataT = int64_t;
+    int                         buffer_size = 1024;
+    Neon::sys::MemDevice<dataT> input1(Neon::DeviceType::CPU, 0, Neon::Allocator::MALLOC, buffer_size);
+    Neon::sys::MemDevice<dataT> input2(Neon::DeviceType::CPU, 0, Neon::Allocator::MALLOC, buffer_size);
+    Neon::sys::MemDevice<dataT> output(Neon::DeviceType::CPU, 0, Neon::Allocator::MALLOC, 1);
+
+    for (int i = 0; i < buffer_size; ++i) {
+        input1.mem()[i] = i;
+        input2.mem()[i] = 2;
+    }
+
+    Neon::sys::patterns::Blas<dataT> pat(Neon::sys::patterns::Engine::OpenMP);
+    pat.dot(input1, input2, output, 0, buffer_size);
+
+    EXPECT_EQ(output.elRef(0), dataT(buffer_size) * (buffer_size - 1));
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
     Neon::init();
-    if (Neon::sys::globalSpace::gpuSysObjStorage.numDevs() > 0) {
-        return RUN_ALL_TESTS();
-    } else {
-        return 0;
+    if (Neon::sys::globalSpace::gpuSysObjStorage.numDevs() == 0) {
+        // Only the host engine can be tested without GPUs
+        ::testing::GTEST_FLAG(filter) = "BlasOpenMP.*";
     }
+    return RUN_ALL_TESTS();
 }